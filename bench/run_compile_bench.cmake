@@ -0,0 +1,164 @@
+# Measures the front-end cost of checking each generated translation unit.
+#
+# Every translation unit is compiled twice with the same flags: once with only the container types
+# instantiated (baseline), and once with the concept checks enabled. The front-end time of each
+# compilation is taken from the compiler itself (GCC's -ftime-report CPU time, Clang's -ftime-trace
+# "Total Frontend"), and the difference between the two is reported as the cost of the checks,
+# including the template instantiations they cause. The difference is within the noise when it is
+# close to the timer resolution (10 ms for GCC), and can then even be negative; GCC's time spent
+# normalizing and satisfying constraints in the checked translation unit, which excludes those
+# instantiations, is reported as well.
+#
+# Inputs (passed with -D):
+#   CXX_COMPILER     - compiler executable
+#   CXX_COMPILER_ID  - CMAKE_CXX_COMPILER_ID of the compiler
+#   INCLUDE_DIR      - include directory of the library
+#   SOURCES          - generated translation units
+#   OUTPUT_DIR       - directory for the CSV report and compiler traces
+#   REPETITIONS      - number of times each translation unit is compiled, the minimum is reported
+cmake_minimum_required(VERSION 3.23)
+
+foreach(var IN ITEMS CXX_COMPILER CXX_COMPILER_ID INCLUDE_DIR SOURCES OUTPUT_DIR)
+	if(NOT DEFINED ${var})
+		message(FATAL_ERROR "run_compile_bench.cmake: ${var} is not set")
+	endif()
+endforeach()
+
+if(NOT DEFINED REPETITIONS)
+	set(REPETITIONS 3)
+endif()
+
+file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+find_program(TIME_EXECUTABLE NAMES time PATHS /usr/bin NO_DEFAULT_PATH)
+
+# Compiles a single translation unit, storing the front-end time (ms), the time spent in constraint
+# normalization and satisfaction (ms, or "n/a" if not reported) and the peak memory (kB, or "n/a"
+# when it cannot be determined) in the given output variables.
+function(measure_tu source baseline out_time out_constraint_time out_memory)
+	get_filename_component(name "${source}" NAME_WE)
+	if(baseline)
+		set(variant baseline)
+	else()
+		set(variant check)
+	endif()
+	set(flags -std=c++20 "-I${INCLUDE_DIR}" "-DBENCH_BASELINE=${baseline}")
+
+	if(CXX_COMPILER_ID STREQUAL "GNU")
+		# GCC reports garbage collected memory and per-phase times in its time report.
+		list(APPEND flags -fsyntax-only -ftime-report)
+	elseif(CXX_COMPILER_ID MATCHES "Clang")
+		# Clang only writes the time trace when producing an object file, next to it.
+		set(trace "${OUTPUT_DIR}/${name}.${variant}.json")
+		list(APPEND flags -c -ftime-trace -o "${OUTPUT_DIR}/${name}.${variant}.o")
+	else()
+		message(FATAL_ERROR "run_compile_bench.cmake: unsupported compiler ${CXX_COMPILER_ID}")
+	endif()
+
+	set(command "${CXX_COMPILER}" ${flags} "${source}")
+	if(TIME_EXECUTABLE)
+		set(command "${TIME_EXECUTABLE}" -f "max_rss_kb=%M" ${command})
+	endif()
+
+	execute_process(
+		COMMAND ${command}
+		RESULT_VARIABLE result
+		OUTPUT_VARIABLE output
+		ERROR_VARIABLE output
+	)
+
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "Compiling ${source} failed:\n${output}")
+	endif()
+
+	set(elapsed "")
+	set(constraint_time "n/a")
+	set(memory "n/a")
+	if(CXX_COMPILER_ID STREQUAL "GNU")
+		# The CPU time (usr + sys) is less noisy than wall time.
+		if(output MATCHES "TOTAL[ \t]*:[ \t]*([0-9]+)\\.([0-9]+)[ \t]+([0-9]+)\\.([0-9]+)[^\n]* ([0-9]+)([kMG])")
+			math(EXPR elapsed "(${CMAKE_MATCH_1}${CMAKE_MATCH_2} + ${CMAKE_MATCH_3}${CMAKE_MATCH_4}) * 10")
+			set(memory "${CMAKE_MATCH_5}")
+			if(CMAKE_MATCH_6 STREQUAL "M")
+				math(EXPR memory "${memory} * 1024")
+			elseif(CMAKE_MATCH_6 STREQUAL "G")
+				math(EXPR memory "${memory} * 1024 * 1024")
+			endif()
+		endif()
+		set(constraint_time 0)
+		foreach(phase IN ITEMS "constraint normalization" "constraint satisfaction")
+			if(output MATCHES "${phase}[ \t]*:[ \t]*([0-9]+)\\.([0-9]+)[ \t]*\\([ 0-9]*%\\)[ \t]*([0-9]+)\\.([0-9]+)")
+				math(EXPR constraint_time
+					"${constraint_time} + (${CMAKE_MATCH_1}${CMAKE_MATCH_2} + ${CMAKE_MATCH_3}${CMAKE_MATCH_4}) * 10")
+			endif()
+		endforeach()
+	else()
+		file(READ "${trace}" trace_contents)
+		if(trace_contents MATCHES "\"dur\":[ ]*([0-9]+),[ ]*\"name\":[ ]*\"Total Frontend\"")
+			math(EXPR elapsed "${CMAKE_MATCH_1} / 1000")
+		endif()
+	endif()
+	if(elapsed STREQUAL "")
+		message(FATAL_ERROR "Could not find the front-end time of ${source} in the compiler's report")
+	endif()
+	if(output MATCHES "max_rss_kb=([0-9]+)")
+		set(memory "${CMAKE_MATCH_1}")
+	endif()
+
+	set(${out_time} "${elapsed}" PARENT_SCOPE)
+	set(${out_constraint_time} "${constraint_time}" PARENT_SCOPE)
+	set(${out_memory} "${memory}" PARENT_SCOPE)
+endfunction()
+
+# Runs measure_tu REPETITIONS times, keeping the fastest run.
+function(measure_tu_min source baseline out_time out_constraint_time out_memory)
+	set(best_time "")
+	foreach(i RANGE 1 ${REPETITIONS})
+		measure_tu("${source}" ${baseline} time constraint_time memory)
+		if(best_time STREQUAL "" OR time LESS best_time)
+			set(best_time "${time}")
+			set(best_constraint_time "${constraint_time}")
+			set(best_memory "${memory}")
+		endif()
+	endforeach()
+
+	set(${out_time} "${best_time}" PARENT_SCOPE)
+	set(${out_constraint_time} "${best_constraint_time}" PARENT_SCOPE)
+	set(${out_memory} "${best_memory}" PARENT_SCOPE)
+endfunction()
+
+set(report "concept,baseline_ms,check_ms,concept_ms,constraint_ms,baseline_kb,check_kb,concept_kb\n")
+message(STATUS "")
+message(STATUS "Concept                                    concept ms    constraint ms    concept kB")
+message(STATUS "-------------------------------------------------------------------------------------")
+
+foreach(source IN LISTS SOURCES)
+	get_filename_component(name "${source}" NAME_WE)
+
+	measure_tu_min("${source}" 1 baseline_time unused baseline_memory)
+	measure_tu_min("${source}" 0 check_time constraint_time check_memory)
+
+	math(EXPR concept_time "${check_time} - ${baseline_time}")
+	set(concept_memory "n/a")
+	if(NOT check_memory STREQUAL "n/a" AND NOT baseline_memory STREQUAL "n/a")
+		math(EXPR concept_memory "${check_memory} - ${baseline_memory}")
+	endif()
+
+	string(APPEND report
+		"${name},${baseline_time},${check_time},${concept_time},${constraint_time},"
+		"${baseline_memory},${check_memory},${concept_memory}\n")
+
+	string(LENGTH "${name}" name_length)
+	math(EXPR padding "43 - ${name_length}")
+	if(padding LESS 1)
+		set(padding 1)
+	endif()
+	string(REPEAT " " ${padding} name_padding)
+	message(STATUS "${name}${name_padding}${concept_time}\t\t${constraint_time}\t\t${concept_memory}")
+endforeach()
+
+file(WRITE "${OUTPUT_DIR}/compile_bench.csv" "${report}")
+message(STATUS "")
+message(STATUS "Report written to ${OUTPUT_DIR}/compile_bench.csv")
+if(CXX_COMPILER_ID MATCHES "Clang")
+	message(STATUS "Clang time traces written to ${OUTPUT_DIR}/*.json")
+endif()
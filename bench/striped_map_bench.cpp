@@ -0,0 +1,154 @@
+// Compares the throughput of striped_map with a std::unordered_map guarded by a single mutex,
+// under a mixed lookup / update / insert / erase workload run by an increasing number of threads.
+//
+// Usage: more_concepts_striped_map_bench [operations per thread]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "more_concepts/striped_map.hpp"
+
+namespace
+{
+    /// The baseline: the operations used by the workload, each under one global lock.
+    template <typename Key, typename T>
+    class global_mutex_map
+    {
+    public:
+        [[nodiscard]] auto find(Key const& key) const -> std::optional<T>
+        {
+            auto const lock = std::scoped_lock{mutex_};
+            if (auto const it = map_.find(key); it != map_.end())
+            {
+                return it->second;
+            }
+            return std::nullopt;
+        }
+
+        template <typename Fn>
+        auto visit(Key const& key, Fn&& fn) -> bool
+        {
+            auto const lock = std::scoped_lock{mutex_};
+            if (auto const it = map_.find(key); it != map_.end())
+            {
+                std::forward<Fn>(fn)(it->second);
+                return true;
+            }
+            return false;
+        }
+
+        auto insert_or_assign(Key const& key, T const& value) -> bool
+        {
+            auto const lock = std::scoped_lock{mutex_};
+            return map_.insert_or_assign(key, value).second;
+        }
+
+        auto erase(Key const& key) -> std::size_t
+        {
+            auto const lock = std::scoped_lock{mutex_};
+            return map_.erase(key);
+        }
+
+    private:
+        mutable std::mutex mutex_;
+        std::unordered_map<Key, T> map_;
+    };
+
+    constexpr auto key_count = std::uint64_t{1} << 16u;
+
+    /// Keeps the lookups from being optimized away.
+    volatile auto sink = std::uint64_t{0};
+
+    /// xorshift64, so that generating keys does not dominate the measurement.
+    auto next_random(std::uint64_t& state) -> std::uint64_t
+    {
+        state ^= state << 13u;
+        state ^= state >> 7u;
+        state ^= state << 17u;
+        return state;
+    }
+
+    /// Runs operations_per_thread operations on each of thread_count threads: 80% lookups,
+    /// 10% in-place updates, 5% insertions and 5% erasures. Returns the operations per second.
+    template <typename Map>
+    auto measure(int const thread_count, std::uint64_t const operations_per_thread) -> double
+    {
+        auto map = Map{};
+        for (auto key = std::uint64_t{0}; key < key_count; key += 2)
+        {
+            map.insert_or_assign(key, key);
+        }
+
+        auto checksums = std::vector<std::uint64_t>(static_cast<std::size_t>(thread_count));
+        auto const start = std::chrono::steady_clock::now();
+        auto workers = std::vector<std::thread>{};
+        for (auto t = 0; t < thread_count; ++t)
+        {
+            workers.emplace_back([&map, &checksums, t, operations_per_thread] {
+                auto state = std::uint64_t{0x9E3779B97F4A7C15u} * static_cast<std::uint64_t>(t + 1);
+                auto checksum = std::uint64_t{0};
+                for (auto i = std::uint64_t{0}; i < operations_per_thread; ++i)
+                {
+                    auto const random = next_random(state);
+                    auto const key = random % key_count;
+                    auto const operation = (random >> 32u) % 20u;
+                    if (operation < 16u)
+                    {
+                        checksum += map.find(key).value_or(0);
+                    }
+                    else if (operation < 18u)
+                    {
+                        map.visit(key, [](std::uint64_t& value) { ++value; });
+                    }
+                    else if (operation < 19u)
+                    {
+                        map.insert_or_assign(key, key);
+                    }
+                    else
+                    {
+                        checksum += map.erase(key);
+                    }
+                }
+                checksums[static_cast<std::size_t>(t)] = checksum;
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+        auto const elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+        for (auto const checksum : checksums)
+        {
+            sink = sink + checksum;
+        }
+        return static_cast<double>(operations_per_thread) * thread_count / elapsed.count();
+    }
+}
+
+auto main(int const argc, char** const argv) -> int
+{
+    auto const operations_per_thread = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000ull;
+    auto const max_threads = std::max(4, static_cast<int>(std::thread::hardware_concurrency()));
+
+    std::printf("threads   global mutex (Mops/s)   striped_map (Mops/s)   speedup\n");
+    for (auto threads = 1; threads <= max_threads; threads *= 2)
+    {
+        auto const global = measure<global_mutex_map<std::uint64_t, std::uint64_t>>(
+            threads, operations_per_thread);
+        auto const striped = measure<more_concepts::striped_map<std::unordered_map<std::uint64_t, std::uint64_t>>>(
+            threads, operations_per_thread);
+        std::printf("%7d   %21.2f   %20.2f   %6.2fx\n", threads, global / 1e6, striped / 1e6, striped / global);
+    }
+
+    return EXIT_SUCCESS;
+}
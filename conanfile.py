@@ -14,6 +14,7 @@ class MoreConcepts(ConanFile):
     settings = ("os", "compiler", "arch", "build_type")
     exports_sources = (
         "include/*",
+        "modules/*",
         "tests/*",
         "CMakeLists.txt",
     )
@@ -21,6 +22,7 @@ class MoreConcepts(ConanFile):
 
     def package(self):
         copy(self, "*.hpp", self.source_folder, self.package_folder)
+        copy(self, "*.cppm", self.source_folder, self.package_folder)
 
     def package_id(self):
         self.info.clear()
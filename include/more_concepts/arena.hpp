@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+#include "more_concepts/base_containers.hpp"
+
+namespace more_concepts
+{
+    /// A monotonic memory resource: allocation bumps a pointer through chunks of memory
+    /// obtained from an upstream resource, and deallocation does nothing. The memory is reclaimed
+    /// all at once by reset(), which keeps the chunks for reuse, or release(), which returns them upstream.
+    ///
+    /// Unlike std::pmr::monotonic_buffer_resource, resetting does not return the chunks upstream,
+    /// so an arena reused for a sequence of similar tasks (e.g. requests) stops allocating from
+    /// upstream once it has grown to the size a task needs.
+    ///
+    /// Not thread-safe.
+    class arena_resource : public std::pmr::memory_resource
+    {
+    public:
+        /// The size of the first chunk allocated from upstream.
+        static constexpr std::size_t initial_chunk_size = 4096;
+
+        explicit arena_resource(std::pmr::memory_resource* const upstream = std::pmr::get_default_resource()) noexcept
+            : upstream_{upstream}
+        {
+        }
+
+        /// Uses the buffer before allocating from upstream. The buffer must outlive the arena.
+        arena_resource(
+            void* const buffer,
+            std::size_t const buffer_size,
+            std::pmr::memory_resource* const upstream = std::pmr::get_default_resource()) noexcept
+            : upstream_{upstream}
+            , initial_buffer_{static_cast<std::byte*>(buffer)}
+            , initial_buffer_size_{buffer_size}
+            , position_{initial_buffer_}
+            , end_{initial_buffer_ + buffer_size}
+            , next_chunk_size_{std::max(initial_chunk_size, buffer_size * 2)}
+        {
+        }
+
+        arena_resource(arena_resource const&) = delete;
+        auto operator=(arena_resource const&) -> arena_resource& = delete;
+
+        ~arena_resource() override
+        {
+            release();
+        }
+
+        [[nodiscard]] auto upstream_resource() const noexcept -> std::pmr::memory_resource*
+        {
+            return upstream_;
+        }
+
+        /// Makes all the memory available for allocation again, keeping the chunks allocated from upstream.
+        /// Everything allocated from the arena must no longer be in use.
+        auto reset() noexcept -> void
+        {
+            current_ = nullptr;
+            position_ = initial_buffer_;
+            end_ = initial_buffer_ + initial_buffer_size_;
+        }
+
+        /// Returns all the chunks to the upstream resource.
+        /// Everything allocated from the arena must no longer be in use.
+        auto release() noexcept -> void
+        {
+            while (first_chunk_ != nullptr)
+            {
+                auto* const chunk = std::exchange(first_chunk_, first_chunk_->next);
+                upstream_->deallocate(chunk, chunk->size, alignof(chunk_header));
+            }
+            last_chunk_ = nullptr;
+            next_chunk_size_ = std::max(initial_chunk_size, initial_buffer_size_ * 2);
+            reset();
+        }
+
+    protected:
+        auto do_allocate(std::size_t const bytes, std::size_t const alignment) -> void* override
+        {
+            if (auto* const ptr = bump(bytes, alignment))
+            {
+                return ptr;
+            }
+
+            // Move on to the chunks kept by reset(), then to a new one.
+            for (auto* chunk = current_ != nullptr ? current_->next : first_chunk_; chunk != nullptr; chunk = chunk->next)
+            {
+                use_chunk(chunk);
+                if (auto* const ptr = bump(bytes, alignment))
+                {
+                    return ptr;
+                }
+            }
+
+            use_chunk(allocate_chunk(bytes + alignment));
+            return bump(bytes, alignment);
+        }
+
+        auto do_deallocate(void*, std::size_t, std::size_t) -> void override
+        {
+        }
+
+        [[nodiscard]] auto do_is_equal(std::pmr::memory_resource const& other) const noexcept -> bool override
+        {
+            return this == &other;
+        }
+
+    private:
+        /// Stored at the start of each chunk allocated from upstream.
+        struct alignas(std::max_align_t) chunk_header
+        {
+            chunk_header* next;
+            std::size_t size;
+        };
+
+        std::pmr::memory_resource* upstream_;
+        std::byte* initial_buffer_ = nullptr;
+        std::size_t initial_buffer_size_ = 0;
+        chunk_header* first_chunk_ = nullptr;
+        chunk_header* last_chunk_ = nullptr;
+        chunk_header* current_ = nullptr;
+        std::byte* position_ = nullptr;
+        std::byte* end_ = nullptr;
+        std::size_t next_chunk_size_ = initial_chunk_size;
+
+        /// Allocates from the current chunk, or returns nullptr if it does not have enough space.
+        auto bump(std::size_t const bytes, std::size_t const alignment) noexcept -> void*
+        {
+            void* ptr = position_;
+            auto space = static_cast<std::size_t>(end_ - position_);
+            if (std::align(alignment, bytes, ptr, space) == nullptr)
+            {
+                return nullptr;
+            }
+            position_ = static_cast<std::byte*>(ptr) + bytes;
+            return ptr;
+        }
+
+        auto use_chunk(chunk_header* const chunk) noexcept -> void
+        {
+            current_ = chunk;
+            position_ = reinterpret_cast<std::byte*>(chunk + 1);
+            end_ = reinterpret_cast<std::byte*>(chunk) + chunk->size;
+        }
+
+        /// Allocates a chunk with at least min_bytes available, growing the chunk size geometrically.
+        auto allocate_chunk(std::size_t const min_bytes) -> chunk_header*
+        {
+            auto const size = std::max(next_chunk_size_, sizeof(chunk_header) + min_bytes);
+            auto* const chunk = ::new (upstream_->allocate(size, alignof(chunk_header))) chunk_header{nullptr, size};
+            next_chunk_size_ = size * 2;
+
+            (last_chunk_ != nullptr ? last_chunk_->next : first_chunk_) = chunk;
+            last_chunk_ = chunk;
+            return chunk;
+        }
+    };
+
+    /// An arena_resource with InlineBytes of inline storage, for building containers whose memory
+    /// is freed all at once when the scope ends (such as the containers used to handle a request).
+    /// make<C>(args...) creates any allocator-aware container using a polymorphic allocator
+    /// (e.g. std::pmr::vector or std::pmr::unordered_map) that allocates from the arena.
+    ///
+    /// The containers must be destroyed before the arena, although their deallocation is free;
+    /// the arena must not be moved, as the containers refer to it.
+    template <std::size_t InlineBytes = 4096>
+    class scoped_arena
+    {
+    public:
+        explicit scoped_arena(std::pmr::memory_resource* const upstream = std::pmr::get_default_resource()) noexcept
+            : resource_{buffer_, InlineBytes, upstream}
+        {
+        }
+
+        scoped_arena(scoped_arena const&) = delete;
+        auto operator=(scoped_arena const&) -> scoped_arena& = delete;
+
+        [[nodiscard]] auto resource() noexcept -> arena_resource&
+        {
+            return resource_;
+        }
+
+        template <typename T = std::byte>
+        [[nodiscard]] auto allocator() noexcept -> std::pmr::polymorphic_allocator<T>
+        {
+            return std::pmr::polymorphic_allocator<T>{&resource_};
+        }
+
+        /// Creates a container from args, and an allocator using the arena.
+        template <allocator_aware_container C, typename... Args>
+        requires std::constructible_from<typename C::allocator_type, std::pmr::memory_resource*> and
+                 std::constructible_from<C, Args..., typename C::allocator_type>
+        [[nodiscard]] auto make(Args&& ... args) -> C
+        {
+            return C(std::forward<Args>(args)..., typename C::allocator_type(&resource_));
+        }
+
+        /// Makes the memory of the arena available again; see arena_resource::reset().
+        auto reset() noexcept -> void
+        {
+            resource_.reset();
+        }
+
+    private:
+        alignas(std::max_align_t) std::byte buffer_[InlineBytes == 0 ? 1 : InlineBytes];
+        arena_resource resource_;
+    };
+}
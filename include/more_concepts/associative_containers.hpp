@@ -3,14 +3,47 @@
 #include <concepts>
 #include <initializer_list>
 #include <iterator>
+#include <tuple>
 #include <utility>
 
 #include "more_concepts/base_concepts.hpp"
+#include "more_concepts/container_category.hpp"
 #include "more_concepts/base_containers.hpp"
+#include "more_concepts/lite_containers.hpp"
 #include "more_concepts/mock_iterator.hpp"
 
 namespace more_concepts
 {
+    /// The searching subset of associative_container: a container that provides fast lookup
+    /// of objects based on keys, without requirements on construction, insertion or erasure.
+    /// Satisfied by all standard set and map types, and by read-only tables such as mapped_flat_map.
+    template <typename C>
+    concept read_only_associative_container
+    = container<C> and
+      sized_container<C> and
+      (detail::declares_container_category<C, container_category::associative_container> or
+       requires(C& cont, C const& const_cont)
+       {
+           typename C::key_type;
+
+           // Searching
+           requires
+           requires(typename C::key_type const& key)
+           {
+               { const_cont.count(key) } -> std::same_as<typename C::size_type>;
+               { const_cont.contains(key) } -> std::same_as<bool>;
+               { cont.find(key) } -> std::same_as<typename C::iterator>;
+               { const_cont.find(key) } -> std::same_as<typename C::const_iterator>;
+               {
+               cont.equal_range(key)
+               } -> std::same_as<std::pair<typename C::iterator, typename C::iterator>>;
+               {
+               const_cont.equal_range(key)
+               } -> std::same_as<std::pair<typename C::const_iterator, typename C::const_iterator>>;
+           };
+       } or
+       detail::reject_container_category<C, container_category::associative_container>());
+
     /// A container that provides fast lookup of objects based on keys.
     /// Satisfied by all standard set and map types.
     ///
@@ -23,86 +56,70 @@ namespace more_concepts
     /// for every constructor of the form value_type(Args...).
     template <typename C>
     concept associative_container
-    = container<C> and
-      sized_container<C> and
+    = read_only_associative_container<C> and
       clearable_container<C> and
       std::default_initializable<C> and
-      requires(C& cont, C const& const_cont)
-      {
-          typename C::key_type;
-
-          // Searching
-          requires
-          requires(typename C::key_type const& key)
-          {
-              { const_cont.count(key) } -> std::same_as<typename C::size_type>;
-              { const_cont.contains(key) } -> std::same_as<bool>;
-              { cont.find(key) } -> std::same_as<typename C::iterator>;
-              { const_cont.find(key) } -> std::same_as<typename C::const_iterator>;
-              {
-              cont.equal_range(key)
-              } -> std::same_as<std::pair<typename C::iterator, typename C::iterator>>;
-              {
-              const_cont.equal_range(key)
-              } -> std::same_as<std::pair<typename C::const_iterator, typename C::const_iterator>>;
-          };
-
-          // Emplacement (default constructor)
-          requires not std::default_initializable<typename C::value_type> or
-                   requires(typename C::const_iterator const& hint)
-                   {{ cont.emplace_hint(hint) } -> std::same_as<typename C::iterator>; };
-
-          // Copy-enabled operations
-          requires not std::copyable<typename C::value_type> or
-                   requires(
-                       typename C::value_type const& value,
-                       typename C::const_iterator const& hint,
-                       mock_const_iterator<typename C::value_type, std::input_iterator_tag> const& first,
-                       mock_const_iterator<typename C::value_type, std::input_iterator_tag> const& last,
-                       std::initializer_list<typename C::value_type> const& init_list)
-                   {
-                       // Range construction and assignment
-                       C(first, last);
-                       C(init_list);
-                       cont = init_list;
-
-                       // Copy insertion
-                       { cont.insert(hint, value) } -> std::same_as<typename C::iterator>;
-
-                       // Range insertion
-                       cont.insert(first, last);
-                       cont.insert(init_list);
-
-                       // Emplacement (copy constructor)
-                       { cont.emplace_hint(hint, value) } -> std::same_as<typename C::iterator>;
-                   };
-
-          // Move-enabled operations
-          requires not std::movable<typename C::value_type> or
-                   requires(
-                       typename C::value_type&& tmp_value,
-                       typename C::const_iterator const& hint)
-                   {
-                       // Move insertion
-                       { cont.insert(hint, std::move(tmp_value)) } -> std::same_as<typename C::iterator>;
-
-                       // Emplacement (move constructor)
-                       { cont.emplace_hint(hint, std::move(tmp_value)) } -> std::same_as<typename C::iterator>;
-                   };
-
-          // Erasure
-          requires
-          requires(
-              typename C::const_iterator const& pos,
-              typename C::const_iterator const& first,
-              typename C::const_iterator const& last,
-              typename C::key_type const& key)
-          {
-              { cont.erase(pos) } -> std::same_as<typename C::iterator>;
-              { cont.erase(first, last) } -> std::same_as<typename C::iterator>;
-              { cont.erase(key) } -> std::same_as<typename C::size_type>;
-          };
-      };
+      lite::associative_container<C> and
+      (detail::declares_container_category<C, container_category::associative_container> or
+       requires(C& cont, C const& const_cont)
+       {
+           // Emplacement (default constructor)
+           requires not std::default_initializable<typename C::value_type> or
+                    requires(typename C::const_iterator const& hint)
+                    {{ cont.emplace_hint(hint) } -> std::same_as<typename C::iterator>; };
+
+           // Copy-enabled operations
+           requires not std::copyable<typename C::value_type> or
+                    requires(
+                        typename C::value_type const& value,
+                        typename C::const_iterator const& hint,
+                        mock_const_iterator<typename C::value_type, std::input_iterator_tag> const& first,
+                        mock_const_iterator<typename C::value_type, std::input_iterator_tag> const& last,
+                        std::initializer_list<typename C::value_type> const& init_list)
+                    {
+                        // Range construction and assignment
+                        C(first, last);
+                        C(init_list);
+                        cont = init_list;
+
+                        // Copy insertion
+                        { cont.insert(hint, value) } -> std::same_as<typename C::iterator>;
+
+                        // Range insertion
+                        cont.insert(first, last);
+                        cont.insert(init_list);
+
+                        // Emplacement (copy constructor)
+                        { cont.emplace_hint(hint, value) } -> std::same_as<typename C::iterator>;
+                    };
+
+           // Move-enabled operations
+           requires not std::movable<typename C::value_type> or
+                    requires(
+                        typename C::value_type&& tmp_value,
+                        typename C::const_iterator const& hint)
+                    {
+                        // Move insertion
+                        { cont.insert(hint, std::move(tmp_value)) } -> std::same_as<typename C::iterator>;
+
+                        // Emplacement (move constructor)
+                        { cont.emplace_hint(hint, std::move(tmp_value)) } -> std::same_as<typename C::iterator>;
+                    };
+
+           // Erasure
+           requires
+           requires(
+               typename C::const_iterator const& pos,
+               typename C::const_iterator const& first,
+               typename C::const_iterator const& last,
+               typename C::key_type const& key)
+           {
+               { cont.erase(pos) } -> std::same_as<typename C::iterator>;
+               { cont.erase(first, last) } -> std::same_as<typename C::iterator>;
+               { cont.erase(key) } -> std::same_as<typename C::size_type>;
+           };
+       } or
+       detail::reject_container_category<C, container_category::associative_container>());
 
     /// An associative container without multiple key occurrence.
     /// Satisfied by set, map, unordered_set and unordered_map.
@@ -112,35 +129,37 @@ namespace more_concepts
     template <typename C>
     concept unique_associative_container
     = associative_container<C> and
-      requires(C& cont, C const& const_cont)
-      {
-          // Emplacement (default constructor)
-          requires not std::default_initializable<typename C::value_type> or
-                   requires(typename C::const_iterator const& hint)
-                   {{ cont.emplace() } -> std::same_as<std::pair<typename C::iterator, bool>>; };
-
-          // Copy-enabled operations
-          requires not std::copyable<typename C::value_type> or
-                   requires(typename C::value_type const& value)
-                   {
-                       // Copy insertion
-                       { cont.insert(value) } -> std::same_as<std::pair<typename C::iterator, bool>>;
-
-                       // Emplacement (copy constructor)
-                       { cont.emplace(value) } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                   };
-
-          // Move-enabled operations
-          requires not std::movable<typename C::value_type> or
-                   requires(typename C::value_type&& tmp_value)
-                   {
-                       // Move insertion
-                       { cont.insert(std::move(tmp_value)) } -> std::same_as<std::pair<typename C::iterator, bool>>;
-
-                       // Emplacement (move constructor)
-                       { cont.emplace(std::move(tmp_value)) } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                   };
-      };
+      (detail::declares_container_category<C, container_category::unique_associative_container> or
+       requires(C& cont, C const& const_cont)
+       {
+           // Emplacement (default constructor)
+           requires not std::default_initializable<typename C::value_type> or
+                    requires(typename C::const_iterator const& hint)
+                    {{ cont.emplace() } -> std::same_as<std::pair<typename C::iterator, bool>>; };
+
+           // Copy-enabled operations
+           requires not std::copyable<typename C::value_type> or
+                    requires(typename C::value_type const& value)
+                    {
+                        // Copy insertion
+                        { cont.insert(value) } -> std::same_as<std::pair<typename C::iterator, bool>>;
+
+                        // Emplacement (copy constructor)
+                        { cont.emplace(value) } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                    };
+
+           // Move-enabled operations
+           requires not std::movable<typename C::value_type> or
+                    requires(typename C::value_type&& tmp_value)
+                    {
+                        // Move insertion
+                        { cont.insert(std::move(tmp_value)) } -> std::same_as<std::pair<typename C::iterator, bool>>;
+
+                        // Emplacement (move constructor)
+                        { cont.emplace(std::move(tmp_value)) } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                    };
+       } or
+       detail::reject_container_category<C, container_category::unique_associative_container>());
 
     /// An associative container with multiple key occurrence.
     /// Satisfied by multiset, multimap, unordered_multiset and unordered_multimap.
@@ -150,35 +169,37 @@ namespace more_concepts
     template <typename C>
     concept multiple_associative_container
     = associative_container<C> and
-      requires(C& cont, C const& const_cont)
-      {
-          // Emplacement (default constructor)
-          requires not std::default_initializable<typename C::value_type> or
-                   requires(typename C::const_iterator const& hint)
-                   {{ cont.emplace() } -> std::same_as<typename C::iterator>; };
-
-          // Copy-enabled operations
-          requires not std::copyable<typename C::value_type> or
-                   requires(typename C::value_type const& value)
-                   {
-                       // Copy insertion
-                       { cont.insert(value) } -> std::same_as<typename C::iterator>;
-
-                       // Emplacement (copy constructor)
-                       { cont.emplace(value) } -> std::same_as<typename C::iterator>;
-                   };
-
-          // Move-enabled operations
-          requires not std::movable<typename C::value_type> or
-                   requires(typename C::value_type&& tmp_value)
-                   {
-                       // Move insertion
-                       { cont.insert(std::move(tmp_value)) } -> std::same_as<typename C::iterator>;
-
-                       // Emplacement (move constructor)
-                       { cont.emplace(std::move(tmp_value)) } -> std::same_as<typename C::iterator>;
-                   };
-      };
+      (detail::declares_container_category<C, container_category::multiple_associative_container> or
+       requires(C& cont, C const& const_cont)
+       {
+           // Emplacement (default constructor)
+           requires not std::default_initializable<typename C::value_type> or
+                    requires(typename C::const_iterator const& hint)
+                    {{ cont.emplace() } -> std::same_as<typename C::iterator>; };
+
+           // Copy-enabled operations
+           requires not std::copyable<typename C::value_type> or
+                    requires(typename C::value_type const& value)
+                    {
+                        // Copy insertion
+                        { cont.insert(value) } -> std::same_as<typename C::iterator>;
+
+                        // Emplacement (copy constructor)
+                        { cont.emplace(value) } -> std::same_as<typename C::iterator>;
+                    };
+
+           // Move-enabled operations
+           requires not std::movable<typename C::value_type> or
+                    requires(typename C::value_type&& tmp_value)
+                    {
+                        // Move insertion
+                        { cont.insert(std::move(tmp_value)) } -> std::same_as<typename C::iterator>;
+
+                        // Emplacement (move constructor)
+                        { cont.emplace(std::move(tmp_value)) } -> std::same_as<typename C::iterator>;
+                    };
+       } or
+       detail::reject_container_category<C, container_category::multiple_associative_container>());
 
     /// An associative container ordered on keys.
     /// Satisfied by set, map, multiset and multimap.
@@ -187,51 +208,54 @@ namespace more_concepts
     template <typename C>
     concept ordered_associative_container
     = associative_container<C> and
-      requires(C& cont, C const& const_cont)
-      {
-          // Comparators
-          typename C::key_compare;
-          typename C::value_compare;
-          requires std::strict_weak_order<
-              typename C::key_compare, typename C::key_type, typename C::key_type>;
-          requires std::strict_weak_order<
-              typename C::value_compare, typename C::value_type, typename C::value_type>;
-
-          // Ordered associative containers of ordered values should provide a lexicographical ordering
-          requires not std::totally_ordered<typename C::value_type> or
-                   std::totally_ordered<C>;
-
-          // Observers
-          { const_cont.key_comp() } -> std::same_as<typename C::key_compare>;
-          { const_cont.value_comp() } -> std::same_as<typename C::value_compare>;
-
-          // Construction with comparator
-          requires
-          requires(typename C::key_compare const& key_comp)
-          {
-              C(key_comp);
-
-              requires not std::copyable<typename C::value_type> or
-                       requires(
-                           mock_const_iterator<typename C::value_type, std::input_iterator_tag> const& first,
-                           mock_const_iterator<typename C::value_type, std::input_iterator_tag> const& last,
-                           std::initializer_list<typename C::value_type> const& init_list)
-                       {
-                           C(first, last, key_comp);
-                           C(init_list, key_comp);
-                       };
-          };
-
-          // Binary searching
-          requires
-          requires(typename C::key_type const& key)
-          {
-              { cont.lower_bound(key) } -> std::same_as<typename C::iterator>;
-              { const_cont.lower_bound(key) } -> std::same_as<typename C::const_iterator>;
-              { cont.upper_bound(key) } -> std::same_as<typename C::iterator>;
-              { const_cont.upper_bound(key) } -> std::same_as<typename C::const_iterator>;
-          };
-      };
+      lite::ordered_associative_container<C> and
+      (detail::declares_container_category<C, container_category::ordered_associative_container> or
+       requires(C& cont, C const& const_cont)
+       {
+           // Comparators
+           typename C::key_compare;
+           typename C::value_compare;
+           requires std::strict_weak_order<
+               typename C::key_compare, typename C::key_type, typename C::key_type>;
+           requires std::strict_weak_order<
+               typename C::value_compare, typename C::value_type, typename C::value_type>;
+
+           // Ordered associative containers of ordered values should provide a lexicographical ordering
+           requires not std::totally_ordered<typename C::value_type> or
+                    std::totally_ordered<C>;
+
+           // Observers
+           { const_cont.key_comp() } -> std::same_as<typename C::key_compare>;
+           { const_cont.value_comp() } -> std::same_as<typename C::value_compare>;
+
+           // Construction with comparator
+           requires
+           requires(typename C::key_compare const& key_comp)
+           {
+               C(key_comp);
+
+               requires not std::copyable<typename C::value_type> or
+                        requires(
+                            mock_const_iterator<typename C::value_type, std::input_iterator_tag> const& first,
+                            mock_const_iterator<typename C::value_type, std::input_iterator_tag> const& last,
+                            std::initializer_list<typename C::value_type> const& init_list)
+                        {
+                            C(first, last, key_comp);
+                            C(init_list, key_comp);
+                        };
+           };
+
+           // Binary searching
+           requires
+           requires(typename C::key_type const& key)
+           {
+               { cont.lower_bound(key) } -> std::same_as<typename C::iterator>;
+               { const_cont.lower_bound(key) } -> std::same_as<typename C::const_iterator>;
+               { cont.upper_bound(key) } -> std::same_as<typename C::iterator>;
+               { const_cont.upper_bound(key) } -> std::same_as<typename C::const_iterator>;
+           };
+       } or
+       detail::reject_container_category<C, container_category::ordered_associative_container>());
 
     /// An ordered associative container without multiple key occurrence.
     /// Satisfied by set and map.
@@ -252,62 +276,65 @@ namespace more_concepts
     template <typename C>
     concept unordered_associative_container
     = associative_container<C> and
-      requires(C& cont, C const& const_cont)
-      {
-          // Key hash function
-          typename C::hasher;
-          requires hash_function<typename C::hasher, typename C::key_type>;
-
-          // Key equality predicate
-          typename C::key_equal;
-          requires std::equivalence_relation<
-              typename C::key_equal, typename C::key_type, typename C::key_type>;
-
-          // Observers
-          { const_cont.hash_function() } -> std::same_as<typename C::hasher>;
-          { const_cont.key_eq() } -> std::same_as<typename C::key_equal>;
-
-          // Hash policy
-          requires
-          requires(float const& ml, std::size_t n) {
-              { const_cont.load_factor() } -> std::same_as<float>;
-              { const_cont.max_load_factor() } -> std::same_as<float>;
-              cont.max_load_factor(ml);
-              cont.rehash(n);
-              cont.reserve(n);
-          };
-
-          // Minimal bucket interface
-          { const_cont.bucket_count() } -> std::same_as<std::size_t>;
-          // Not requiring local_iterator etc as its not provided by many popular
-          // non-std hash tables, e.g. absl::flat_hash_set and tsl::robin_map.
-
-          // Construction with bucket count, hash function, and equality predicate
-          requires
-          requires(
-              std::size_t const& bucket_count,
-              typename C::hasher const& hash,
-              typename C::key_equal const& equal)
-          {
-              C(bucket_count);
-              C(bucket_count, hash);
-              C(bucket_count, hash, equal);
-
-              requires not std::copyable<typename C::value_type> or
-                       requires(
-                           mock_const_iterator<typename C::value_type, std::input_iterator_tag> const& first,
-                           mock_const_iterator<typename C::value_type, std::input_iterator_tag> const& last,
-                           std::initializer_list<typename C::value_type> const& init_list)
-                       {
-                           C(first, last, bucket_count);
-                           C(first, last, bucket_count, hash);
-                           C(first, last, bucket_count, hash, equal);
-                           C(init_list, bucket_count);
-                           C(init_list, bucket_count, hash);
-                           C(init_list, bucket_count, hash, equal);
-                       };
-          };
-      };
+      lite::unordered_associative_container<C> and
+      (detail::declares_container_category<C, container_category::unordered_associative_container> or
+       requires(C& cont, C const& const_cont)
+       {
+           // Key hash function
+           typename C::hasher;
+           requires hash_function<typename C::hasher, typename C::key_type>;
+
+           // Key equality predicate
+           typename C::key_equal;
+           requires std::equivalence_relation<
+               typename C::key_equal, typename C::key_type, typename C::key_type>;
+
+           // Observers
+           { const_cont.hash_function() } -> std::same_as<typename C::hasher>;
+           { const_cont.key_eq() } -> std::same_as<typename C::key_equal>;
+
+           // Hash policy
+           requires
+           requires(float const& ml, std::size_t n) {
+               { const_cont.load_factor() } -> std::same_as<float>;
+               { const_cont.max_load_factor() } -> std::same_as<float>;
+               cont.max_load_factor(ml);
+               cont.rehash(n);
+               cont.reserve(n);
+           };
+
+           // Minimal bucket interface
+           { const_cont.bucket_count() } -> std::same_as<std::size_t>;
+           // Not requiring local_iterator etc as its not provided by many popular
+           // non-std hash tables, e.g. absl::flat_hash_set and tsl::robin_map.
+
+           // Construction with bucket count, hash function, and equality predicate
+           requires
+           requires(
+               std::size_t const& bucket_count,
+               typename C::hasher const& hash,
+               typename C::key_equal const& equal)
+           {
+               C(bucket_count);
+               C(bucket_count, hash);
+               C(bucket_count, hash, equal);
+
+               requires not std::copyable<typename C::value_type> or
+                        requires(
+                            mock_const_iterator<typename C::value_type, std::input_iterator_tag> const& first,
+                            mock_const_iterator<typename C::value_type, std::input_iterator_tag> const& last,
+                            std::initializer_list<typename C::value_type> const& init_list)
+                        {
+                            C(first, last, bucket_count);
+                            C(first, last, bucket_count, hash);
+                            C(first, last, bucket_count, hash, equal);
+                            C(init_list, bucket_count);
+                            C(init_list, bucket_count, hash);
+                            C(init_list, bucket_count, hash, equal);
+                        };
+           };
+       } or
+       detail::reject_container_category<C, container_category::unordered_associative_container>());
 
     /// A hash-based associative container without multiple key occurrence.
     /// Satisfied by unordered_set and unordered_map.
@@ -326,118 +353,121 @@ namespace more_concepts
     template <typename C>
     concept map_container
     = associative_container<C> and
-      requires(C& cont, C const& const_cont)
-      {
-          typename C::mapped_type;
-
-          requires
-          requires(typename C::const_iterator const& hint)
-          {
-              requires not std::copyable<typename C::key_type> or
-                       requires(typename C::key_type const& key)
-                       {
-                           // Emplacement (key copy, mapped object default constructor)
-                           requires not std::default_initializable<typename C::mapped_type> or
-                                    requires
-                                    {
-                                        {
-                                        cont.emplace_hint(hint, key)
-                                        } -> std::same_as<typename C::iterator>;
-                                        {
-                                        cont.emplace_hint(
-                                            hint,
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(key),
-                                            std::forward_as_tuple())
-                                        }  -> std::same_as<typename C::iterator>;
-                                    };
-
-                           // Emplacement (key copy, mapped object copy constructor)
-                           requires not std::copyable<typename C::mapped_type> or
-                                    requires(typename C::mapped_type const& obj)
-                                    {
-                                        {
-                                        cont.emplace_hint(hint, key, obj)
-                                        } -> std::same_as<typename C::iterator>;
-                                        {
-                                        cont.emplace_hint(
-                                            hint,
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(key),
-                                            std::forward_as_tuple(obj))
-                                        }  -> std::same_as<typename C::iterator>;
-                                    };
-
-                           // Emplacement (key copy, mapped object move constructor)
-                           requires not std::movable<typename C::mapped_type> or
-                                    requires(typename C::mapped_type&& obj)
-                                    {
-                                        {
-                                        cont.emplace_hint(hint, key, std::move(obj))
-                                        } -> std::same_as<typename C::iterator>;
-                                        {
-                                        cont.emplace_hint(
-                                            hint,
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(key),
-                                            std::forward_as_tuple(std::move(obj)))
-                                        }  -> std::same_as<typename C::iterator>;
-                                    };
-                       };
-
-              requires not std::movable<typename C::key_type> or
-                       requires(typename C::key_type&& key)
-                       {
-                           // Emplacement (key move, mapped object default constructor)
-                           requires not std::default_initializable<typename C::mapped_type> or
-                                    requires
-                                    {
-                                        {
-                                        cont.emplace_hint(hint, std::move(key))
-                                        } -> std::same_as<typename C::iterator>;
-                                        {
-                                        cont.emplace_hint(
-                                            hint,
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(std::move(key)),
-                                            std::forward_as_tuple())
-                                        }  -> std::same_as<typename C::iterator>;
-                                    };
-
-                           // Emplacement (key move, mapped object copy constructor)
-                           requires not std::copyable<typename C::mapped_type> or
-                                    requires(typename C::mapped_type const& obj)
-                                    {
-                                        {
-                                        cont.emplace_hint(hint, std::move(key), obj)
-                                        } -> std::same_as<typename C::iterator>;
-                                        {
-                                        cont.emplace_hint(
-                                            hint,
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(std::move(key)),
-                                            std::forward_as_tuple(obj))
-                                        }  -> std::same_as<typename C::iterator>;
-                                    };
-
-                           // Emplacement (key move, mapped object move constructor)
-                           requires not std::movable<typename C::mapped_type> or
-                                    requires(typename C::mapped_type&& obj)
-                                    {
-                                        {
-                                        cont.emplace_hint(hint, std::move(key), std::move(obj))
-                                        } -> std::same_as<typename C::iterator>;
-                                        {
-                                        cont.emplace_hint(
-                                            hint,
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(std::move(key)),
-                                            std::forward_as_tuple(std::move(obj)))
-                                        }  -> std::same_as<typename C::iterator>;
-                                    };
-                       };
-          };
-      };
+      lite::map_container<C> and
+      (detail::declares_container_category<C, container_category::map_container> or
+       requires(C& cont, C const& const_cont)
+       {
+           typename C::mapped_type;
+
+           requires
+           requires(typename C::const_iterator const& hint)
+           {
+               requires not std::copyable<typename C::key_type> or
+                        requires(typename C::key_type const& key)
+                        {
+                            // Emplacement (key copy, mapped object default constructor)
+                            requires not std::default_initializable<typename C::mapped_type> or
+                                     requires
+                                     {
+                                         {
+                                         cont.emplace_hint(hint, key)
+                                         } -> std::same_as<typename C::iterator>;
+                                         {
+                                         cont.emplace_hint(
+                                             hint,
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(key),
+                                             std::forward_as_tuple())
+                                         }  -> std::same_as<typename C::iterator>;
+                                     };
+
+                            // Emplacement (key copy, mapped object copy constructor)
+                            requires not std::copyable<typename C::mapped_type> or
+                                     requires(typename C::mapped_type const& obj)
+                                     {
+                                         {
+                                         cont.emplace_hint(hint, key, obj)
+                                         } -> std::same_as<typename C::iterator>;
+                                         {
+                                         cont.emplace_hint(
+                                             hint,
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(key),
+                                             std::forward_as_tuple(obj))
+                                         }  -> std::same_as<typename C::iterator>;
+                                     };
+
+                            // Emplacement (key copy, mapped object move constructor)
+                            requires not std::movable<typename C::mapped_type> or
+                                     requires(typename C::mapped_type&& obj)
+                                     {
+                                         {
+                                         cont.emplace_hint(hint, key, std::move(obj))
+                                         } -> std::same_as<typename C::iterator>;
+                                         {
+                                         cont.emplace_hint(
+                                             hint,
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(key),
+                                             std::forward_as_tuple(std::move(obj)))
+                                         }  -> std::same_as<typename C::iterator>;
+                                     };
+                        };
+
+               requires not std::movable<typename C::key_type> or
+                        requires(typename C::key_type&& key)
+                        {
+                            // Emplacement (key move, mapped object default constructor)
+                            requires not std::default_initializable<typename C::mapped_type> or
+                                     requires
+                                     {
+                                         {
+                                         cont.emplace_hint(hint, std::move(key))
+                                         } -> std::same_as<typename C::iterator>;
+                                         {
+                                         cont.emplace_hint(
+                                             hint,
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(std::move(key)),
+                                             std::forward_as_tuple())
+                                         }  -> std::same_as<typename C::iterator>;
+                                     };
+
+                            // Emplacement (key move, mapped object copy constructor)
+                            requires not std::copyable<typename C::mapped_type> or
+                                     requires(typename C::mapped_type const& obj)
+                                     {
+                                         {
+                                         cont.emplace_hint(hint, std::move(key), obj)
+                                         } -> std::same_as<typename C::iterator>;
+                                         {
+                                         cont.emplace_hint(
+                                             hint,
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(std::move(key)),
+                                             std::forward_as_tuple(obj))
+                                         }  -> std::same_as<typename C::iterator>;
+                                     };
+
+                            // Emplacement (key move, mapped object move constructor)
+                            requires not std::movable<typename C::mapped_type> or
+                                     requires(typename C::mapped_type&& obj)
+                                     {
+                                         {
+                                         cont.emplace_hint(hint, std::move(key), std::move(obj))
+                                         } -> std::same_as<typename C::iterator>;
+                                         {
+                                         cont.emplace_hint(
+                                             hint,
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(std::move(key)),
+                                             std::forward_as_tuple(std::move(obj)))
+                                         }  -> std::same_as<typename C::iterator>;
+                                     };
+                        };
+           };
+       } or
+       detail::reject_container_category<C, container_category::map_container>());
 
     /// A map container without multiple key occurrence.
     /// Satisfied by map and unordered_map.
@@ -456,317 +486,322 @@ namespace more_concepts
     template <typename C>
     concept unique_map_container
     = map_container<C> and
-      requires(C& cont, C const& const_cont)
-      {
-          // Element access
-          requires
-          requires(typename C::key_type const& key, typename C::key_type const& tmp_key)
-          {
-              // operator[] access
-              requires not std::default_initializable<typename C::mapped_type> or
-                       requires
-                       {
-                           // Key copy
-                           requires not std::copyable<typename C::key_type> or
-                                    requires {{ cont[key] } -> std::same_as<typename C::mapped_type&>; };
-
-                           // Key move
-                           requires not std::movable<typename C::key_type> or
-                                    requires
-                                    {{ cont[std::move(tmp_key)] } -> std::same_as<typename C::mapped_type&>; };
-                       };
-
-              // Checked access
-              { cont.at(key) } -> std::same_as<typename C::mapped_type&>;
-              { const_cont.at(key) } -> std::same_as<typename C::mapped_type const&>;
-          };
-
-          requires
-          requires(typename C::const_iterator const& hint)
-          {
-              // Key copy
-              requires not std::copyable<typename C::key_type> or
-                       requires(typename C::key_type const& key)
-                       {
-                           // Emplacement (key copy, mapped object default constructor)
-                           requires not std::default_initializable<typename C::mapped_type> or
-                                    requires
-                                    {
-                                        {
-                                        cont.emplace(key)
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.emplace(
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(key),
-                                            std::forward_as_tuple())
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.try_emplace(key)
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.try_emplace(hint, key)
-                                        } -> std::same_as<typename C::iterator>;
-                                    };
-
-                           // Mapped object copy
-                           requires not std::copyable<typename C::mapped_type> or
-                                    requires(typename C::mapped_type const& obj)
-                                    {
-                                        // Insertion
-                                        {
-                                        cont.insert_or_assign(key, obj)
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.insert_or_assign(hint, key, obj)
-                                        } -> std::same_as<typename C::iterator>;
-
-                                        // Emplacement (key copy, mapped object copy constructor)
-                                        {
-                                        cont.emplace(key, obj)
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.emplace(
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(key),
-                                            std::forward_as_tuple(obj))
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.try_emplace(key, obj)
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.try_emplace(hint, key, obj)
-                                        } -> std::same_as<typename C::iterator>;
-                                    };
-
-                           // Mapped object move
-                           requires not std::movable<typename C::mapped_type> or
-                                    requires(typename C::mapped_type&& obj)
-                                    {
-                                        // Insertion
-                                        {
-                                        cont.insert_or_assign(key, std::move(obj))
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.insert_or_assign(hint, key, std::move(obj))
-                                        } -> std::same_as<typename C::iterator>;
-
-                                        // Emplacement (key copy, mapped object move constructor)
-                                        {
-                                        cont.emplace(key, std::move(obj))
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.emplace(
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(key),
-                                            std::forward_as_tuple(std::move(obj)))
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.try_emplace(key, std::move(obj))
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.try_emplace(hint, key, std::move(obj))
-                                        } -> std::same_as<typename C::iterator>;
-                                    };
-                       };
-
-              // Key move
-              requires not std::movable<typename C::key_type> or
-                       requires(typename C::key_type&& key)
-                       {
-                           // Emplacement (key move, mapped object default constructor)
-                           requires not std::default_initializable<typename C::mapped_type> or
-                                    requires
-                                    {
-                                        {
-                                        cont.emplace(std::move(key))
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.emplace(
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(std::move(key)),
-                                            std::forward_as_tuple())
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.try_emplace(std::move(key))
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.try_emplace(hint, std::move(key))
-                                        } -> std::same_as<typename C::iterator>;
-                                    };
-
-                           // Mapped object copy
-                           requires not std::copyable<typename C::mapped_type> or
-                                    requires(typename C::mapped_type const& obj)
-                                    {
-                                        // Insertion
-                                        {
-                                        cont.insert_or_assign(std::move(key), obj)
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.insert_or_assign(hint, std::move(key), obj)
-                                        } -> std::same_as<typename C::iterator>;
-
-                                        // Emplacement (key move, mapped object copy constructor)
-                                        {
-                                        cont.emplace(std::move(key), obj)
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.emplace(
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(std::move(key)),
-                                            std::forward_as_tuple(obj))
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.try_emplace(std::move(key), obj)
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.try_emplace(hint, std::move(key), obj)
-                                        } -> std::same_as<typename C::iterator>;
-                                    };
-
-                           // Mapped object move
-                           requires not std::movable<typename C::mapped_type> or
-                                    requires(typename C::mapped_type&& obj)
-                                    {
-                                        // Insertion
-                                        {
-                                        cont.insert_or_assign(std::move(key), std::move(obj))
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.insert_or_assign(hint, std::move(key), std::move(obj))
-                                        } -> std::same_as<typename C::iterator>;
-
-                                        // Emplacement (key move, mapped object move constructor)
-                                        {
-                                        cont.emplace(std::move(key), std::move(obj))
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.emplace(
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(std::move(key)),
-                                            std::forward_as_tuple(std::move(obj)))
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.try_emplace(std::move(key), std::move(obj))
-                                        } -> std::same_as<std::pair<typename C::iterator, bool>>;
-                                        {
-                                        cont.try_emplace(hint, std::move(key), std::move(obj))
-                                        } -> std::same_as<typename C::iterator>;
-                                    };
-                       };
-          };
-      };
+      lite::unique_map_container<C> and
+      (detail::declares_container_category<C, container_category::unique_map_container> or
+       requires(C& cont, C const& const_cont)
+       {
+           // Element access
+           requires
+           requires(typename C::key_type const& key, typename C::key_type const& tmp_key)
+           {
+               // operator[] access
+               requires not std::default_initializable<typename C::mapped_type> or
+                        requires
+                        {
+                            // Key copy
+                            requires not std::copyable<typename C::key_type> or
+                                     requires {{ cont[key] } -> std::same_as<typename C::mapped_type&>; };
+
+                            // Key move
+                            requires not std::movable<typename C::key_type> or
+                                     requires
+                                     {{ cont[std::move(tmp_key)] } -> std::same_as<typename C::mapped_type&>; };
+                        };
+
+               // Checked access
+               { cont.at(key) } -> std::same_as<typename C::mapped_type&>;
+               { const_cont.at(key) } -> std::same_as<typename C::mapped_type const&>;
+           };
+
+           requires
+           requires(typename C::const_iterator const& hint)
+           {
+               // Key copy
+               requires not std::copyable<typename C::key_type> or
+                        requires(typename C::key_type const& key)
+                        {
+                            // Emplacement (key copy, mapped object default constructor)
+                            requires not std::default_initializable<typename C::mapped_type> or
+                                     requires
+                                     {
+                                         {
+                                         cont.emplace(key)
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.emplace(
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(key),
+                                             std::forward_as_tuple())
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.try_emplace(key)
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.try_emplace(hint, key)
+                                         } -> std::same_as<typename C::iterator>;
+                                     };
+
+                            // Mapped object copy
+                            requires not std::copyable<typename C::mapped_type> or
+                                     requires(typename C::mapped_type const& obj)
+                                     {
+                                         // Insertion
+                                         {
+                                         cont.insert_or_assign(key, obj)
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.insert_or_assign(hint, key, obj)
+                                         } -> std::same_as<typename C::iterator>;
+
+                                         // Emplacement (key copy, mapped object copy constructor)
+                                         {
+                                         cont.emplace(key, obj)
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.emplace(
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(key),
+                                             std::forward_as_tuple(obj))
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.try_emplace(key, obj)
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.try_emplace(hint, key, obj)
+                                         } -> std::same_as<typename C::iterator>;
+                                     };
+
+                            // Mapped object move
+                            requires not std::movable<typename C::mapped_type> or
+                                     requires(typename C::mapped_type&& obj)
+                                     {
+                                         // Insertion
+                                         {
+                                         cont.insert_or_assign(key, std::move(obj))
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.insert_or_assign(hint, key, std::move(obj))
+                                         } -> std::same_as<typename C::iterator>;
+
+                                         // Emplacement (key copy, mapped object move constructor)
+                                         {
+                                         cont.emplace(key, std::move(obj))
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.emplace(
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(key),
+                                             std::forward_as_tuple(std::move(obj)))
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.try_emplace(key, std::move(obj))
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.try_emplace(hint, key, std::move(obj))
+                                         } -> std::same_as<typename C::iterator>;
+                                     };
+                        };
+
+               // Key move
+               requires not std::movable<typename C::key_type> or
+                        requires(typename C::key_type&& key)
+                        {
+                            // Emplacement (key move, mapped object default constructor)
+                            requires not std::default_initializable<typename C::mapped_type> or
+                                     requires
+                                     {
+                                         {
+                                         cont.emplace(std::move(key))
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.emplace(
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(std::move(key)),
+                                             std::forward_as_tuple())
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.try_emplace(std::move(key))
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.try_emplace(hint, std::move(key))
+                                         } -> std::same_as<typename C::iterator>;
+                                     };
+
+                            // Mapped object copy
+                            requires not std::copyable<typename C::mapped_type> or
+                                     requires(typename C::mapped_type const& obj)
+                                     {
+                                         // Insertion
+                                         {
+                                         cont.insert_or_assign(std::move(key), obj)
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.insert_or_assign(hint, std::move(key), obj)
+                                         } -> std::same_as<typename C::iterator>;
+
+                                         // Emplacement (key move, mapped object copy constructor)
+                                         {
+                                         cont.emplace(std::move(key), obj)
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.emplace(
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(std::move(key)),
+                                             std::forward_as_tuple(obj))
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.try_emplace(std::move(key), obj)
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.try_emplace(hint, std::move(key), obj)
+                                         } -> std::same_as<typename C::iterator>;
+                                     };
+
+                            // Mapped object move
+                            requires not std::movable<typename C::mapped_type> or
+                                     requires(typename C::mapped_type&& obj)
+                                     {
+                                         // Insertion
+                                         {
+                                         cont.insert_or_assign(std::move(key), std::move(obj))
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.insert_or_assign(hint, std::move(key), std::move(obj))
+                                         } -> std::same_as<typename C::iterator>;
+
+                                         // Emplacement (key move, mapped object move constructor)
+                                         {
+                                         cont.emplace(std::move(key), std::move(obj))
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.emplace(
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(std::move(key)),
+                                             std::forward_as_tuple(std::move(obj)))
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.try_emplace(std::move(key), std::move(obj))
+                                         } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                                         {
+                                         cont.try_emplace(hint, std::move(key), std::move(obj))
+                                         } -> std::same_as<typename C::iterator>;
+                                     };
+                        };
+           };
+       } or
+       detail::reject_container_category<C, container_category::unique_map_container>());
 
     /// A map container with multiple key occurrence.
     /// Satisfied by multimap and unordered_multimap.
     template <typename C>
     concept multiple_map_container
     = map_container<C> and
-      requires(C& cont, C const& const_cont)
-      {
-          requires
-          requires(typename C::const_iterator const& hint)
-          {
-              requires not std::copyable<typename C::key_type> or
-                       requires(typename C::key_type const& key)
-                       {
-                           // Emplacement (key copy, mapped object default constructor)
-                           requires not std::default_initializable<typename C::mapped_type> or
-                                    requires
-                                    {
-                                        {
-                                        cont.emplace(key)
-                                        } -> std::same_as<typename C::iterator>;
-                                        {
-                                        cont.emplace(
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(key),
-                                            std::forward_as_tuple())
-                                        } -> std::same_as<typename C::iterator>;
-                                    };
-
-                           // Emplacement (key copy, mapped object copy constructor)
-                           requires not std::copyable<typename C::mapped_type> or
-                                    requires(typename C::mapped_type const& obj)
-                                    {
-                                        {
-                                        cont.emplace(key, obj)
-                                        } -> std::same_as<typename C::iterator>;
-                                        {
-                                        cont.emplace(
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(key),
-                                            std::forward_as_tuple(obj))
-                                        } -> std::same_as<typename C::iterator>;
-                                    };
-
-                           // Emplacement (key copy, mapped object move constructor)
-                           requires not std::movable<typename C::mapped_type> or
-                                    requires(typename C::mapped_type&& obj)
-                                    {
-                                        {
-                                        cont.emplace(key, std::move(obj))
-                                        } -> std::same_as<typename C::iterator>;
-                                        {
-                                        cont.emplace(
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(key),
-                                            std::forward_as_tuple(std::move(obj)))
-                                        } -> std::same_as<typename C::iterator>;
-                                    };
-                       };
-
-              requires not std::movable<typename C::key_type> or
-                       requires(typename C::key_type&& key)
-                       {
-                           // Emplacement (key move, mapped object default constructor)
-                           requires not std::default_initializable<typename C::mapped_type> or
-                                    requires
-                                    {
-                                        {
-                                        cont.emplace(std::move(key))
-                                        } -> std::same_as<typename C::iterator>;
-                                        {
-                                        cont.emplace(
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(std::move(key)),
-                                            std::forward_as_tuple())
-                                        } -> std::same_as<typename C::iterator>;
-                                    };
-
-                           // Emplacement (key copy, mapped object copy constructor)
-                           requires not std::copyable<typename C::mapped_type> or
-                                    requires(typename C::mapped_type const& obj)
-                                    {
-                                        {
-                                        cont.emplace(std::move(key), obj)
-                                        } -> std::same_as<typename C::iterator>;
-                                        {
-                                        cont.emplace(
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(std::move(key)),
-                                            std::forward_as_tuple(obj))
-                                        } -> std::same_as<typename C::iterator>;
-                                    };
-
-                           // Emplacement (key copy, mapped object move constructor)
-                           requires not std::movable<typename C::mapped_type> or
-                                    requires(typename C::mapped_type&& obj)
-                                    {
-                                        {
-                                        cont.emplace(std::move(key), std::move(obj))
-                                        } -> std::same_as<typename C::iterator>;
-                                        {
-                                        cont.emplace(
-                                            std::piecewise_construct,
-                                            std::forward_as_tuple(std::move(key)),
-                                            std::forward_as_tuple(std::move(obj)))
-                                        } -> std::same_as<typename C::iterator>;
-                                    };
-                       };
-          };
-      };
+      (detail::declares_container_category<C, container_category::multiple_map_container> or
+       requires(C& cont, C const& const_cont)
+       {
+           requires
+           requires(typename C::const_iterator const& hint)
+           {
+               requires not std::copyable<typename C::key_type> or
+                        requires(typename C::key_type const& key)
+                        {
+                            // Emplacement (key copy, mapped object default constructor)
+                            requires not std::default_initializable<typename C::mapped_type> or
+                                     requires
+                                     {
+                                         {
+                                         cont.emplace(key)
+                                         } -> std::same_as<typename C::iterator>;
+                                         {
+                                         cont.emplace(
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(key),
+                                             std::forward_as_tuple())
+                                         } -> std::same_as<typename C::iterator>;
+                                     };
+
+                            // Emplacement (key copy, mapped object copy constructor)
+                            requires not std::copyable<typename C::mapped_type> or
+                                     requires(typename C::mapped_type const& obj)
+                                     {
+                                         {
+                                         cont.emplace(key, obj)
+                                         } -> std::same_as<typename C::iterator>;
+                                         {
+                                         cont.emplace(
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(key),
+                                             std::forward_as_tuple(obj))
+                                         } -> std::same_as<typename C::iterator>;
+                                     };
+
+                            // Emplacement (key copy, mapped object move constructor)
+                            requires not std::movable<typename C::mapped_type> or
+                                     requires(typename C::mapped_type&& obj)
+                                     {
+                                         {
+                                         cont.emplace(key, std::move(obj))
+                                         } -> std::same_as<typename C::iterator>;
+                                         {
+                                         cont.emplace(
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(key),
+                                             std::forward_as_tuple(std::move(obj)))
+                                         } -> std::same_as<typename C::iterator>;
+                                     };
+                        };
+
+               requires not std::movable<typename C::key_type> or
+                        requires(typename C::key_type&& key)
+                        {
+                            // Emplacement (key move, mapped object default constructor)
+                            requires not std::default_initializable<typename C::mapped_type> or
+                                     requires
+                                     {
+                                         {
+                                         cont.emplace(std::move(key))
+                                         } -> std::same_as<typename C::iterator>;
+                                         {
+                                         cont.emplace(
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(std::move(key)),
+                                             std::forward_as_tuple())
+                                         } -> std::same_as<typename C::iterator>;
+                                     };
+
+                            // Emplacement (key copy, mapped object copy constructor)
+                            requires not std::copyable<typename C::mapped_type> or
+                                     requires(typename C::mapped_type const& obj)
+                                     {
+                                         {
+                                         cont.emplace(std::move(key), obj)
+                                         } -> std::same_as<typename C::iterator>;
+                                         {
+                                         cont.emplace(
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(std::move(key)),
+                                             std::forward_as_tuple(obj))
+                                         } -> std::same_as<typename C::iterator>;
+                                     };
+
+                            // Emplacement (key copy, mapped object move constructor)
+                            requires not std::movable<typename C::mapped_type> or
+                                     requires(typename C::mapped_type&& obj)
+                                     {
+                                         {
+                                         cont.emplace(std::move(key), std::move(obj))
+                                         } -> std::same_as<typename C::iterator>;
+                                         {
+                                         cont.emplace(
+                                             std::piecewise_construct,
+                                             std::forward_as_tuple(std::move(key)),
+                                             std::forward_as_tuple(std::move(obj)))
+                                         } -> std::same_as<typename C::iterator>;
+                                     };
+                        };
+           };
+       } or
+       detail::reject_container_category<C, container_category::multiple_map_container>());
 
     /// An ordered map container.
     /// Satisfied by map and multimap.
@@ -802,12 +837,77 @@ namespace more_concepts
     concept unordered_multiple_map_container
     = multiple_map_container<C> and unordered_map_container<C>;
 
+    /// An associative container whose elements are stored in separately allocated nodes,
+    /// that can be extracted into a node handle (node_type) and inserted into another container
+    /// with the same node_type, without copying, moving or reallocating the element.
+    /// Satisfied by all standard associative containers.
+    template <typename C>
+    concept node_extractable_container
+    = associative_container<C> and
+      (detail::declares_container_category<C, container_category::node_extractable_container> or
+       requires(
+           C& cont,
+           C& other,
+           typename C::key_type const& key,
+           typename C::const_iterator const& pos,
+           typename C::node_type&& node,
+           typename C::node_type const& const_node)
+       {
+           typename C::node_type;
+           requires std::movable<typename C::node_type>;
+           requires std::default_initializable<typename C::node_type>;
+           { const_node.empty() } -> std::same_as<bool>;
+
+           // Extraction
+           { cont.extract(key) } -> std::same_as<typename C::node_type>;
+           { cont.extract(pos) } -> std::same_as<typename C::node_type>;
+
+           // Insertion (the return type depends on whether the keys are unique)
+           cont.insert(std::move(node));
+           { cont.insert(pos, std::move(node)) } -> std::same_as<typename C::iterator>;
+
+           // Transfer of all nodes with keys not present in cont
+           cont.merge(other);
+       } or
+       detail::reject_container_category<C, container_category::node_extractable_container>());
+
+    /// An associative container whose lookup functions accept keys of type K, comparing them with
+    /// the stored keys without converting them to key_type, as its comparator (or both its hasher
+    /// and key equality predicate) are transparent.
+    /// Satisfied by e.g. map<string, T, less<>> with K = string_view.
+    template <typename C, typename K>
+    concept transparent_lookup_container
+    = associative_container<C> and
+      (requires { requires transparent_function<typename C::key_compare>; } or
+       requires
+       {
+           requires transparent_function<typename C::hasher>;
+           requires transparent_function<typename C::key_equal>;
+       }) and
+      requires(C& cont, C const& const_cont, K const& key)
+      {
+          { const_cont.count(key) } -> std::same_as<typename C::size_type>;
+          { const_cont.contains(key) } -> std::same_as<bool>;
+          { cont.find(key) } -> std::same_as<typename C::iterator>;
+          { const_cont.find(key) } -> std::same_as<typename C::const_iterator>;
+          {
+          cont.equal_range(key)
+          } -> std::same_as<std::pair<typename C::iterator, typename C::iterator>>;
+          {
+          const_cont.equal_range(key)
+          } -> std::same_as<std::pair<typename C::const_iterator, typename C::const_iterator>>;
+      };
+
     template <typename C, typename ValueType, typename KeyType = ValueType>
     concept associative_container_of
     = container_of<C, ValueType> and
       associative_container<C> and
       std::same_as<KeyType, typename C::key_type>;
 
+    template <typename C, typename ValueType, typename KeyType = ValueType>
+    concept node_extractable_container_of
+    = associative_container_of<C, ValueType, KeyType> and node_extractable_container<C>;
+
     template <typename C, typename ValueType, typename KeyType = ValueType>
     concept unique_associative_container_of
     = associative_container_of<C, ValueType, KeyType> and unique_associative_container<C>;
@@ -27,6 +27,22 @@ namespace more_concepts
     template <typename T>
     concept trivial = std::is_trivial_v<T>;
 
+    /// Opt-in trait for trivially_relocatable. Specialize as true for types that can be
+    /// relocated by copying their bytes, even though they are not trivially copyable,
+    /// e.g. types that own a heap allocated object through a pointer.
+    template <typename T>
+    inline constexpr bool enable_trivially_relocatable = std::is_trivially_copyable_v<T>;
+
+    /// Types for which moving an object to a new location and destroying the original
+    /// is equivalent to calling memcpy (and not running the destructor on the original).
+    ///
+    /// Satisfied by all trivially copyable types, and by types that opt in
+    /// with enable_trivially_relocatable.
+    template <typename T>
+    concept trivially_relocatable
+    = std::is_object_v<T> and
+      enable_trivially_relocatable<std::remove_cv_t<T>>;
+
     /// Type is a scoped or unscoped enumeration (enum / enum class).
     template <typename T>
     concept enum_type = std::is_enum_v<T>;
@@ -76,4 +92,18 @@ namespace more_concepts
           Fn const,
           auto(KeyType&) -> std::size_t,
           auto(KeyType const&) -> std::size_t>;
+
+    /// Hash functions that declare, with an is_avalanching member type, that each bit of their
+    /// result depends on every bit of the input (as with good general purpose hashes, but not
+    /// the identity std::hash<int> of common implementations). Hash tables can then use any
+    /// of the bits directly, without mixing them first; see mixed_hash.
+    template <typename Fn, typename KeyType>
+    concept avalanching_hash_function = hash_function<Fn, KeyType> and requires { typename Fn::is_avalanching; };
+
+    /// Function objects that declare, with an is_transparent member type, that they accept
+    /// arguments of any type comparable with (or hashable like) the keys of a container,
+    /// e.g. std::less<> or std::equal_to<>. Associative containers using them provide
+    /// heterogeneous lookup.
+    template <typename Fn>
+    concept transparent_function = requires { typename Fn::is_transparent; };
 }
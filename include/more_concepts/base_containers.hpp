@@ -3,9 +3,13 @@
 #include <concepts>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "more_concepts/base_concepts.hpp"
+#include "more_concepts/container_category.hpp"
+#include "more_concepts/lite_containers.hpp"
 
 namespace more_concepts
 {
@@ -16,129 +20,190 @@ namespace more_concepts
     /// Satisfied by all well-behaved standard containers.
     /// Is not satisfied by vector<bool>.
     template <typename C>
-    concept container =
-    requires(C& cont, C const& const_cont)
-    {
-        typename C::value_type;
-        requires decayed<typename C::value_type>;
-
-        typename C::reference;
-        typename C::const_reference;
-        // Well-behaved containers should not rely on proxies for iterators / references.
-        requires std::same_as<typename C::reference, typename C::value_type&>;
-        requires std::same_as<typename C::const_reference, typename C::value_type const&>;
-
-        typename C::iterator;
-        typename C::const_iterator;
-        requires std::forward_iterator<typename C::iterator>;
-        requires std::forward_iterator<typename C::const_iterator>;
-        requires std::convertible_to<typename C::iterator, typename C::const_iterator>;
-        requires std::same_as<std::iter_value_t<typename C::iterator>, typename C::value_type>;
-        requires std::same_as<std::iter_value_t<typename C::const_iterator>, typename C::value_type>;
-        requires std::same_as<std::iter_reference_t<typename C::iterator>, typename C::reference> or
-                 std::same_as<std::iter_reference_t<typename C::iterator>, typename C::const_reference>;
-        requires std::same_as<std::iter_reference_t<typename C::const_iterator>, typename C::const_reference>;
-
-        typename C::difference_type;
-        typename C::size_type;
-        requires std::signed_integral<typename C::difference_type>;
-        requires std::unsigned_integral<typename C::size_type>;
-        // size_type should be able to represent all positive values of difference_type.
-        requires std::in_range<typename C::size_type>(
-            std::numeric_limits<typename C::difference_type>::max());
-        // difference_type should be the same as the one defined by iterator_traits.
-        requires std::same_as<
-            typename C::difference_type,
-            typename std::iterator_traits<typename C::iterator>::difference_type>;
-        requires std::same_as<
-            typename C::difference_type,
-            typename std::iterator_traits<typename C::const_iterator>::difference_type>;
-
-        // Containers of equality comparable values should be equality comparable
-        requires not std::equality_comparable<typename C::value_type> or
-                 std::equality_comparable<C>;
-
-        // Containers should satisfy at least the strongest object concept satisfied by value_type.
-        requires not std::movable<typename C::value_type> or
-                 std::movable<C>;
-        requires not std::copyable<typename C::value_type> or
-                 std::copyable<C>;
-        requires not std::semiregular<typename C::value_type> or
-                 std::semiregular<C>;
-        requires not std::regular<typename C::value_type> or
-                 std::regular<C>;
-
-        // Iterators
-        { cont.begin() } -> std::same_as<typename C::iterator>;
-        { cont.end() } -> std::same_as<typename C::iterator>;
-        { const_cont.begin() } -> std::same_as<typename C::const_iterator>;
-        { const_cont.end() } -> std::same_as<typename C::const_iterator>;
-        { cont.cbegin() } -> std::same_as<typename C::const_iterator>;
-        { cont.cend() } -> std::same_as<typename C::const_iterator>;
-
-        // Capacity
-        { const_cont.max_size() } -> std::same_as<typename C::size_type>;
-        { const_cont.empty() } -> std::convertible_to<bool>;
-    };
+    concept container
+    = lite::container<C> and
+      (detail::declares_container_category<C, container_category::container> or
+       requires(C& cont, C const& const_cont)
+       {
+           typename C::value_type;
+           requires decayed<typename C::value_type>;
+
+           typename C::reference;
+           typename C::const_reference;
+           // Well-behaved containers should not rely on proxies for iterators / references.
+           requires std::same_as<typename C::reference, typename C::value_type&>;
+           requires std::same_as<typename C::const_reference, typename C::value_type const&>;
+
+           typename C::iterator;
+           typename C::const_iterator;
+           requires std::forward_iterator<typename C::iterator>;
+           requires std::forward_iterator<typename C::const_iterator>;
+           requires std::convertible_to<typename C::iterator, typename C::const_iterator>;
+           requires std::same_as<std::iter_value_t<typename C::iterator>, typename C::value_type>;
+           requires std::same_as<std::iter_value_t<typename C::const_iterator>, typename C::value_type>;
+           requires std::same_as<std::iter_reference_t<typename C::iterator>, typename C::reference> or
+                    std::same_as<std::iter_reference_t<typename C::iterator>, typename C::const_reference>;
+           requires std::same_as<std::iter_reference_t<typename C::const_iterator>, typename C::const_reference>;
+
+           typename C::difference_type;
+           typename C::size_type;
+           requires std::signed_integral<typename C::difference_type>;
+           requires std::unsigned_integral<typename C::size_type>;
+           // size_type should be able to represent all positive values of difference_type.
+           requires std::in_range<typename C::size_type>(
+               std::numeric_limits<typename C::difference_type>::max());
+           // difference_type should be the same as the one defined by iterator_traits.
+           requires std::same_as<
+               typename C::difference_type,
+               typename std::iterator_traits<typename C::iterator>::difference_type>;
+           requires std::same_as<
+               typename C::difference_type,
+               typename std::iterator_traits<typename C::const_iterator>::difference_type>;
+
+           // Containers of equality comparable values should be equality comparable
+           requires not std::equality_comparable<typename C::value_type> or
+                    std::equality_comparable<C>;
+
+           // Containers should satisfy at least the strongest object concept satisfied by value_type.
+           requires not std::movable<typename C::value_type> or
+                    std::movable<C>;
+           requires not std::copyable<typename C::value_type> or
+                    std::copyable<C>;
+           requires not std::semiregular<typename C::value_type> or
+                    std::semiregular<C>;
+           requires not std::regular<typename C::value_type> or
+                    std::regular<C>;
+
+           // Iterators
+           { cont.begin() } -> std::same_as<typename C::iterator>;
+           { cont.end() } -> std::same_as<typename C::iterator>;
+           { const_cont.begin() } -> std::same_as<typename C::const_iterator>;
+           { const_cont.end() } -> std::same_as<typename C::const_iterator>;
+           { cont.cbegin() } -> std::same_as<typename C::const_iterator>;
+           { cont.cend() } -> std::same_as<typename C::const_iterator>;
+
+           // Capacity
+           { const_cont.max_size() } -> std::same_as<typename C::size_type>;
+           { const_cont.empty() } -> std::convertible_to<bool>;
+       } or
+       detail::reject_container_category<C, container_category::container>());
 
     /// A container that allows mutable access to its elements.
     /// Satisfied by all standard containers except set.
     template <typename C>
     concept mutable_container
     = container<C> and
-      std::same_as<std::iter_reference_t<typename C::iterator>, typename C::reference>;
+      (detail::declares_container_category<C, container_category::mutable_container> or
+       std::same_as<std::iter_reference_t<typename C::iterator>, typename C::reference> or
+       detail::reject_container_category<C, container_category::mutable_container>());
 
     /// A container that knows its size.
     /// Satisfied by all standard containers except forward_list.
     template <typename C>
-    concept sized_container
-    = container<C> and
-      requires(C const& const_cont)
-      {
-          { const_cont.size() } -> std::same_as<typename C::size_type>;
-      };
+    concept sized_container = container<C> and lite::sized_container<C>;
 
     /// A container that can be cleared.
     /// Satisfied by all standard containers except array.
     template <typename C>
     concept clearable_container
     = container<C> and
-      requires(C& cont)
-      {
-          cont.clear();
-      };
+      (detail::declares_container_category<C, container_category::clearable_container> or
+       requires(C& cont)
+       {
+           cont.clear();
+       } or
+       detail::reject_container_category<C, container_category::clearable_container>());
 
     /// A container that allows reverse iteration.
     /// Satisfied by all standard containers except forward_list.
     template <typename C>
     concept reversible_container
     = container<C> and
-      requires(C& cont, C const& const_cont)
-      {
-          requires std::bidirectional_iterator<typename C::iterator>;
-          requires std::bidirectional_iterator<typename C::const_iterator>;
-
-          typename C::reverse_iterator;
-          typename C::const_reverse_iterator;
-          requires std::bidirectional_iterator<typename C::reverse_iterator>;
-          requires std::bidirectional_iterator<typename C::const_reverse_iterator>;
-          requires std::convertible_to<
-              typename C::reverse_iterator,
-              typename C::const_reverse_iterator>;
-          requires std::same_as<
-              typename C::difference_type,
-              typename std::iterator_traits<typename C::reverse_iterator>::difference_type>;
-          requires std::same_as<
-              typename C::difference_type,
-              typename std::iterator_traits<typename C::const_reverse_iterator>::difference_type>;
-
-          { cont.rbegin() } -> std::same_as<typename C::reverse_iterator>;
-          { cont.rend() } -> std::same_as<typename C::reverse_iterator>;
-          { const_cont.rbegin() } -> std::same_as<typename C::const_reverse_iterator>;
-          { const_cont.rend() } -> std::same_as<typename C::const_reverse_iterator>;
-          { cont.crbegin() } -> std::same_as<typename C::const_reverse_iterator>;
-          { cont.crend() } -> std::same_as<typename C::const_reverse_iterator>;
-      };
+      (detail::declares_container_category<C, container_category::reversible_container> or
+       requires(C& cont, C const& const_cont)
+       {
+           requires std::bidirectional_iterator<typename C::iterator>;
+           requires std::bidirectional_iterator<typename C::const_iterator>;
+
+           typename C::reverse_iterator;
+           typename C::const_reverse_iterator;
+           requires std::bidirectional_iterator<typename C::reverse_iterator>;
+           requires std::bidirectional_iterator<typename C::const_reverse_iterator>;
+           requires std::convertible_to<
+               typename C::reverse_iterator,
+               typename C::const_reverse_iterator>;
+           requires std::same_as<
+               typename C::difference_type,
+               typename std::iterator_traits<typename C::reverse_iterator>::difference_type>;
+           requires std::same_as<
+               typename C::difference_type,
+               typename std::iterator_traits<typename C::const_reverse_iterator>::difference_type>;
+
+           { cont.rbegin() } -> std::same_as<typename C::reverse_iterator>;
+           { cont.rend() } -> std::same_as<typename C::reverse_iterator>;
+           { const_cont.rbegin() } -> std::same_as<typename C::const_reverse_iterator>;
+           { const_cont.rend() } -> std::same_as<typename C::const_reverse_iterator>;
+           { cont.crbegin() } -> std::same_as<typename C::const_reverse_iterator>;
+           { cont.crend() } -> std::same_as<typename C::const_reverse_iterator>;
+       } or
+       detail::reject_container_category<C, container_category::reversible_container>());
+
+    /// A container that obtains its memory from an allocator: it exposes the allocator,
+    /// and can be constructed with a given allocator, empty or as a copy or move of another container.
+    /// Satisfied by all standard containers except array.
+    template <typename C>
+    concept allocator_aware_container
+    = container<C> and
+      (detail::declares_container_category<C, container_category::allocator_aware_container> or
+       requires(C const& const_cont)
+       {
+           typename C::allocator_type;
+           requires std::same_as<
+               typename std::allocator_traits<typename C::allocator_type>::value_type,
+               typename C::value_type>;
+
+           { const_cont.get_allocator() } -> std::same_as<typename C::allocator_type>;
+
+           requires std::constructible_from<C, typename C::allocator_type const&>;
+           requires std::constructible_from<C, C const&, typename C::allocator_type const&>;
+           requires std::constructible_from<C, C&&, typename C::allocator_type const&>;
+       } or
+       detail::reject_container_category<C, container_category::allocator_aware_container>());
+
+    namespace detail
+    {
+        /// The compile-time constant max_size() of C: either C::max_size(), if it is a static constexpr
+        /// member function, or the tuple size of C (which standard library arrays provide).
+        template <typename C>
+        struct static_max_size
+        {
+        };
+
+        template <typename C>
+        requires requires { typename std::integral_constant<typename C::size_type, C::max_size()>; }
+        struct static_max_size<C> : std::integral_constant<typename C::size_type, C::max_size()>
+        {
+        };
+
+        template <typename C>
+        requires (not requires { typename std::integral_constant<typename C::size_type, C::max_size()>; }) and
+                 requires { typename std::integral_constant<typename C::size_type, std::tuple_size<C>::value>; }
+        struct static_max_size<C> : std::integral_constant<typename C::size_type, std::tuple_size<C>::value>
+        {
+        };
+    }
+
+    /// A sized container whose max_size() is a compile-time constant, which means it never allocates
+    /// memory for its elements, storing them inside the container object instead.
+    /// Satisfied by array and inplace_vector.
+    template <typename C>
+    concept fixed_capacity_container
+    = sized_container<C> and
+      requires { detail::static_max_size<C>::value; };
+
+    /// The compile-time max_size() of a fixed capacity container.
+    template <fixed_capacity_container C>
+    inline constexpr typename C::size_type fixed_capacity_v = detail::static_max_size<C>::value;
 
     /// A container of a specific value type.
     template <typename C, typename ValueType>
@@ -155,4 +220,10 @@ namespace more_concepts
 
     template <typename C, typename ValueType>
     concept reversible_container_of = container_of<C, ValueType> and reversible_container<C>;
+
+    template <typename C, typename ValueType>
+    concept allocator_aware_container_of = container_of<C, ValueType> and allocator_aware_container<C>;
+
+    template <typename C, typename ValueType>
+    concept fixed_capacity_container_of = container_of<C, ValueType> and fixed_capacity_container<C>;
 }
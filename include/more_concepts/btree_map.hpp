@@ -0,0 +1,239 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/detail/btree.hpp"
+#include "more_concepts/detail/key_of_value.hpp"
+
+namespace more_concepts
+{
+    /// An ordered unique map stored in a B-tree: each node holds as many elements as fit
+    /// in NodeSize bytes (by default four cache lines), and the tree is searched node by node.
+    /// Models ordered_unique_map_container.
+    ///
+    /// Compared to map, there are far fewer nodes to chase and allocate, and the elements of a node
+    /// are contiguous, so lookup and iteration are faster and memory use is lower. Unlike flat_map,
+    /// insertion and erasure take logarithmic time, so it suits tables that keep changing.
+    ///
+    /// Unlike map, the value type is pair<Key, T> (not pair<Key const, T>), as the elements
+    /// are relocated between nodes; they must be nothrow relocatable. The keys must not be modified
+    /// through iterators. Insertion and erasure invalidate all iterators and references.
+    template <
+        typename Key,
+        typename T,
+        typename Compare = std::less<Key>,
+        typename Allocator = std::allocator<std::pair<Key, T>>,
+        std::size_t NodeSize = detail::default_btree_node_size>
+    class btree_map
+        : public detail::btree<Key, std::pair<Key, T>, detail::pair_first, Compare, Allocator, NodeSize, false, true>
+    {
+        using base = detail::btree<Key, std::pair<Key, T>, detail::pair_first, Compare, Allocator, NodeSize, false, true>;
+
+    public:
+        using mapped_type = T;
+        using typename base::key_type;
+        using typename base::value_type;
+        using typename base::key_compare;
+        using typename base::iterator;
+        using typename base::const_iterator;
+
+        class value_compare
+        {
+        public:
+            auto operator()(value_type const& lhs, value_type const& rhs) const -> bool
+            {
+                return comp(lhs.first, rhs.first);
+            }
+
+        protected:
+            friend class btree_map;
+
+            explicit value_compare(key_compare const& comp)
+                : comp{comp}
+            {
+            }
+
+            key_compare comp;
+        };
+
+        using base::base;
+
+        auto operator=(std::initializer_list<value_type> const init_list) -> btree_map&
+        {
+            *this = btree_map(init_list, this->key_comp(), this->get_allocator());
+            return *this;
+        }
+
+        [[nodiscard]] auto value_comp() const -> value_compare { return value_compare{this->key_comp()}; }
+
+        // Element access
+
+        [[nodiscard]] auto at(key_type const& key) -> mapped_type&
+        {
+            return const_cast<mapped_type&>(std::as_const(*this).at(key));
+        }
+
+        [[nodiscard]] auto at(key_type const& key) const -> mapped_type const&
+        {
+            auto const pos = this->find(key);
+            if (pos == this->end())
+            {
+                throw std::out_of_range{"more_concepts::btree_map::at: key not found"};
+            }
+            return pos->second;
+        }
+
+        auto operator[](key_type const& key) -> mapped_type&
+        {
+            return try_emplace(key).first->second;
+        }
+
+        auto operator[](key_type&& key) -> mapped_type&
+        {
+            return try_emplace(std::move(key)).first->second;
+        }
+
+        // Modifiers
+
+        template <typename... Args>
+        auto try_emplace(key_type const& key, Args&& ... args) -> std::pair<iterator, bool>
+        {
+            return try_emplace_at(this->unique_position(key), key, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        auto try_emplace(key_type&& key, Args&& ... args) -> std::pair<iterator, bool>
+        {
+            return try_emplace_at(this->unique_position(key), std::move(key), std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        auto try_emplace(const_iterator const hint, key_type const& key, Args&& ... args) -> iterator
+        {
+            return try_emplace_at(this->hinted_position(hint, key), key, std::forward<Args>(args)...).first;
+        }
+
+        template <typename... Args>
+        auto try_emplace(const_iterator const hint, key_type&& key, Args&& ... args) -> iterator
+        {
+            return try_emplace_at(this->hinted_position(hint, key), std::move(key), std::forward<Args>(args)...)
+                .first;
+        }
+
+        template <typename M>
+        requires std::is_assignable_v<mapped_type&, M&&>
+        auto insert_or_assign(key_type const& key, M&& obj) -> std::pair<iterator, bool>
+        {
+            return insert_or_assign_at(this->unique_position(key), key, std::forward<M>(obj));
+        }
+
+        template <typename M>
+        requires std::is_assignable_v<mapped_type&, M&&>
+        auto insert_or_assign(key_type&& key, M&& obj) -> std::pair<iterator, bool>
+        {
+            return insert_or_assign_at(this->unique_position(key), std::move(key), std::forward<M>(obj));
+        }
+
+        template <typename M>
+        requires std::is_assignable_v<mapped_type&, M&&>
+        auto insert_or_assign(const_iterator const hint, key_type const& key, M&& obj) -> iterator
+        {
+            return insert_or_assign_at(this->hinted_position(hint, key), key, std::forward<M>(obj)).first;
+        }
+
+        template <typename M>
+        requires std::is_assignable_v<mapped_type&, M&&>
+        auto insert_or_assign(const_iterator const hint, key_type&& key, M&& obj) -> iterator
+        {
+            return insert_or_assign_at(this->hinted_position(hint, key), std::move(key), std::forward<M>(obj)).first;
+        }
+
+    private:
+        using typename base::position;
+
+        template <typename K, typename... Args>
+        auto try_emplace_at(position const pos, K&& key, Args&& ... args) -> std::pair<iterator, bool>
+        {
+            if (pos.found)
+            {
+                return {this->to_iterator(pos), false};
+            }
+
+            auto const inserted = this->emplace_at(
+                pos,
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+            return {inserted, true};
+        }
+
+        template <typename K, typename M>
+        auto insert_or_assign_at(position const pos, K&& key, M&& obj) -> std::pair<iterator, bool>
+        {
+            if (pos.found)
+            {
+                auto const existing = this->to_iterator(pos);
+                existing->second = std::forward<M>(obj);
+                return {existing, false};
+            }
+
+            return {this->emplace_at(pos, std::forward<K>(key), std::forward<M>(obj)), true};
+        }
+    };
+
+    /// An ordered map with multiple equivalent keys stored in a B-tree, like btree_map.
+    /// Models ordered_multiple_map_container. Elements with equivalent keys are kept
+    /// in insertion order.
+    template <
+        typename Key,
+        typename T,
+        typename Compare = std::less<Key>,
+        typename Allocator = std::allocator<std::pair<Key, T>>,
+        std::size_t NodeSize = detail::default_btree_node_size>
+    class btree_multimap
+        : public detail::btree<Key, std::pair<Key, T>, detail::pair_first, Compare, Allocator, NodeSize, true, true>
+    {
+        using base = detail::btree<Key, std::pair<Key, T>, detail::pair_first, Compare, Allocator, NodeSize, true, true>;
+
+    public:
+        using mapped_type = T;
+        using typename base::value_type;
+        using typename base::key_compare;
+
+        class value_compare
+        {
+        public:
+            auto operator()(value_type const& lhs, value_type const& rhs) const -> bool
+            {
+                return comp(lhs.first, rhs.first);
+            }
+
+        protected:
+            friend class btree_multimap;
+
+            explicit value_compare(key_compare const& comp)
+                : comp{comp}
+            {
+            }
+
+            key_compare comp;
+        };
+
+        using base::base;
+
+        auto operator=(std::initializer_list<value_type> const init_list) -> btree_multimap&
+        {
+            *this = btree_multimap(init_list, this->key_comp(), this->get_allocator());
+            return *this;
+        }
+
+        [[nodiscard]] auto value_comp() const -> value_compare { return value_compare{this->key_comp()}; }
+    };
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+
+#include "more_concepts/detail/btree.hpp"
+#include "more_concepts/detail/key_of_value.hpp"
+
+namespace more_concepts
+{
+    /// An ordered unique set stored in a B-tree. Models ordered_unique_associative_container.
+    ///
+    /// See btree_map for the trade-offs compared to the node-based set and flat_set.
+    /// Insertion and erasure invalidate all iterators and references.
+    template <
+        typename Key,
+        typename Compare = std::less<Key>,
+        typename Allocator = std::allocator<Key>,
+        std::size_t NodeSize = detail::default_btree_node_size>
+    class btree_set
+        : public detail::btree<Key, Key, detail::identity_key, Compare, Allocator, NodeSize, false, false>
+    {
+        using base = detail::btree<Key, Key, detail::identity_key, Compare, Allocator, NodeSize, false, false>;
+
+    public:
+        using typename base::value_type;
+        using value_compare = Compare;
+
+        using base::base;
+
+        auto operator=(std::initializer_list<value_type> const init_list) -> btree_set&
+        {
+            *this = btree_set(init_list, this->key_comp(), this->get_allocator());
+            return *this;
+        }
+
+        [[nodiscard]] auto value_comp() const -> value_compare { return this->key_comp(); }
+    };
+
+    /// An ordered set with multiple equivalent keys stored in a B-tree, like btree_set.
+    /// Models ordered_multiple_associative_container.
+    template <
+        typename Key,
+        typename Compare = std::less<Key>,
+        typename Allocator = std::allocator<Key>,
+        std::size_t NodeSize = detail::default_btree_node_size>
+    class btree_multiset
+        : public detail::btree<Key, Key, detail::identity_key, Compare, Allocator, NodeSize, true, false>
+    {
+        using base = detail::btree<Key, Key, detail::identity_key, Compare, Allocator, NodeSize, true, false>;
+
+    public:
+        using typename base::value_type;
+        using value_compare = Compare;
+
+        using base::base;
+
+        auto operator=(std::initializer_list<value_type> const init_list) -> btree_multiset&
+        {
+            *this = btree_multiset(init_list, this->key_comp(), this->get_allocator());
+            return *this;
+        }
+
+        [[nodiscard]] auto value_comp() const -> value_compare { return this->key_comp(); }
+    };
+}
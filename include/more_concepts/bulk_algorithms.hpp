@@ -0,0 +1,325 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/associative_containers.hpp"
+#include "more_concepts/base_concepts.hpp"
+#include "more_concepts/base_containers.hpp"
+#include "more_concepts/sequence_containers.hpp"
+
+namespace more_concepts
+{
+    namespace detail
+    {
+        /// Contiguous containers of the same trivial value type, whose elements can be copied
+        /// between each other with memcpy.
+        template <typename C1, typename C2>
+        concept bytewise_copyable_containers
+        = contiguous_container<C1> and
+          contiguous_container<C2> and
+          std::same_as<typename C1::value_type, typename C2::value_type> and
+          trivial<typename C1::value_type>;
+
+        /// Contiguous containers of the same scalar value type (integer, enum or pointer), that can be
+        /// compared for equality with memcmp. This excludes floating point types, whose equal values
+        /// can have different object representations, and class types, whose operator== may not
+        /// compare all of their bytes.
+        template <typename C1, typename C2>
+        concept bytewise_comparable_containers
+        = bytewise_copyable_containers<C1, C2> and
+          (std::is_arithmetic_v<typename C1::value_type> or
+           std::is_enum_v<typename C1::value_type> or
+           std::is_pointer_v<typename C1::value_type>) and
+          std::has_unique_object_representations_v<typename C1::value_type>;
+
+        /// Containers that grow by allocating more storage, instead of moving the elements
+        /// to a bigger buffer (see segmented_vector).
+        template <typename C>
+        concept segmented_container = requires { typename C::is_segmented; };
+
+        /// Makes room for count more elements in cont, with a single reserve call, if cont
+        /// accepts a size hint (reservable and unordered associative containers) and does not
+        /// have room already. The capacity at least doubles, so that repeatedly appending small
+        /// batches still reallocates (or rehashes) only a logarithmic number of times.
+        /// Segmented containers do not reallocate, so they are reserved exactly, without
+        /// allocating storage that may never be used.
+        template <typename C>
+        auto reserve_additional(C& cont, std::size_t const count) -> void
+        {
+            auto const required = static_cast<std::size_t>(cont.size()) + count;
+            if constexpr (reservable_container<C> and segmented_container<C>)
+            {
+                if (required > static_cast<std::size_t>(cont.capacity()))
+                {
+                    cont.reserve(static_cast<typename C::size_type>(required));
+                }
+            }
+            else if constexpr (reservable_container<C>)
+            {
+                auto const capacity = static_cast<std::size_t>(cont.capacity());
+                if (required > capacity)
+                {
+                    auto const max_size = static_cast<std::size_t>(cont.max_size());
+                    cont.reserve(static_cast<typename C::size_type>(
+                        std::max(required, std::min(2 * capacity, max_size))));
+                }
+            }
+            else if constexpr (unordered_associative_container<C>)
+            {
+                auto const capacity = static_cast<std::size_t>(
+                    static_cast<float>(cont.bucket_count()) * cont.max_load_factor());
+                if (required > capacity)
+                {
+                    cont.reserve(static_cast<typename C::size_type>(
+                        std::max(required, 2 * static_cast<std::size_t>(cont.size()))));
+                }
+            }
+        }
+
+        /// Ranges whose iterators can be passed as an iterator pair to the standard container
+        /// range operations.
+        template <typename R>
+        concept legacy_iterable_range
+        = std::ranges::input_range<R> and std::copyable<std::ranges::iterator_t<R>>;
+
+        template <legacy_iterable_range R>
+        auto legacy_begin(R& range)
+        {
+            if constexpr (std::ranges::common_range<R>)
+            {
+                return std::ranges::begin(range);
+            }
+            else
+            {
+                using iterator = std::common_iterator<std::ranges::iterator_t<R>, std::ranges::sentinel_t<R>>;
+                return iterator{std::ranges::begin(range)};
+            }
+        }
+
+        template <legacy_iterable_range R>
+        auto legacy_end(R& range)
+        {
+            if constexpr (std::ranges::common_range<R>)
+            {
+                return std::ranges::end(range);
+            }
+            else
+            {
+                using iterator = std::common_iterator<std::ranges::iterator_t<R>, std::ranges::sentinel_t<R>>;
+                return iterator{std::ranges::end(range)};
+            }
+        }
+
+        template <typename T>
+        auto is_zero_bytes(T const& value) -> bool
+        {
+            auto bytes = std::array<unsigned char, sizeof(T)>{};
+            std::memcpy(bytes.data(), &value, sizeof(T));
+            return std::ranges::all_of(bytes, [](unsigned char const byte) { return byte == 0; });
+        }
+    }
+
+    /// Copies all elements of src to the beginning of dest, which must have at least
+    /// as many elements as src. Returns an iterator past the last element written in dest.
+    ///
+    /// Contiguous containers of the same trivial value type are copied with a single memmove.
+    template <sequence_container Src, sequence_container Dst>
+    requires std::indirectly_copyable<typename Src::const_iterator, typename Dst::iterator>
+    constexpr auto bulk_copy(Src const& src, Dst& dest) -> typename Dst::iterator
+    {
+        if constexpr (detail::bytewise_copyable_containers<Src, Dst>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                auto const size = src.size();
+                if (size > 0)
+                {
+                    std::memmove(dest.data(), src.data(), size * sizeof(typename Src::value_type));
+                }
+                return dest.begin() + static_cast<typename Dst::difference_type>(size);
+            }
+        }
+
+        return std::copy(src.begin(), src.end(), dest.begin());
+    }
+
+    /// Assigns value to all elements of cont.
+    ///
+    /// Contiguous containers of a trivial value type are filled with memset,
+    /// if the value is a single byte, or all of its bytes are zero.
+    template <sequence_container C>
+    requires std::indirectly_writable<typename C::iterator, typename C::value_type const&>
+    constexpr auto bulk_fill(C& cont, typename C::value_type const& value) -> void
+    {
+        if constexpr (detail::bytewise_copyable_containers<C, C>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                auto const size = cont.size();
+                if (size == 0)
+                {
+                    return;
+                }
+
+                if constexpr (sizeof(typename C::value_type) == 1)
+                {
+                    auto byte = static_cast<unsigned char>(0);
+                    std::memcpy(&byte, &value, 1);
+                    std::memset(cont.data(), byte, size);
+                    return;
+                }
+                else
+                {
+                    if (detail::is_zero_bytes(value))
+                    {
+                        std::memset(cont.data(), 0, size * sizeof(typename C::value_type));
+                        return;
+                    }
+                }
+            }
+        }
+
+        std::fill(cont.begin(), cont.end(), value);
+    }
+
+    /// Checks whether lhs and rhs have the same number of elements, and all of their
+    /// elements compare equal.
+    ///
+    /// Contiguous containers of the same integer, enum or pointer value type are compared with memcmp.
+    template <sequence_container Lhs, sequence_container Rhs>
+    requires std::indirectly_comparable<
+        typename Lhs::const_iterator,
+        typename Rhs::const_iterator,
+        std::ranges::equal_to>
+    constexpr auto bulk_equal(Lhs const& lhs, Rhs const& rhs) -> bool
+    {
+        if constexpr (detail::bytewise_comparable_containers<Lhs, Rhs>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                auto const size = lhs.size();
+                if (size != rhs.size())
+                {
+                    return false;
+                }
+                return size == 0 or
+                       std::memcmp(lhs.data(), rhs.data(), size * sizeof(typename Lhs::value_type)) == 0;
+            }
+        }
+
+        if constexpr (sized_container<Lhs> and sized_container<Rhs>)
+        {
+            if (lhs.size() != rhs.size())
+            {
+                return false;
+            }
+        }
+
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    /// Replaces the contents of dest with a copy of the elements of src.
+    ///
+    /// Contiguous containers of the same trivial value type are resized and copied
+    /// with a single memcpy, other containers are assigned element by element.
+    template <sequence_container Src, resizable_sequence_container Dst>
+    requires requires(Dst& dest, Src const& src) { dest.assign(src.begin(), src.end()); }
+    constexpr auto bulk_assign(Dst& dest, Src const& src) -> void
+    {
+        if constexpr (detail::bytewise_copyable_containers<Src, Dst>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                auto const size = static_cast<typename Dst::size_type>(src.size());
+                if (dest.size() != size)
+                {
+                    dest.resize(size);
+                }
+                if (size > 0)
+                {
+                    std::memcpy(dest.data(), src.data(), size * sizeof(typename Src::value_type));
+                }
+                return;
+            }
+        }
+
+        dest.assign(src.begin(), src.end());
+    }
+
+    /// Appends the elements of range to the end of a sequence container, or inserts them
+    /// into an associative container.
+    ///
+    /// If the number of elements is known up front (range is a sized_range), containers that
+    /// accept a size hint (reservable_container and unordered_associative_container) are reserved
+    /// once before inserting, instead of reallocating or rehashing repeatedly while growing.
+    template <container C, std::ranges::input_range R>
+    requires std::constructible_from<typename C::value_type, std::ranges::range_reference_t<R>> and
+             (back_growable_container<C> or associative_container<C>)
+    auto append_range(C& cont, R&& range) -> void
+    {
+        if constexpr (std::ranges::sized_range<R>)
+        {
+            detail::reserve_additional(cont, static_cast<std::size_t>(std::ranges::size(range)));
+        }
+
+        if constexpr (associative_container<C>)
+        {
+            for (auto&& value : range)
+            {
+                cont.insert(std::forward<decltype(value)>(value));
+            }
+        }
+        else if constexpr (resizable_sequence_container<C> and detail::legacy_iterable_range<R>)
+        {
+            cont.insert(cont.end(), detail::legacy_begin(range), detail::legacy_end(range));
+        }
+        else
+        {
+            for (auto&& value : range)
+            {
+                cont.push_back(typename C::value_type(std::forward<decltype(value)>(value)));
+            }
+        }
+    }
+
+    /// Inserts the elements of range into a sequence container before pos. Returns an iterator
+    /// to the first inserted element (or pos, if range is empty).
+    ///
+    /// If the number of elements is known up front (range is a sized_range), a reservable_container
+    /// is reserved once before inserting.
+    template <resizable_sequence_container C, std::ranges::input_range R>
+    requires std::constructible_from<typename C::value_type, std::ranges::range_reference_t<R>>
+    auto insert_range(C& cont, typename C::const_iterator pos, R&& range) -> typename C::iterator
+    {
+        if constexpr (reservable_container<C> and std::ranges::sized_range<R>)
+        {
+            // Reserving invalidates pos.
+            auto const offset = std::distance(cont.cbegin(), pos);
+            detail::reserve_additional(cont, static_cast<std::size_t>(std::ranges::size(range)));
+            pos = std::next(cont.cbegin(), offset);
+        }
+
+        if constexpr (detail::legacy_iterable_range<R>)
+        {
+            return cont.insert(pos, detail::legacy_begin(range), detail::legacy_end(range));
+        }
+        else
+        {
+            // Move-only iterators are inserted one element at a time.
+            auto const offset = std::distance(cont.cbegin(), pos);
+            for (auto&& value : range)
+            {
+                pos = std::next(cont.insert(pos, typename C::value_type(std::forward<decltype(value)>(value))));
+            }
+            return std::next(cont.begin(), offset);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace more_concepts
+{
+    namespace detail
+    {
+        template <typename C, std::size_t I>
+        concept contiguous_column
+        = requires(C& cont, C const& const_cont)
+        {
+            { cont.template column<I>() } -> std::ranges::contiguous_range;
+            { cont.template column<I>() } -> std::ranges::sized_range;
+            { const_cont.template column<I>() } -> std::ranges::contiguous_range;
+            { const_cont.template column<I>() } -> std::ranges::sized_range;
+        };
+
+        template <typename C, std::size_t... Is>
+        constexpr auto contiguous_columns(std::index_sequence<Is...>) -> bool
+        {
+            return (contiguous_column<C, Is> and ...);
+        }
+
+        template <typename C, typename... ValueTypes, std::size_t... Is>
+        constexpr auto columns_of(std::index_sequence<Is...>) -> bool
+        {
+            return (std::same_as<
+                std::ranges::range_value_t<decltype(std::declval<C&>().template column<Is>())>,
+                ValueTypes> and ...);
+        }
+    }
+
+    /// A container that stores each field of its elements in a separate column (structure of
+    /// arrays), rather than storing whole elements next to each other. Each of the column_count
+    /// columns is available as a contiguous, sized range (e.g. a std::span) through column<I>(),
+    /// so that loops touching only some of the fields read only their memory.
+    ///
+    /// The rows are not objects of value_type, and are not accessed through references to it,
+    /// so columnar containers do not model container.
+    /// Satisfied by soa_vector.
+    template <typename C>
+    concept columnar_container
+    = requires(C const& const_cont)
+    {
+        typename C::size_type;
+        requires std::unsigned_integral<typename C::size_type>;
+
+        { C::column_count } -> std::convertible_to<std::size_t>;
+        requires C::column_count > 0;
+
+        { const_cont.size() } -> std::same_as<typename C::size_type>;
+        { const_cont.empty() } -> std::same_as<bool>;
+    } and
+      detail::contiguous_columns<C>(std::make_index_sequence<C::column_count>{});
+
+    /// The type of column I of a columnar container, e.g. std::span<T>.
+    template <columnar_container C, std::size_t I>
+    requires (I < C::column_count)
+    using column_t = decltype(std::declval<C&>().template column<I>());
+
+    template <typename C, typename... ValueTypes>
+    concept columnar_container_of
+    = columnar_container<C> and
+      C::column_count == sizeof...(ValueTypes) and
+      detail::columns_of<C, ValueTypes...>(std::index_sequence_for<ValueTypes...>{});
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <concepts>
+#include <optional>
+#include <utility>
+
+#include "more_concepts/base_concepts.hpp"
+
+namespace more_concepts
+{
+    /// A bounded queue that can be used by multiple threads at once.
+    ///
+    /// Elements are passed in and out by value: try_push fails if the queue is full,
+    /// and try_pop fails if it is empty, instead of blocking. There are no iterators,
+    /// as the contents may change at any time.
+    /// Satisfied by spsc_queue and mpmc_queue (within their thread restrictions).
+    template <typename Q>
+    concept concurrent_queue
+    = requires(Q& queue, Q const& const_queue, typename Q::value_type& out)
+    {
+        typename Q::value_type;
+        requires decayed<typename Q::value_type>;
+        requires std::movable<typename Q::value_type>;
+
+        typename Q::size_type;
+        requires std::unsigned_integral<typename Q::size_type>;
+
+        // Copy insertion
+        requires not std::copyable<typename Q::value_type> or
+                 requires(typename Q::value_type const& value)
+                 {{ queue.try_push(value) } -> std::same_as<bool>; };
+
+        // Move insertion
+        requires requires(typename Q::value_type&& tmp_value)
+                 {{ queue.try_push(std::move(tmp_value)) } -> std::same_as<bool>; };
+
+        // Removal
+        { queue.try_pop(out) } -> std::same_as<bool>;
+
+        { const_queue.capacity() } -> std::same_as<typename Q::size_type>;
+
+        // No iteration
+        requires not requires { queue.begin(); };
+    };
+
+    template <typename Q, typename ValueType>
+    concept concurrent_queue_of = concurrent_queue<Q> and std::same_as<typename Q::value_type, ValueType>;
+
+    /// A map without multiple key occurrence that can be used by multiple threads at once.
+    ///
+    /// There are no iterators or references to the elements, as they may be erased at any time:
+    /// find returns a copy of the mapped object (if it is copyable), and visit calls a function
+    /// with the mapped object while it is protected from concurrent modification, returning
+    /// whether the key was found. insert_or_assign returns whether the key was inserted.
+    /// Satisfied by striped_map.
+    template <typename M>
+    concept concurrent_unique_map_container
+    = requires(
+        M& map,
+        M const& const_map,
+        typename M::key_type const& key,
+        void (& visitor)(typename M::mapped_type&),
+        void (& const_visitor)(typename M::mapped_type const&))
+    {
+        typename M::key_type;
+        requires decayed<typename M::key_type>;
+        requires std::copyable<typename M::key_type>;
+
+        typename M::mapped_type;
+        requires decayed<typename M::mapped_type>;
+
+        typename M::size_type;
+        requires std::unsigned_integral<typename M::size_type>;
+
+        // Searching
+        { const_map.contains(key) } -> std::same_as<bool>;
+        requires not std::copyable<typename M::mapped_type> or
+                 requires {{ const_map.find(key) } -> std::same_as<std::optional<typename M::mapped_type>>; };
+
+        // Visitation (with any function invocable_as the given signature)
+        { map.visit(key, visitor) } -> std::same_as<bool>;
+        { const_map.visit(key, const_visitor) } -> std::same_as<bool>;
+
+        // Insertion (mapped object copy)
+        requires not std::copyable<typename M::mapped_type> or
+                 requires(typename M::mapped_type const& obj)
+                 {{ map.insert_or_assign(key, obj) } -> std::same_as<bool>; };
+
+        // Insertion (mapped object move)
+        requires not std::movable<typename M::mapped_type> or
+                 requires(typename M::mapped_type&& tmp_obj)
+                 {{ map.insert_or_assign(key, std::move(tmp_obj)) } -> std::same_as<bool>; };
+
+        // Removal
+        { map.erase(key) } -> std::same_as<typename M::size_type>;
+
+        { const_map.size() } -> std::same_as<typename M::size_type>;
+
+        // No iteration
+        requires not requires { map.begin(); };
+    };
+
+    template <typename M, typename KeyType, typename MappedType>
+    concept concurrent_unique_map_container_of
+    = concurrent_unique_map_container<M> and
+      std::same_as<typename M::key_type, KeyType> and
+      std::same_as<typename M::mapped_type, MappedType>;
+}
@@ -0,0 +1,328 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "more_concepts/base_containers.hpp"
+#include "more_concepts/concurrent_containers.hpp"
+#include "more_concepts/sequence_containers.hpp"
+#include "more_concepts/detail/cache_line.hpp"
+
+namespace more_concepts
+{
+    namespace detail
+    {
+        /// Creates the storage of a queue: fixed capacity storage has a size of its own,
+        /// other storage is created with the given size.
+        template <typename Storage>
+        auto make_queue_storage([[maybe_unused]] std::size_t const size) -> Storage
+        {
+            if constexpr (fixed_capacity_container<Storage>)
+            {
+                return Storage();
+            }
+            else
+            {
+                return Storage(size);
+            }
+        }
+    }
+
+    /// A wait-free bounded queue for one producer thread and one consumer thread, stored
+    /// in a ring buffer. Only one thread may call try_push, and only one (other) thread try_pop.
+    ///
+    /// The elements are stored in Storage, whose size is fixed when the queue is created:
+    /// either a fixed capacity container (e.g. array<T, N>), or a container created with (or adopted
+    /// at) the requested size. The elements are assigned to the storage, and moved out when popped.
+    ///
+    /// The producer and consumer indices are on separate cache lines, and each thread keeps a cached
+    /// copy of the other's index, so that it only has to load it when the queue looks full (or empty).
+    template <std::movable T, contiguous_container_of<T> Storage = std::vector<T>>
+    class spsc_queue
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using storage_type = Storage;
+
+        spsc_queue()
+        requires fixed_capacity_container<Storage>
+            : slots_{storage_.data()}
+            , capacity_{storage_.size()}
+        {
+        }
+
+        explicit spsc_queue(size_type const capacity)
+        requires (not fixed_capacity_container<Storage>)
+            : storage_(detail::make_queue_storage<Storage>(capacity))
+            , slots_{storage_.data()}
+            , capacity_{storage_.size()}
+        {
+        }
+
+        /// Adopts storage, whose size becomes the capacity.
+        explicit spsc_queue(Storage storage)
+            : storage_{std::move(storage)}
+            , slots_{storage_.data()}
+            , capacity_{storage_.size()}
+        {
+        }
+
+        spsc_queue(spsc_queue const&) = delete;
+        auto operator=(spsc_queue const&) -> spsc_queue& = delete;
+
+        [[nodiscard]] auto capacity() const noexcept -> size_type
+        {
+            return capacity_;
+        }
+
+        /// Appends value, unless the queue is full. Producer thread only.
+        auto try_push(T const& value) -> bool
+        {
+            return try_push_impl(value);
+        }
+
+        /// Appends value, unless the queue is full. Producer thread only.
+        auto try_push(T&& value) -> bool
+        {
+            return try_push_impl(std::move(value));
+        }
+
+        /// Moves the first element to out, unless the queue is empty. Consumer thread only.
+        auto try_pop(T& out) -> bool
+        {
+            auto const head = consumer_.head.load(std::memory_order_relaxed);
+            if (head == consumer_.cached_tail)
+            {
+                consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+                if (head == consumer_.cached_tail)
+                {
+                    return false;
+                }
+            }
+            out = std::move(slots_[slot(head)]);
+            consumer_.head.store(next(head), std::memory_order_release);
+            return true;
+        }
+
+    private:
+        // The indices run from 0 to 2 * capacity_ before wrapping around, which distinguishes
+        // a full queue (capacity_ apart) from an empty one (equal) without wasting a slot.
+
+        struct alignas(detail::cache_line_size) producer_state
+        {
+            std::atomic<size_type> tail = 0;
+            size_type cached_head = 0;
+        };
+
+        struct alignas(detail::cache_line_size) consumer_state
+        {
+            std::atomic<size_type> head = 0;
+            size_type cached_tail = 0;
+        };
+
+        Storage storage_ = Storage();
+        T* slots_;
+        size_type capacity_;
+        producer_state producer_;
+        consumer_state consumer_;
+
+        [[nodiscard]] auto slot(size_type const index) const noexcept -> size_type
+        {
+            return index < capacity_ ? index : index - capacity_;
+        }
+
+        [[nodiscard]] auto next(size_type const index) const noexcept -> size_type
+        {
+            return index + 1 == 2 * capacity_ ? 0 : index + 1;
+        }
+
+        [[nodiscard]] auto distance(size_type const from, size_type const to) const noexcept -> size_type
+        {
+            return to >= from ? to - from : to + 2 * capacity_ - from;
+        }
+
+        template <typename U>
+        auto try_push_impl(U&& value) -> bool
+        {
+            auto const tail = producer_.tail.load(std::memory_order_relaxed);
+            if (distance(producer_.cached_head, tail) == capacity_)
+            {
+                producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+                if (distance(producer_.cached_head, tail) == capacity_)
+                {
+                    return false;
+                }
+            }
+            slots_[slot(tail)] = std::forward<U>(value);
+            producer_.tail.store(next(tail), std::memory_order_release);
+            return true;
+        }
+    };
+
+    /// A slot of an mpmc_queue: an element, and the sequence number that tells
+    /// whether it is ready to be written or read.
+    template <typename T>
+    struct mpmc_queue_cell
+    {
+        std::atomic<std::size_t> sequence = 0;
+        T value = T();
+    };
+
+    /// A lock-free bounded queue for any number of producer and consumer threads, after Dmitry Vyukov's
+    /// bounded MPMC queue: each cell has a sequence number, and threads claim cells by advancing
+    /// the enqueue / dequeue position with a CAS. Producers only contend with producers, and consumers
+    /// with consumers, unless the queue is nearly full or empty; there are no locks to wait for.
+    ///
+    /// The cells are stored in Storage, whose size (the capacity) must be a power of two:
+    /// either a fixed capacity container (e.g. array<mpmc_queue_cell<T>, N>), or a container created
+    /// with the requested size. Moving an element in and out must not throw.
+    template <
+        std::movable T,
+        contiguous_container_of<mpmc_queue_cell<T>> Storage = std::vector<mpmc_queue_cell<T>>>
+    requires std::is_nothrow_move_assignable_v<T>
+    class mpmc_queue
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using storage_type = Storage;
+
+        mpmc_queue()
+        requires fixed_capacity_container<Storage>
+        {
+            static_assert(std::has_single_bit(fixed_capacity_v<Storage>), "the capacity must be a power of two");
+            initialize_cells();
+        }
+
+        /// Throws std::invalid_argument if capacity is not a power of two.
+        explicit mpmc_queue(size_type const capacity)
+        requires (not fixed_capacity_container<Storage>)
+            : storage_(detail::make_queue_storage<Storage>(capacity))
+        {
+            initialize_cells();
+        }
+
+        /// Adopts storage, whose size becomes the capacity.
+        /// Throws std::invalid_argument if its size is not a power of two.
+        explicit mpmc_queue(Storage storage)
+        requires std::movable<Storage>
+            : storage_{std::move(storage)}
+        {
+            initialize_cells();
+        }
+
+        mpmc_queue(mpmc_queue const&) = delete;
+        auto operator=(mpmc_queue const&) -> mpmc_queue& = delete;
+
+        [[nodiscard]] auto capacity() const noexcept -> size_type
+        {
+            return mask_ + 1;
+        }
+
+        /// Appends value, unless the queue is full.
+        auto try_push(T const& value) -> bool
+        {
+            // Copied before claiming a cell, as copying may throw.
+            auto copy = value;
+            return try_push(std::move(copy));
+        }
+
+        /// Appends value, unless the queue is full.
+        auto try_push(T&& value) noexcept -> bool
+        {
+            auto position = enqueue_position_.value.load(std::memory_order_relaxed);
+            while (true)
+            {
+                auto& cell = cells_[position & mask_];
+                auto const sequence = cell.sequence.load(std::memory_order_acquire);
+                auto const lag = static_cast<std::intptr_t>(sequence - position);
+                if (lag == 0)
+                {
+                    // The cell is free; claim it.
+                    if (enqueue_position_.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        cell.value = std::move(value);
+                        cell.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (lag < 0)
+                {
+                    // The cell still holds the element pushed one lap ago: the queue is full.
+                    return false;
+                }
+                else
+                {
+                    // Another producer claimed the cell.
+                    position = enqueue_position_.value.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /// Moves the first element to out, unless the queue is empty.
+        auto try_pop(T& out) noexcept -> bool
+        {
+            auto position = dequeue_position_.value.load(std::memory_order_relaxed);
+            while (true)
+            {
+                auto& cell = cells_[position & mask_];
+                auto const sequence = cell.sequence.load(std::memory_order_acquire);
+                auto const lag = static_cast<std::intptr_t>(sequence - (position + 1));
+                if (lag == 0)
+                {
+                    // The cell holds an element; claim it.
+                    if (dequeue_position_.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        out = std::move(cell.value);
+                        cell.sequence.store(position + mask_ + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (lag < 0)
+                {
+                    // The cell has not been written yet: the queue is empty.
+                    return false;
+                }
+                else
+                {
+                    // Another consumer claimed the cell.
+                    position = dequeue_position_.value.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+    private:
+        struct alignas(detail::cache_line_size) padded_position
+        {
+            std::atomic<size_type> value = 0;
+        };
+
+        Storage storage_ = Storage();
+        mpmc_queue_cell<T>* cells_ = nullptr;
+        size_type mask_ = 0;
+        padded_position enqueue_position_;
+        padded_position dequeue_position_;
+
+        auto initialize_cells() -> void
+        {
+            if (not std::has_single_bit(storage_.size()))
+            {
+                throw std::invalid_argument{"more_concepts::mpmc_queue: the capacity must be a power of two"};
+            }
+            cells_ = storage_.data();
+            mask_ = storage_.size() - 1;
+            for (auto i = size_type{0}; i <= mask_; ++i)
+            {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+    };
+}
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace more_concepts
+{
+    namespace detail
+    {
+        enum class container_category_bit : std::uint32_t
+        {
+            container = 1u << 0u,
+            mutable_container = 1u << 1u,
+            sized_container = 1u << 2u,
+            clearable_container = 1u << 3u,
+            reversible_container = 1u << 4u,
+            sequence_container = 1u << 5u,
+            double_ended_container = 1u << 6u,
+            random_access_container = 1u << 7u,
+            contiguous_container = 1u << 8u,
+            resizable_sequence_container = 1u << 9u,
+            inplace_constructing_sequence_container = 1u << 10u,
+            front_growable_container = 1u << 11u,
+            inplace_front_constructing_container = 1u << 12u,
+            back_growable_container = 1u << 13u,
+            inplace_back_constructing_container = 1u << 14u,
+            associative_container = 1u << 15u,
+            unique_associative_container = 1u << 16u,
+            multiple_associative_container = 1u << 17u,
+            ordered_associative_container = 1u << 18u,
+            unordered_associative_container = 1u << 19u,
+            map_container = 1u << 20u,
+            unique_map_container = 1u << 21u,
+            multiple_map_container = 1u << 22u,
+            allocator_aware_container = 1u << 23u,
+            node_extractable_container = 1u << 24u,
+            reservable_container = 1u << 25u,
+        };
+
+        constexpr auto category_mask(auto... bits) -> std::uint32_t
+        {
+            return (static_cast<std::uint32_t>(bits) | ...);
+        }
+    }
+
+    /// The container concepts that a type can be declared to model
+    /// using enable_container_category.
+    ///
+    /// Each enumerator also includes all the concepts refined by the concept it names,
+    /// e.g. declaring random_access_container also declares double_ended_container,
+    /// sequence_container, sized_container, reversible_container and container.
+    enum class container_category : std::uint32_t
+    {
+        none = 0,
+
+        container
+        = detail::category_mask(detail::container_category_bit::container),
+        mutable_container
+        = detail::category_mask(container, detail::container_category_bit::mutable_container),
+        sized_container
+        = detail::category_mask(container, detail::container_category_bit::sized_container),
+        clearable_container
+        = detail::category_mask(container, detail::container_category_bit::clearable_container),
+        reversible_container
+        = detail::category_mask(container, detail::container_category_bit::reversible_container),
+        allocator_aware_container
+        = detail::category_mask(container, detail::container_category_bit::allocator_aware_container),
+
+        sequence_container
+        = detail::category_mask(container, detail::container_category_bit::sequence_container),
+        double_ended_container
+        = detail::category_mask(
+            sequence_container,
+            sized_container,
+            reversible_container,
+            detail::container_category_bit::double_ended_container),
+        random_access_container
+        = detail::category_mask(
+            double_ended_container,
+            detail::container_category_bit::random_access_container),
+        contiguous_container
+        = detail::category_mask(
+            random_access_container,
+            detail::container_category_bit::contiguous_container),
+        resizable_sequence_container
+        = detail::category_mask(
+            double_ended_container,
+            clearable_container,
+            detail::container_category_bit::resizable_sequence_container),
+        inplace_constructing_sequence_container
+        = detail::category_mask(
+            resizable_sequence_container,
+            detail::container_category_bit::inplace_constructing_sequence_container),
+        front_growable_container
+        = detail::category_mask(
+            sequence_container,
+            detail::container_category_bit::front_growable_container),
+        inplace_front_constructing_container
+        = detail::category_mask(
+            front_growable_container,
+            detail::container_category_bit::inplace_front_constructing_container),
+        back_growable_container
+        = detail::category_mask(
+            double_ended_container,
+            detail::container_category_bit::back_growable_container),
+        inplace_back_constructing_container
+        = detail::category_mask(
+            back_growable_container,
+            detail::container_category_bit::inplace_back_constructing_container),
+        reservable_container
+        = detail::category_mask(
+            sequence_container,
+            sized_container,
+            detail::container_category_bit::reservable_container),
+
+        associative_container
+        = detail::category_mask(
+            sized_container,
+            clearable_container,
+            detail::container_category_bit::associative_container),
+        unique_associative_container
+        = detail::category_mask(
+            associative_container,
+            detail::container_category_bit::unique_associative_container),
+        multiple_associative_container
+        = detail::category_mask(
+            associative_container,
+            detail::container_category_bit::multiple_associative_container),
+        ordered_associative_container
+        = detail::category_mask(
+            associative_container,
+            detail::container_category_bit::ordered_associative_container),
+        unordered_associative_container
+        = detail::category_mask(
+            associative_container,
+            detail::container_category_bit::unordered_associative_container),
+        node_extractable_container
+        = detail::category_mask(
+            associative_container,
+            detail::container_category_bit::node_extractable_container),
+        ordered_unique_associative_container
+        = detail::category_mask(unique_associative_container, ordered_associative_container),
+        ordered_multiple_associative_container
+        = detail::category_mask(multiple_associative_container, ordered_associative_container),
+        unordered_unique_associative_container
+        = detail::category_mask(unique_associative_container, unordered_associative_container),
+        unordered_multiple_associative_container
+        = detail::category_mask(multiple_associative_container, unordered_associative_container),
+
+        map_container
+        = detail::category_mask(
+            associative_container,
+            detail::container_category_bit::map_container),
+        unique_map_container
+        = detail::category_mask(
+            map_container,
+            detail::container_category_bit::unique_map_container),
+        multiple_map_container
+        = detail::category_mask(
+            map_container,
+            detail::container_category_bit::multiple_map_container),
+        ordered_map_container
+        = detail::category_mask(map_container, ordered_associative_container),
+        ordered_unique_map_container
+        = detail::category_mask(unique_map_container, ordered_map_container),
+        ordered_multiple_map_container
+        = detail::category_mask(multiple_map_container, ordered_map_container),
+        unordered_map_container
+        = detail::category_mask(map_container, unordered_associative_container),
+        unordered_unique_map_container
+        = detail::category_mask(unique_map_container, unordered_map_container),
+        unordered_multiple_map_container
+        = detail::category_mask(multiple_map_container, unordered_map_container),
+    };
+
+    constexpr auto operator|(container_category const lhs, container_category const rhs)
+    -> container_category
+    {
+        return static_cast<container_category>(detail::category_mask(lhs, rhs));
+    }
+
+    constexpr auto operator&(container_category const lhs, container_category const rhs)
+    -> container_category
+    {
+        return static_cast<container_category>(
+            static_cast<std::uint32_t>(lhs) & static_cast<std::uint32_t>(rhs));
+    }
+
+    /// Customization point declaring which container concepts a type models.
+    ///
+    /// The container concepts consult this declaration before evaluating their requirements,
+    /// and skip the evaluation for the declared concepts. Specialize it for frequently checked
+    /// container types to save compile time, e.g.:
+    ///
+    ///     template <typename T>
+    ///     inline constexpr auto more_concepts::enable_container_category<my_vector<T>>
+    ///         = more_concepts::container_category::contiguous_container |
+    ///           more_concepts::container_category::inplace_constructing_sequence_container |
+    ///           more_concepts::container_category::inplace_back_constructing_container;
+    ///
+    /// A type declared to model a concept it does not actually model will be accepted by that
+    /// concept regardless. Define MORE_CONCEPTS_VERIFY_CONTAINER_CATEGORY to ignore the
+    /// declarations, and instead verify them against the full requirements
+    /// (every declaration that does not hold will cause a compile error). The macro changes
+    /// the definition of the concepts, so it must be defined either in all translation units
+    /// of a program, or in none of them (otherwise, the program violates the ODR).
+    ///
+    /// Note: sized_container is always checked structurally, as its requirements are cheaper
+    /// than checking the declaration.
+    template <typename C>
+    inline constexpr auto enable_container_category = container_category::none;
+
+    namespace detail
+    {
+        template <typename C, container_category Category>
+        concept container_category_declared
+        = (enable_container_category<std::remove_cv_t<C>> & Category) == Category;
+
+        /// Satisfied if C is declared to model the concept corresponding to Category.
+        /// In verification mode, declarations are ignored.
+        template <typename C, container_category Category>
+        concept declares_container_category
+#ifdef MORE_CONCEPTS_VERIFY_CONTAINER_CATEGORY
+        = false;
+#else
+        = container_category_declared<C, Category>;
+#endif
+
+        /// Checked last by each container concept, once the structural requirements of
+        /// Category are known to be unsatisfied. Always returns false.
+        /// In verification mode, fails compilation if C is declared to model Category.
+        template <typename C, container_category Category>
+        consteval auto reject_container_category() -> bool
+        {
+#ifdef MORE_CONCEPTS_VERIFY_CONTAINER_CATEGORY
+            static_assert(
+                not container_category_declared<C, Category>,
+                "more_concepts::enable_container_category declares a container concept "
+                "that the type does not model");
+#endif
+            return false;
+        }
+    }
+}
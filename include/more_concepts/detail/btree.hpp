@@ -0,0 +1,1463 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/base_concepts.hpp"
+#include "more_concepts/detail/cache_line.hpp"
+#include "more_concepts/detail/synth_three_way.hpp"
+#include "more_concepts/detail/vector_base.hpp"
+#include "more_concepts/relocation.hpp"
+
+namespace more_concepts::detail
+{
+    /// The default size of a B-tree node: four cache lines.
+    inline constexpr std::size_t default_btree_node_size = 4 * cache_line_size;
+
+    /// Common implementation of btree_map, btree_multimap, btree_set and btree_multiset:
+    /// a B-tree whose nodes (internal ones included) store as many values as fit in about
+    /// NodeSize bytes, at least three. Values are relocated between nodes as they split and merge,
+    /// so they must be nothrow relocatable.
+    ///
+    /// KeyOfValue extracts the key from a value. Multiple allows equivalent keys.
+    /// If MutableIterators is false, iterator is the same type as const_iterator.
+    template <
+        typename Key,
+        typename Value,
+        typename KeyOfValue,
+        typename Compare,
+        typename Allocator,
+        std::size_t NodeSize,
+        bool Multiple,
+        bool MutableIterators>
+    requires nothrow_relocatable<Value>
+    class btree
+    {
+        struct internal_node;
+
+        struct node_header
+        {
+            internal_node* parent;
+            /// The index of the node among the children of its parent.
+            std::uint16_t position;
+            std::uint16_t count;
+            bool leaf;
+        };
+
+        static constexpr std::size_t slots_per_node = std::clamp<std::size_t>(
+            NodeSize > sizeof(node_header) ? (NodeSize - sizeof(node_header)) / sizeof(Value) : 0,
+            3,
+            std::numeric_limits<std::uint16_t>::max() - 1);
+
+        /// Nodes other than the root are merged or rebalanced with a sibling when they have
+        /// fewer values than this after an erasure.
+        static constexpr std::size_t min_slots = (slots_per_node - 1) / 2;
+
+        /// Leaves are B-tree nodes without children.
+        struct leaf_node : node_header
+        {
+            inline_storage<Value, slots_per_node> slots;
+        };
+
+        struct internal_node : leaf_node
+        {
+            std::array<leaf_node*, slots_per_node + 1> children;
+        };
+
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using leaf_alloc_traits = typename alloc_traits::template rebind_traits<leaf_node>;
+        using internal_alloc_traits = typename alloc_traits::template rebind_traits<internal_node>;
+
+        template <bool Const>
+        class iterator_impl;
+
+        static_assert(
+            std::same_as<typename alloc_traits::value_type, Value>,
+            "Allocator::value_type must be the same as the value type");
+
+    public:
+        using key_type = Key;
+        using value_type = Value;
+        using key_compare = Compare;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = value_type const&;
+        using iterator = std::conditional_t<MutableIterators, iterator_impl<false>, iterator_impl<true>>;
+        using const_iterator = iterator_impl<true>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        /// The number of values each node can hold.
+        static constexpr size_type node_capacity = slots_per_node;
+
+        // Construction
+
+        btree() = default;
+
+        explicit btree(key_compare const& comp, allocator_type const& alloc = allocator_type())
+            : comp_{comp}
+            , alloc_{alloc}
+        {
+        }
+
+        explicit btree(allocator_type const& alloc)
+            : alloc_{alloc}
+        {
+        }
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        btree(I const first, S const last, key_compare const& comp = key_compare(),
+              allocator_type const& alloc = allocator_type())
+            : btree(comp, alloc)
+        {
+            insert(first, last);
+        }
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        btree(I const first, S const last, allocator_type const& alloc)
+            : btree(first, last, key_compare(), alloc)
+        {
+        }
+
+        btree(std::initializer_list<value_type> const init_list, key_compare const& comp = key_compare(),
+              allocator_type const& alloc = allocator_type())
+            : btree(init_list.begin(), init_list.end(), comp, alloc)
+        {
+        }
+
+        btree(std::initializer_list<value_type> const init_list, allocator_type const& alloc)
+            : btree(init_list.begin(), init_list.end(), key_compare(), alloc)
+        {
+        }
+
+        btree(btree const& other)
+            : btree(other, alloc_traits::select_on_container_copy_construction(other.alloc_))
+        {
+        }
+
+        btree(btree const& other, allocator_type const& alloc)
+            : btree(other.comp_, alloc)
+        {
+            append_from(other.begin(), other.end());
+        }
+
+        btree(btree&& other) noexcept
+            : comp_{other.comp_}
+            , alloc_{std::move(other.alloc_)}
+        {
+            steal_nodes_from(other);
+        }
+
+        btree(btree&& other, allocator_type const& alloc)
+            : btree(other.comp_, alloc)
+        {
+            if (alloc_ == other.alloc_)
+            {
+                steal_nodes_from(other);
+            }
+            else
+            {
+                append_from(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+            }
+        }
+
+        auto operator=(btree const& other) -> btree&
+        {
+            if (this != &other)
+            {
+                clear();
+                if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+                {
+                    alloc_ = other.alloc_;
+                }
+                comp_ = other.comp_;
+                append_from(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        auto operator=(btree&& other)
+        noexcept(alloc_traits::propagate_on_container_move_assignment::value or
+                 alloc_traits::is_always_equal::value) -> btree&
+        {
+            if (this != &other)
+            {
+                clear();
+                comp_ = other.comp_;
+                constexpr auto propagate = alloc_traits::propagate_on_container_move_assignment::value;
+                if (propagate or alloc_ == other.alloc_)
+                {
+                    if constexpr (propagate)
+                    {
+                        alloc_ = std::move(other.alloc_);
+                    }
+                    steal_nodes_from(other);
+                }
+                else
+                {
+                    append_from(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                    other.clear();
+                }
+            }
+            return *this;
+        }
+
+        ~btree()
+        {
+            clear();
+        }
+
+        [[nodiscard]] auto get_allocator() const noexcept -> allocator_type
+        {
+            return alloc_;
+        }
+
+        // Iterators
+
+        [[nodiscard]] auto begin() noexcept -> iterator { return iterator{leftmost_, 0}; }
+
+        [[nodiscard]] auto begin() const noexcept -> const_iterator { return const_iterator{leftmost_, 0}; }
+
+        [[nodiscard]] auto cbegin() const noexcept -> const_iterator { return begin(); }
+
+        [[nodiscard]] auto end() noexcept -> iterator { return iterator{rightmost_, end_index()}; }
+
+        [[nodiscard]] auto end() const noexcept -> const_iterator { return const_iterator{rightmost_, end_index()}; }
+
+        [[nodiscard]] auto cend() const noexcept -> const_iterator { return end(); }
+
+        [[nodiscard]] auto rbegin() noexcept -> reverse_iterator { return reverse_iterator{end()}; }
+
+        [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator { return crbegin(); }
+
+        [[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator{cend()}; }
+
+        [[nodiscard]] auto rend() noexcept -> reverse_iterator { return reverse_iterator{begin()}; }
+
+        [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator { return crend(); }
+
+        [[nodiscard]] auto crend() const noexcept -> const_reverse_iterator { return const_reverse_iterator{cbegin()}; }
+
+        // Capacity
+
+        [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+
+        [[nodiscard]] auto size() const noexcept -> size_type { return size_; }
+
+        [[nodiscard]] auto max_size() const noexcept -> size_type
+        {
+            return static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(value_type);
+        }
+
+        // Observers
+
+        [[nodiscard]] auto key_comp() const -> key_compare { return comp_; }
+
+        // Lookup
+        //
+        // With a transparent comparator, the lookup functions also accept any key type K
+        // comparable with key_type, without converting it.
+
+        [[nodiscard]] auto find(key_type const& key) -> iterator
+        {
+            return to_iterator(find_key(key));
+        }
+
+        [[nodiscard]] auto find(key_type const& key) const -> const_iterator
+        {
+            return find_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto find(K const& key) -> iterator
+        {
+            return to_iterator(find_key(key));
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto find(K const& key) const -> const_iterator
+        {
+            return find_key(key);
+        }
+
+        [[nodiscard]] auto count(key_type const& key) const -> size_type
+        {
+            if constexpr (Multiple)
+            {
+                auto const [first, last] = equal_range_of_key(key);
+                return static_cast<size_type>(std::distance(first, last));
+            }
+            else
+            {
+                return find_key(key) != end() ? 1 : 0;
+            }
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto count(K const& key) const -> size_type
+        {
+            // A transparent comparator may consider several keys equivalent to key.
+            auto const [first, last] = equal_range_of_key(key);
+            return static_cast<size_type>(std::distance(first, last));
+        }
+
+        [[nodiscard]] auto contains(key_type const& key) const -> bool
+        {
+            return find_key(key) != end();
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto contains(K const& key) const -> bool
+        {
+            return find_key(key) != end();
+        }
+
+        [[nodiscard]] auto lower_bound(key_type const& key) -> iterator
+        {
+            return to_iterator(lower_bound_of_key(key));
+        }
+
+        [[nodiscard]] auto lower_bound(key_type const& key) const -> const_iterator
+        {
+            return lower_bound_of_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto lower_bound(K const& key) -> iterator
+        {
+            return to_iterator(lower_bound_of_key(key));
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto lower_bound(K const& key) const -> const_iterator
+        {
+            return lower_bound_of_key(key);
+        }
+
+        [[nodiscard]] auto upper_bound(key_type const& key) -> iterator
+        {
+            return to_iterator(upper_bound_of_key(key));
+        }
+
+        [[nodiscard]] auto upper_bound(key_type const& key) const -> const_iterator
+        {
+            return upper_bound_of_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto upper_bound(K const& key) -> iterator
+        {
+            return to_iterator(upper_bound_of_key(key));
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto upper_bound(K const& key) const -> const_iterator
+        {
+            return upper_bound_of_key(key);
+        }
+
+        [[nodiscard]] auto equal_range(key_type const& key) -> std::pair<iterator, iterator>
+        {
+            auto const [first, last] = equal_range_of_key(key);
+            return {to_iterator(first), to_iterator(last)};
+        }
+
+        [[nodiscard]] auto equal_range(key_type const& key) const -> std::pair<const_iterator, const_iterator>
+        {
+            return equal_range_of_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto equal_range(K const& key) -> std::pair<iterator, iterator>
+        {
+            auto const [first, last] = equal_range_of_key(key);
+            return {to_iterator(first), to_iterator(last)};
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto equal_range(K const& key) const -> std::pair<const_iterator, const_iterator>
+        {
+            return equal_range_of_key(key);
+        }
+
+        // Modifiers
+
+        /// For unique keys, pair<iterator, bool>: the inserted element (or the element with
+        /// an equivalent key that prevented insertion), and whether the insertion took place.
+        /// For multiple keys, the inserted element.
+        using emplace_result = std::conditional_t<Multiple, iterator, std::pair<iterator, bool>>;
+
+        auto insert(value_type const& value) -> emplace_result
+        {
+            return emplace(value);
+        }
+
+        auto insert(value_type&& value) -> emplace_result
+        {
+            return emplace(std::move(value));
+        }
+
+        auto insert(const_iterator const hint, value_type const& value) -> iterator
+        {
+            return emplace_hint(hint, value);
+        }
+
+        auto insert(const_iterator const hint, value_type&& value) -> iterator
+        {
+            return emplace_hint(hint, std::move(value));
+        }
+
+        /// Inserts each value with a hint at the end, so sorted values are appended to the last leaf
+        /// without searching, while values out of order cost one more comparison each.
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        auto insert(I first, S const last) -> void
+        {
+            for (; first != last; ++first)
+            {
+                emplace_hint(cend(), *first);
+            }
+        }
+
+        auto insert(std::initializer_list<value_type> const init_list) -> void
+        {
+            insert(init_list.begin(), init_list.end());
+        }
+
+        template <typename... Args>
+        auto emplace(Args&& ... args) -> emplace_result
+        {
+            auto value = value_holder(std::forward<Args>(args)...);
+            if constexpr (Multiple)
+            {
+                return insert_at(upper_position(KeyOfValue{}(value.get())), value);
+            }
+            else
+            {
+                auto const pos = unique_position(KeyOfValue{}(value.get()));
+                if (pos.found)
+                {
+                    return {to_iterator(pos), false};
+                }
+                return {insert_at(pos, value), true};
+            }
+        }
+
+        template <typename... Args>
+        auto emplace_hint(const_iterator const hint, Args&& ... args) -> iterator
+        {
+            auto value = value_holder(std::forward<Args>(args)...);
+            auto const pos = hinted_position(hint, KeyOfValue{}(value.get()));
+            if (pos.found)
+            {
+                return to_iterator(pos);
+            }
+            return insert_at(pos, value);
+        }
+
+        auto erase(iterator const pos) -> iterator
+        requires MutableIterators
+        {
+            return erase_at(pos);
+        }
+
+        auto erase(const_iterator const pos) -> iterator
+        {
+            return erase_at(pos);
+        }
+
+        auto erase(const_iterator first, const_iterator const last) -> iterator
+        {
+            if (first == cbegin() and last == cend())
+            {
+                clear();
+                return end();
+            }
+
+            // Erasure moves values between nodes, so the elements are counted beforehand.
+            auto remaining = std::distance(first, last);
+            auto pos = to_iterator(first);
+            for (; remaining > 0; --remaining)
+            {
+                pos = erase_at(pos);
+            }
+            return pos;
+        }
+
+        auto erase(key_type const& key) -> size_type
+        {
+            auto const [first, last] = equal_range_of_key(key);
+            auto const count = static_cast<size_type>(std::distance(first, last));
+            erase(first, last);
+            return count;
+        }
+
+        auto clear() noexcept -> void
+        {
+            if (root_ != nullptr)
+            {
+                destroy_subtree(root_);
+                root_ = nullptr;
+                leftmost_ = nullptr;
+                rightmost_ = nullptr;
+                size_ = 0;
+            }
+        }
+
+        auto swap(btree& other) noexcept(std::is_nothrow_swappable_v<key_compare>) -> void
+        {
+            using std::swap;
+            swap(root_, other.root_);
+            swap(leftmost_, other.leftmost_);
+            swap(rightmost_, other.rightmost_);
+            swap(size_, other.size_);
+            swap(comp_, other.comp_);
+            if constexpr (alloc_traits::propagate_on_container_swap::value)
+            {
+                swap(alloc_, other.alloc_);
+            }
+        }
+
+        // Comparison
+
+        friend auto operator==(btree const& lhs, btree const& rhs) -> bool
+        requires std::equality_comparable<value_type>
+        {
+            return lhs.size_ == rhs.size_ and std::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+        friend auto operator<=>(btree const& lhs, btree const& rhs)
+        requires requires(value_type const& value) { synth_three_way(value, value); }
+        {
+            return std::lexicographical_compare_three_way(
+                lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), synth_three_way);
+        }
+
+        friend auto swap(btree& lhs, btree& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void
+        {
+            lhs.swap(rhs);
+        }
+
+    protected:
+        /// Where a key was found, or where it would be inserted. Insertion positions are
+        /// always in a leaf (or null, in an empty tree), before the value at index.
+        struct position
+        {
+            leaf_node* node;
+            size_type index;
+            bool found;
+        };
+
+        /// The position of the element with a key equivalent to key, or the position to insert it at.
+        template <typename K>
+        [[nodiscard]] auto unique_position(K const& key) const -> position
+        {
+            auto* node = root_;
+            if (node == nullptr)
+            {
+                return {nullptr, 0, false};
+            }
+            while (true)
+            {
+                auto const index = lower_bound_in(node, key);
+                if (index < node->count and not comp_(key, key_at(node, index)))
+                {
+                    return {node, index, true};
+                }
+                if (node->leaf)
+                {
+                    return {node, index, false};
+                }
+                node = child(node, index);
+            }
+        }
+
+        /// Like unique_position, but takes constant time if key belongs right before hint.
+        /// For multiple keys, the position is the one nearest to hint among those that keep
+        /// the order: right before hint if possible, or else the lower bound of key if hint
+        /// is before it, and the upper bound of key if hint is after it (as with multimap).
+        template <typename K>
+        [[nodiscard]] auto hinted_position(const_iterator const hint, K const& key) const -> position
+        {
+            auto const fits_after_previous = hint == begin() or
+                                             (Multiple ? not comp_(key, KeyOfValue{}(*std::prev(hint)))
+                                                       : comp_(KeyOfValue{}(*std::prev(hint)), key));
+            if (fits_after_previous and (hint == end() or not comp_(KeyOfValue{}(*hint), key)))
+            {
+                if (not Multiple and hint != end() and not comp_(key, KeyOfValue{}(*hint)))
+                {
+                    return {hint.node_, hint.index_, true};
+                }
+                return position_before(hint);
+            }
+
+            if constexpr (Multiple)
+            {
+                if (hint != end() and comp_(KeyOfValue{}(*hint), key))
+                {
+                    return position_before(lower_bound_of_key(key));
+                }
+                return upper_position(key);
+            }
+            else
+            {
+                return unique_position(key);
+            }
+        }
+
+        [[nodiscard]] auto to_iterator(position const pos) const noexcept -> iterator
+        {
+            return iterator{pos.node, pos.index};
+        }
+
+        [[nodiscard]] auto to_iterator(const_iterator const pos) const noexcept -> iterator
+        {
+            return iterator{pos.node_, pos.index_};
+        }
+
+        /// Constructs a value from args, and inserts it at the insertion position pos.
+        template <typename... Args>
+        auto emplace_at(position const pos, Args&& ... args) -> iterator
+        {
+            auto value = value_holder(std::forward<Args>(args)...);
+            return insert_at(pos, value);
+        }
+
+    private:
+        leaf_node* root_ = nullptr;
+        leaf_node* leftmost_ = nullptr;
+        leaf_node* rightmost_ = nullptr;
+        size_type size_ = 0;
+        [[no_unique_address]] key_compare comp_ = {};
+        [[no_unique_address]] allocator_type alloc_ = {};
+
+        template <bool Const>
+        class iterator_impl
+        {
+        public:
+            using iterator_concept = std::bidirectional_iterator_tag;
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = Value;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<Const, Value const&, Value&>;
+            using pointer = std::conditional_t<Const, Value const*, Value*>;
+
+            iterator_impl() = default;
+
+            template <bool OtherConst>
+            requires (Const and not OtherConst)
+            iterator_impl(iterator_impl<OtherConst> const& other) noexcept
+                : node_{other.node_}
+                , index_{other.index_}
+            {
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> reference
+            {
+                return *slot(node_, index_);
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> pointer
+            {
+                return slot(node_, index_);
+            }
+
+            auto operator++() noexcept -> iterator_impl&
+            {
+                if (not node_->leaf)
+                {
+                    node_ = leftmost_leaf(child(node_, index_ + 1));
+                    index_ = 0;
+                    return *this;
+                }
+
+                ++index_;
+                // Past the end of a leaf, the next value is in the nearest ancestor that is not
+                // exhausted. If there is none, this is the end iterator, which stays in the leaf.
+                auto* node = node_;
+                auto index = index_;
+                while (index == node->count)
+                {
+                    if (node->parent == nullptr)
+                    {
+                        return *this;
+                    }
+                    index = node->position;
+                    node = node->parent;
+                }
+                node_ = node;
+                index_ = index;
+                return *this;
+            }
+
+            auto operator++(int) noexcept -> iterator_impl
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            auto operator--() noexcept -> iterator_impl&
+            {
+                if (not node_->leaf)
+                {
+                    node_ = rightmost_leaf(child(node_, index_));
+                    index_ = node_->count - 1u;
+                    return *this;
+                }
+
+                if (index_ > 0)
+                {
+                    --index_;
+                    return *this;
+                }
+
+                // At the start of a leaf, the previous value is in the nearest ancestor
+                // whose subtree this is not the first one of.
+                auto* node = node_;
+                while (node->position == 0)
+                {
+                    node = node->parent;
+                }
+                index_ = node->position - 1u;
+                node_ = node->parent;
+                return *this;
+            }
+
+            auto operator--(int) noexcept -> iterator_impl
+            {
+                auto copy = *this;
+                --*this;
+                return copy;
+            }
+
+            [[nodiscard]] friend auto operator==(iterator_impl const& lhs, iterator_impl const& rhs) noexcept
+            -> bool
+            {
+                return lhs.node_ == rhs.node_ and lhs.index_ == rhs.index_;
+            }
+
+        private:
+            friend class btree;
+            friend class iterator_impl<not Const>;
+
+            leaf_node* node_ = nullptr;
+            size_type index_ = 0;
+
+            iterator_impl(leaf_node* const node, size_type const index) noexcept
+                : node_{node}
+                , index_{index}
+            {
+            }
+        };
+
+        /// A value constructed outside of the tree, and relocated into it once its position is known.
+        class value_holder
+        {
+        public:
+            template <typename... Args>
+            explicit value_holder(Args&& ... args)
+            {
+                std::construct_at(storage_.data(), std::forward<Args>(args)...);
+            }
+
+            value_holder(value_holder const&) = delete;
+            auto operator=(value_holder const&) -> value_holder& = delete;
+
+            ~value_holder()
+            {
+                if (engaged_)
+                {
+                    std::destroy_at(storage_.data());
+                }
+            }
+
+            [[nodiscard]] auto get() noexcept -> value_type&
+            {
+                return *storage_.data();
+            }
+
+            /// The value, which the caller must relocate.
+            [[nodiscard]] auto release() noexcept -> value_type*
+            {
+                engaged_ = false;
+                return storage_.data();
+            }
+
+        private:
+            inline_storage<value_type, 1> storage_;
+            bool engaged_ = true;
+        };
+
+        /// The nodes an insertion into a full leaf may need, allocated before the tree is modified:
+        /// a leaf, an internal node for each full ancestor, and a new root if all of them are full.
+        class spare_nodes
+        {
+        public:
+            spare_nodes(btree& tree, leaf_node const* const full_leaf)
+                : tree_{tree}
+            {
+                try
+                {
+                    nodes_[count_++] = tree_.allocate_node(true);
+                    auto const* ancestor = full_leaf->parent;
+                    while (ancestor != nullptr and ancestor->count == slots_per_node)
+                    {
+                        nodes_[count_++] = tree_.allocate_node(false);
+                        ancestor = ancestor->parent;
+                    }
+                    if (ancestor == nullptr)
+                    {
+                        nodes_[count_++] = tree_.allocate_node(false);
+                    }
+                }
+                catch (...)
+                {
+                    release_remaining();
+                    throw;
+                }
+            }
+
+            spare_nodes(spare_nodes const&) = delete;
+            auto operator=(spare_nodes const&) -> spare_nodes& = delete;
+
+            ~spare_nodes()
+            {
+                release_remaining();
+            }
+
+            /// The leaf first, then internal nodes.
+            [[nodiscard]] auto take() noexcept -> leaf_node*
+            {
+                return nodes_[taken_++];
+            }
+
+        private:
+            btree& tree_;
+            /// The height of a B-tree with at least two children per node cannot exceed the bits of size_type.
+            std::array<leaf_node*, std::numeric_limits<size_type>::digits + 1> nodes_ = {};
+            size_type count_ = 0;
+            size_type taken_ = 0;
+
+            auto release_remaining() noexcept -> void
+            {
+                for (; taken_ < count_; ++taken_)
+                {
+                    tree_.deallocate_node(nodes_[taken_]);
+                }
+            }
+        };
+
+        // Node access
+
+        [[nodiscard]] static auto slot(leaf_node* const node, size_type const index) noexcept -> Value*
+        {
+            return node->slots.data() + index;
+        }
+
+        [[nodiscard]] static auto key_at(leaf_node* const node, size_type const index) noexcept -> Key const&
+        {
+            return KeyOfValue{}(*slot(node, index));
+        }
+
+        [[nodiscard]] static auto child(leaf_node* const node, size_type const index) noexcept -> leaf_node*
+        {
+            return static_cast<internal_node*>(node)->children[index];
+        }
+
+        static auto set_child(leaf_node* const node, size_type const index, leaf_node* const child) noexcept -> void
+        {
+            auto* const parent = static_cast<internal_node*>(node);
+            parent->children[index] = child;
+            child->parent = parent;
+            child->position = static_cast<std::uint16_t>(index);
+        }
+
+        [[nodiscard]] static auto leftmost_leaf(leaf_node* node) noexcept -> leaf_node*
+        {
+            while (not node->leaf)
+            {
+                node = child(node, 0);
+            }
+            return node;
+        }
+
+        [[nodiscard]] static auto rightmost_leaf(leaf_node* node) noexcept -> leaf_node*
+        {
+            while (not node->leaf)
+            {
+                node = child(node, node->count);
+            }
+            return node;
+        }
+
+        [[nodiscard]] auto end_index() const noexcept -> size_type
+        {
+            return rightmost_ != nullptr ? rightmost_->count : 0;
+        }
+
+        // Allocation
+
+        /// Allocates a node without values (and, for internal nodes, without children).
+        [[nodiscard]] auto allocate_node(bool const leaf) -> leaf_node*
+        {
+            leaf_node* node = nullptr;
+            if (leaf)
+            {
+                auto alloc = typename leaf_alloc_traits::allocator_type(alloc_);
+                // Default initialized, leaving the slots uninitialized.
+                node = ::new(static_cast<void*>(leaf_alloc_traits::allocate(alloc, 1))) leaf_node;
+            }
+            else
+            {
+                auto alloc = typename internal_alloc_traits::allocator_type(alloc_);
+                node = ::new(static_cast<void*>(internal_alloc_traits::allocate(alloc, 1))) internal_node;
+            }
+            node->parent = nullptr;
+            node->position = 0;
+            node->count = 0;
+            node->leaf = leaf;
+            return node;
+        }
+
+        auto deallocate_node(leaf_node* const node) noexcept -> void
+        {
+            if (node->leaf)
+            {
+                auto alloc = typename leaf_alloc_traits::allocator_type(alloc_);
+                leaf_alloc_traits::deallocate(alloc, node, 1);
+            }
+            else
+            {
+                auto alloc = typename internal_alloc_traits::allocator_type(alloc_);
+                internal_alloc_traits::deallocate(alloc, static_cast<internal_node*>(node), 1);
+            }
+        }
+
+        auto destroy_subtree(leaf_node* const node) noexcept -> void
+        {
+            std::destroy_n(slot(node, 0), node->count);
+            if (not node->leaf)
+            {
+                for (auto i = size_type{0}; i <= node->count; ++i)
+                {
+                    destroy_subtree(child(node, i));
+                }
+            }
+            deallocate_node(node);
+        }
+
+        /// Takes the nodes of other, which is left empty. This must have no nodes.
+        auto steal_nodes_from(btree& other) noexcept -> void
+        {
+            root_ = std::exchange(other.root_, nullptr);
+            leftmost_ = std::exchange(other.leftmost_, nullptr);
+            rightmost_ = std::exchange(other.rightmost_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+
+        /// Appends the values of [first, last), which must be sorted and greater than all elements,
+        /// without comparing them.
+        template <typename I>
+        auto append_from(I first, I const last) -> void
+        {
+            for (; first != last; ++first)
+            {
+                auto value = value_holder(*first);
+                insert_at(position_before(cend()), value);
+            }
+        }
+
+        // Search
+
+        template <typename K>
+        [[nodiscard]] auto lower_bound_in(leaf_node* const node, K const& key) const -> size_type
+        {
+            auto const* const first = slot(node, 0);
+            return static_cast<size_type>(
+                std::partition_point(
+                    first, first + node->count,
+                    [&](value_type const& value) { return comp_(KeyOfValue{}(value), key); }) - first);
+        }
+
+        template <typename K>
+        [[nodiscard]] auto upper_bound_in(leaf_node* const node, K const& key) const -> size_type
+        {
+            auto const* const first = slot(node, 0);
+            return static_cast<size_type>(
+                std::partition_point(
+                    first, first + node->count,
+                    [&](value_type const& value) { return not comp_(key, KeyOfValue{}(value)); }) - first);
+        }
+
+        /// The position to insert a value with the given key at, after the elements with equivalent keys.
+        template <typename K>
+        [[nodiscard]] auto upper_position(K const& key) const -> position
+        {
+            auto* node = root_;
+            if (node == nullptr)
+            {
+                return {nullptr, 0, false};
+            }
+            while (true)
+            {
+                auto const index = upper_bound_in(node, key);
+                if (node->leaf)
+                {
+                    return {node, index, false};
+                }
+                node = child(node, index);
+            }
+        }
+
+        /// The insertion position right before pos: the end of the rightmost leaf of
+        /// the subtree before pos, if pos is in an internal node.
+        [[nodiscard]] auto position_before(const_iterator const pos) const noexcept -> position
+        {
+            if (pos.node_ == nullptr or pos.node_->leaf)
+            {
+                return {pos.node_, pos.index_, false};
+            }
+            auto* const leaf = rightmost_leaf(child(pos.node_, pos.index_));
+            return {leaf, leaf->count, false};
+        }
+
+        /// Descends from the root with bound, which finds an index within a node,
+        /// and returns the last value found that way (the descent continues before it).
+        template <typename Bound>
+        [[nodiscard]] auto descend(Bound const bound) const -> const_iterator
+        {
+            auto result = end();
+            auto* node = root_;
+            while (node != nullptr)
+            {
+                auto const index = bound(node);
+                if (index < node->count)
+                {
+                    result = const_iterator{node, index};
+                }
+                node = node->leaf ? nullptr : child(node, index);
+            }
+            return result;
+        }
+
+        template <typename K>
+        [[nodiscard]] auto lower_bound_of_key(K const& key) const -> const_iterator
+        {
+            return descend([&](leaf_node* const node) { return lower_bound_in(node, key); });
+        }
+
+        template <typename K>
+        [[nodiscard]] auto upper_bound_of_key(K const& key) const -> const_iterator
+        {
+            return descend([&](leaf_node* const node) { return upper_bound_in(node, key); });
+        }
+
+        template <typename K>
+        [[nodiscard]] auto find_key(K const& key) const -> const_iterator
+        {
+            if constexpr (Multiple)
+            {
+                auto const pos = lower_bound_of_key(key);
+                return pos != end() and not comp_(key, KeyOfValue{}(*pos)) ? pos : end();
+            }
+            else
+            {
+                auto const pos = unique_position(key);
+                return pos.found ? const_iterator{pos.node, pos.index} : end();
+            }
+        }
+
+        template <typename K>
+        [[nodiscard]] auto equal_range_of_key(K const& key) const -> std::pair<const_iterator, const_iterator>
+        {
+            if constexpr (not Multiple and std::same_as<K, key_type>)
+            {
+                // The keys are unique, so the range has at most one element.
+                auto const pos = unique_position(key);
+                if (pos.found)
+                {
+                    auto const first = const_iterator{pos.node, pos.index};
+                    return {first, std::next(first)};
+                }
+                auto const last = lower_bound_of_key(key);
+                return {last, last};
+            }
+            else
+            {
+                return {lower_bound_of_key(key), upper_bound_of_key(key)};
+            }
+        }
+
+        // Insertion
+
+        /// Relocates value to slot index of node, which must not be full.
+        static auto insert_slot(leaf_node* const node, size_type const index, Value* const value) noexcept -> void
+        {
+            relocate(slot(node, index), slot(node, node->count), slot(node, index + 1));
+            relocate_at(value, slot(node, index));
+            ++node->count;
+        }
+
+        /// Relocates separator to slot index of the internal node, which must not be full,
+        /// with right as the child after it.
+        static auto insert_child(
+            leaf_node* const node,
+            size_type const index,
+            Value* const separator,
+            leaf_node* const right) noexcept -> void
+        {
+            for (auto i = size_type{node->count} + 1; i > index + 1; --i)
+            {
+                set_child(node, i, child(node, i - 1));
+            }
+            set_child(node, index + 1, right);
+            insert_slot(node, index, separator);
+        }
+
+        /// Moves the values of the full node after the middle one (and the children after them)
+        /// to sibling, an empty node of the same kind, and the middle value to median.
+        /// If biased, the node keeps all values but the last one instead, which is moved to median,
+        /// so that appending values in order fills the nodes.
+        static auto split(leaf_node* const node, leaf_node* const sibling, Value* const median, bool const biased) noexcept
+        -> void
+        {
+            auto const mid = biased ? slots_per_node - 1 : slots_per_node / 2;
+            auto const sibling_count = slots_per_node - mid - 1;
+            uninitialized_relocate(slot(node, mid + 1), slot(node, slots_per_node), slot(sibling, 0));
+            relocate_at(slot(node, mid), median);
+            if (not node->leaf)
+            {
+                for (auto i = size_type{0}; i <= sibling_count; ++i)
+                {
+                    set_child(sibling, i, child(node, mid + 1 + i));
+                }
+            }
+            node->count = static_cast<std::uint16_t>(mid);
+            sibling->count = static_cast<std::uint16_t>(sibling_count);
+        }
+
+        /// Inserts value at the insertion position pos, splitting the leaf (and its ancestors)
+        /// if it is full. If this throws, nothing is changed.
+        auto insert_at(position const pos, value_holder& value) -> iterator
+        {
+            if (pos.node == nullptr)
+            {
+                auto* const leaf = allocate_node(true);
+                relocate_at(value.release(), slot(leaf, 0));
+                leaf->count = 1;
+                root_ = leaf;
+                leftmost_ = leaf;
+                rightmost_ = leaf;
+                size_ = 1;
+                return iterator{leaf, 0};
+            }
+
+            auto* const node = pos.node;
+            if (node->count < slots_per_node)
+            {
+                insert_slot(node, pos.index, value.release());
+                ++size_;
+                return iterator{node, pos.index};
+            }
+
+            auto spare = spare_nodes{*this, node};
+            auto const append = node == rightmost_ and pos.index == node->count;
+            auto* const sibling = spare.take();
+            auto median = inline_storage<Value, 1>{};
+            split(node, sibling, median.data(), append);
+            if (rightmost_ == node)
+            {
+                rightmost_ = sibling;
+            }
+
+            auto const mid = size_type{node->count};
+            auto* const target = pos.index <= mid ? node : sibling;
+            auto const target_index = pos.index <= mid ? pos.index : pos.index - mid - 1;
+            insert_slot(target, target_index, value.release());
+            insert_separator(node, median.data(), sibling, spare, append);
+            ++size_;
+            return iterator{target, target_index};
+        }
+
+        /// Inserts separator into the parent of left, after left, with right as the child after it.
+        /// Splits the parent if it is full, and adds a new root if left is the root.
+        auto insert_separator(
+            leaf_node* const left,
+            Value* const separator,
+            leaf_node* const right,
+            spare_nodes& spare,
+            bool const append) noexcept -> void
+        {
+            auto* const parent = left->parent;
+            if (parent == nullptr)
+            {
+                auto* const root = spare.take();
+                relocate_at(separator, slot(root, 0));
+                root->count = 1;
+                set_child(root, 0, left);
+                set_child(root, 1, right);
+                root_ = root;
+                return;
+            }
+
+            auto const index = size_type{left->position};
+            if (parent->count < slots_per_node)
+            {
+                insert_child(parent, index, separator, right);
+                return;
+            }
+
+            auto* const sibling = spare.take();
+            auto median = inline_storage<Value, 1>{};
+            split(parent, sibling, median.data(), append);
+            auto const mid = size_type{parent->count};
+            if (index <= mid)
+            {
+                insert_child(parent, index, separator, right);
+            }
+            else
+            {
+                insert_child(sibling, index - mid - 1, separator, right);
+            }
+            insert_separator(parent, median.data(), sibling, spare, append);
+        }
+
+        // Erasure
+
+        /// Erases the element at pos, and returns an iterator to the element after it.
+        auto erase_at(const_iterator const pos) noexcept -> iterator
+        {
+            auto* const node = pos.node_;
+            auto const index = pos.index_;
+            leaf_node* leaf = nullptr;
+            auto next = iterator{};
+            if (node->leaf)
+            {
+                std::destroy_at(slot(node, index));
+                relocate(slot(node, index + 1), slot(node, node->count), slot(node, index));
+                --node->count;
+                leaf = node;
+                next = iterator{node, index};
+            }
+            else
+            {
+                // Values are only removed from leaves: the value is replaced with its predecessor,
+                // the last value of the rightmost leaf of the subtree before it.
+                leaf = rightmost_leaf(child(node, index));
+                std::destroy_at(slot(node, index));
+                relocate_at(slot(leaf, leaf->count - 1u), slot(node, index));
+                --leaf->count;
+                next = std::next(iterator{node, index});
+            }
+            --size_;
+
+            rebalance(leaf, next);
+            return normalized(next);
+        }
+
+        /// Restores the minimum number of values in node and its ancestors after an erasure,
+        /// by moving a value from a sibling through the parent, or by merging with a sibling.
+        /// Keeps pos pointing to the same value (or to the same place past the end of a leaf).
+        auto rebalance(leaf_node* node, iterator& pos) noexcept -> void
+        {
+            while (node->parent != nullptr)
+            {
+                if (node->count >= min_slots)
+                {
+                    return;
+                }
+
+                auto* const parent = node->parent;
+                auto const index = size_type{node->position};
+                auto* const left = index > 0 ? child(parent, index - 1) : nullptr;
+                auto* const right = index < parent->count ? child(parent, index + 1) : nullptr;
+                if (left != nullptr and left->count > min_slots)
+                {
+                    rotate_right(left, node, pos);
+                    return;
+                }
+                if (right != nullptr and right->count > min_slots)
+                {
+                    rotate_left(node, right, pos);
+                    return;
+                }
+                if (left != nullptr)
+                {
+                    merge(left, node, pos);
+                }
+                else
+                {
+                    merge(node, right, pos);
+                }
+                node = parent;
+            }
+
+            // The root may become empty.
+            if (node->count == 0)
+            {
+                if (node->leaf)
+                {
+                    root_ = nullptr;
+                    leftmost_ = nullptr;
+                    rightmost_ = nullptr;
+                    pos = iterator{};
+                }
+                else
+                {
+                    root_ = child(node, 0);
+                    root_->parent = nullptr;
+                    root_->position = 0;
+                }
+                deallocate_node(node);
+            }
+        }
+
+        /// Moves the last value of left to the parent, and the separator in the parent to the front
+        /// of its right sibling node.
+        static auto rotate_right(leaf_node* const left, leaf_node* const node, iterator& pos) noexcept -> void
+        {
+            auto* const parent = node->parent;
+            auto const separator = size_type{left->position};
+            relocate(slot(node, 0), slot(node, node->count), slot(node, 1));
+            relocate_at(slot(parent, separator), slot(node, 0));
+            relocate_at(slot(left, left->count - 1u), slot(parent, separator));
+            if (not node->leaf)
+            {
+                for (auto i = size_type{node->count} + 1; i > 0; --i)
+                {
+                    set_child(node, i, child(node, i - 1));
+                }
+                set_child(node, 0, child(left, left->count));
+            }
+            --left->count;
+            ++node->count;
+
+            if (pos.node_ == node)
+            {
+                ++pos.index_;
+            }
+            else if (pos.node_ == parent and pos.index_ == separator)
+            {
+                pos = iterator{node, 0};
+            }
+            else if (pos.node_ == left and pos.index_ == left->count)
+            {
+                pos = iterator{parent, separator};
+            }
+        }
+
+        /// Moves the separator in the parent to the end of node, and the first value of its right
+        /// sibling right to the parent.
+        static auto rotate_left(leaf_node* const node, leaf_node* const right, iterator& pos) noexcept -> void
+        {
+            auto* const parent = node->parent;
+            auto const separator = size_type{node->position};
+            relocate_at(slot(parent, separator), slot(node, node->count));
+            relocate_at(slot(right, 0), slot(parent, separator));
+            relocate(slot(right, 1), slot(right, right->count), slot(right, 0));
+            if (not node->leaf)
+            {
+                set_child(node, node->count + 1u, child(right, 0));
+                for (auto i = size_type{0}; i < right->count; ++i)
+                {
+                    set_child(right, i, child(right, i + 1));
+                }
+            }
+            ++node->count;
+            --right->count;
+
+            if (pos.node_ == right)
+            {
+                if (pos.index_ == 0)
+                {
+                    pos = iterator{parent, separator};
+                }
+                else
+                {
+                    --pos.index_;
+                }
+            }
+            else if (pos.node_ == parent and pos.index_ == separator)
+            {
+                pos = iterator{node, node->count - 1u};
+            }
+        }
+
+        /// Moves the separator in the parent and the values (and children) of right, the right
+        /// sibling of left, to left, and deallocates right.
+        auto merge(leaf_node* const left, leaf_node* const right, iterator& pos) noexcept -> void
+        {
+            auto* const parent = left->parent;
+            auto const separator = size_type{left->position};
+            auto const left_count = size_type{left->count};
+            relocate_at(slot(parent, separator), slot(left, left_count));
+            uninitialized_relocate(slot(right, 0), slot(right, right->count), slot(left, left_count + 1));
+            if (not left->leaf)
+            {
+                for (auto i = size_type{0}; i <= right->count; ++i)
+                {
+                    set_child(left, left_count + 1 + i, child(right, i));
+                }
+            }
+            left->count = static_cast<std::uint16_t>(left_count + 1 + right->count);
+
+            relocate(slot(parent, separator + 1), slot(parent, parent->count), slot(parent, separator));
+            for (auto i = separator + 1; i < parent->count; ++i)
+            {
+                set_child(parent, i, child(parent, i + 1));
+            }
+            --parent->count;
+
+            if (pos.node_ == right)
+            {
+                pos = iterator{left, left_count + 1 + pos.index_};
+            }
+            else if (pos.node_ == parent and pos.index_ >= separator)
+            {
+                pos = pos.index_ == separator ? iterator{left, left_count} : iterator{parent, pos.index_ - 1};
+            }
+
+            if (rightmost_ == right)
+            {
+                rightmost_ = left;
+            }
+            deallocate_node(right);
+        }
+
+        /// Moves an iterator past the end of a leaf (other than the last one) to the next value.
+        [[nodiscard]] auto normalized(iterator pos) const noexcept -> iterator
+        {
+            if (pos.node_ != nullptr and pos.node_->leaf and pos.index_ == pos.node_->count)
+            {
+                --pos.index_;
+                ++pos;
+            }
+            return pos;
+        }
+    };
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+
+namespace more_concepts::detail
+{
+    /// The assumed size of a cache line. Data written by different threads is aligned to it,
+    /// so that the threads do not invalidate each other's cache lines (false sharing).
+    /// (std::hardware_destructive_interference_size is not ABI-stable, and not provided by all compilers.)
+    inline constexpr std::size_t cache_line_size = 64;
+}
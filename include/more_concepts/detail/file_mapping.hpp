@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace more_concepts::detail
+{
+    /// A whole file mapped read-only into memory (with POSIX mmap). The pages are shared
+    /// with every other process mapping the same file, and are only read from disk when touched.
+    class file_mapping
+    {
+    public:
+        /// Throws std::system_error if the file cannot be opened or mapped.
+        explicit file_mapping(std::filesystem::path const& path)
+        {
+            auto const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd == -1)
+            {
+                throw_error(path);
+            }
+
+            struct ::stat status = {};
+            if (::fstat(fd, &status) == -1)
+            {
+                auto const error = errno;
+                ::close(fd);
+                errno = error;
+                throw_error(path);
+            }
+
+            size_ = static_cast<std::size_t>(status.st_size);
+            if (size_ > 0)
+            {
+                address_ = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+            }
+            auto const error = errno;
+            // The mapping stays valid after the file is closed.
+            ::close(fd);
+            if (address_ == MAP_FAILED)
+            {
+                errno = error;
+                throw_error(path);
+            }
+        }
+
+        file_mapping(file_mapping const&) = delete;
+        auto operator=(file_mapping const&) -> file_mapping& = delete;
+
+        ~file_mapping()
+        {
+            if (size_ > 0)
+            {
+                ::munmap(address_, size_);
+            }
+        }
+
+        [[nodiscard]] auto bytes() const noexcept -> std::span<std::byte const>
+        {
+            return {static_cast<std::byte const*>(address_), size_};
+        }
+
+    private:
+        void* address_ = nullptr;
+        std::size_t size_ = 0;
+
+        [[noreturn]] static auto throw_error(std::filesystem::path const& path) -> void
+        {
+            throw std::system_error{
+                errno, std::generic_category(), "more_concepts::file_mapping: cannot map " + path.string()};
+        }
+    };
+}
@@ -0,0 +1,561 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/base_concepts.hpp"
+#include "more_concepts/detail/synth_three_way.hpp"
+#include "more_concepts/sequence_containers.hpp"
+#include "more_concepts/sorted_insert.hpp"
+
+namespace more_concepts::detail
+{
+    /// Containers that can hold the sorted elements of a flat associative container.
+    template <typename Container, typename Value>
+    concept flat_tree_storage
+    = random_access_container_of<Container, Value> and
+      resizable_sequence_container<Container>;
+
+    /// Common implementation of flat_map and flat_set: a sorted sequence of values with unique keys,
+    /// stored in a random access container, and searched with binary search.
+    ///
+    /// KeyOfValue extracts the key from a value. If MutableIterators is false,
+    /// iterator is the same type as const_iterator.
+    template <
+        typename Key,
+        typename Value,
+        typename KeyOfValue,
+        typename Compare,
+        flat_tree_storage<Value> Container,
+        bool MutableIterators>
+    class flat_tree
+    {
+    public:
+        using key_type = Key;
+        using value_type = Value;
+        using key_compare = Compare;
+        using container_type = Container;
+        using size_type = typename Container::size_type;
+        using difference_type = typename Container::difference_type;
+        using reference = value_type&;
+        using const_reference = value_type const&;
+        using iterator = std::conditional_t<
+            MutableIterators,
+            typename Container::iterator,
+            typename Container::const_iterator>;
+        using const_iterator = typename Container::const_iterator;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        flat_tree() = default;
+
+        explicit flat_tree(key_compare const& comp)
+            : comp_{comp}
+        {
+        }
+
+        /// Takes ownership of the elements of storage, which do not need to be sorted.
+        /// Of multiple elements with equivalent keys, only the first one is kept.
+        explicit flat_tree(container_type storage, key_compare const& comp = key_compare())
+            : storage_{std::move(storage)}
+            , comp_{comp}
+        {
+            sort_and_unique(storage_.begin());
+        }
+
+        template <std::input_iterator I>
+        flat_tree(I const first, I const last, key_compare const& comp = key_compare())
+            : comp_{comp}
+        {
+            insert(first, last);
+        }
+
+        /// Takes ownership of the elements of storage, which must be sorted and free of
+        /// equivalent keys (checked in debug builds).
+        flat_tree(sorted_unique_t, container_type storage, key_compare const& comp = key_compare())
+            : storage_{std::move(storage)}
+            , comp_{comp}
+        {
+            assert_sorted<true>(storage_.begin());
+        }
+
+        /// Copies the elements of [first, last), which must be sorted and free of
+        /// equivalent keys (checked in debug builds).
+        template <std::input_iterator I>
+        flat_tree(sorted_unique_t, I const first, I const last, key_compare const& comp = key_compare())
+            : storage_(first, last)
+            , comp_{comp}
+        {
+            assert_sorted<true>(storage_.begin());
+        }
+
+        flat_tree(std::initializer_list<value_type> const init_list, key_compare const& comp = key_compare())
+            : flat_tree(init_list.begin(), init_list.end(), comp)
+        {
+        }
+
+        // Iterators
+
+        [[nodiscard]] auto begin() noexcept -> iterator { return storage_.begin(); }
+
+        [[nodiscard]] auto begin() const noexcept -> const_iterator { return storage_.begin(); }
+
+        [[nodiscard]] auto cbegin() const noexcept -> const_iterator { return storage_.cbegin(); }
+
+        [[nodiscard]] auto end() noexcept -> iterator { return storage_.end(); }
+
+        [[nodiscard]] auto end() const noexcept -> const_iterator { return storage_.end(); }
+
+        [[nodiscard]] auto cend() const noexcept -> const_iterator { return storage_.cend(); }
+
+        [[nodiscard]] auto rbegin() noexcept -> reverse_iterator { return reverse_iterator{end()}; }
+
+        [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator { return crbegin(); }
+
+        [[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator{cend()}; }
+
+        [[nodiscard]] auto rend() noexcept -> reverse_iterator { return reverse_iterator{begin()}; }
+
+        [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator { return crend(); }
+
+        [[nodiscard]] auto crend() const noexcept -> const_reverse_iterator { return const_reverse_iterator{cbegin()}; }
+
+        // Capacity
+
+        [[nodiscard]] auto empty() const noexcept -> bool { return storage_.empty(); }
+
+        [[nodiscard]] auto size() const noexcept -> size_type { return storage_.size(); }
+
+        [[nodiscard]] auto max_size() const noexcept -> size_type { return storage_.max_size(); }
+
+        auto reserve(size_type const new_capacity) -> void
+        requires requires(container_type& storage) { storage.reserve(new_capacity); }
+        {
+            storage_.reserve(new_capacity);
+        }
+
+        auto shrink_to_fit() -> void
+        requires requires(container_type& storage) { storage.shrink_to_fit(); }
+        {
+            storage_.shrink_to_fit();
+        }
+
+        // Observers
+
+        [[nodiscard]] auto key_comp() const -> key_compare { return comp_; }
+
+        /// The underlying sorted sequence.
+        [[nodiscard]] auto sequence() const noexcept -> container_type const& { return storage_; }
+
+        // Lookup
+        //
+        // With a transparent comparator, the lookup functions also accept any key type K
+        // comparable with key_type, without converting it.
+
+        [[nodiscard]] auto find(key_type const& key) -> iterator
+        {
+            return to_iterator(find_key(key));
+        }
+
+        [[nodiscard]] auto find(key_type const& key) const -> const_iterator
+        {
+            return find_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto find(K const& key) -> iterator
+        {
+            return to_iterator(find_key(key));
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto find(K const& key) const -> const_iterator
+        {
+            return find_key(key);
+        }
+
+        [[nodiscard]] auto count(key_type const& key) const -> size_type
+        {
+            return find_key(key) != end() ? 1 : 0;
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto count(K const& key) const -> size_type
+        {
+            // A transparent comparator may consider several keys equivalent to key.
+            auto const [first, last] = equal_range_of_key(key);
+            return static_cast<size_type>(std::distance(first, last));
+        }
+
+        [[nodiscard]] auto contains(key_type const& key) const -> bool
+        {
+            return find_key(key) != end();
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto contains(K const& key) const -> bool
+        {
+            return find_key(key) != end();
+        }
+
+        [[nodiscard]] auto lower_bound(key_type const& key) -> iterator
+        {
+            return to_iterator(lower_bound_of_key(key));
+        }
+
+        [[nodiscard]] auto lower_bound(key_type const& key) const -> const_iterator
+        {
+            return lower_bound_of_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto lower_bound(K const& key) -> iterator
+        {
+            return to_iterator(lower_bound_of_key(key));
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto lower_bound(K const& key) const -> const_iterator
+        {
+            return lower_bound_of_key(key);
+        }
+
+        [[nodiscard]] auto upper_bound(key_type const& key) -> iterator
+        {
+            return to_iterator(upper_bound_of_key(key));
+        }
+
+        [[nodiscard]] auto upper_bound(key_type const& key) const -> const_iterator
+        {
+            return upper_bound_of_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto upper_bound(K const& key) -> iterator
+        {
+            return to_iterator(upper_bound_of_key(key));
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto upper_bound(K const& key) const -> const_iterator
+        {
+            return upper_bound_of_key(key);
+        }
+
+        [[nodiscard]] auto equal_range(key_type const& key) -> std::pair<iterator, iterator>
+        {
+            auto const [first, last] = equal_range_of_key(key);
+            return {to_iterator(first), to_iterator(last)};
+        }
+
+        [[nodiscard]] auto equal_range(key_type const& key) const -> std::pair<const_iterator, const_iterator>
+        {
+            return equal_range_of_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto equal_range(K const& key) -> std::pair<iterator, iterator>
+        {
+            auto const [first, last] = equal_range_of_key(key);
+            return {to_iterator(first), to_iterator(last)};
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto equal_range(K const& key) const -> std::pair<const_iterator, const_iterator>
+        {
+            return equal_range_of_key(key);
+        }
+
+        // Modifiers
+
+        auto insert(value_type const& value) -> std::pair<iterator, bool>
+        {
+            return insert_unique(value_type(value));
+        }
+
+        auto insert(value_type&& value) -> std::pair<iterator, bool>
+        {
+            return insert_unique(std::move(value));
+        }
+
+        auto insert(const_iterator const hint, value_type const& value) -> iterator
+        {
+            return insert_unique(hint, value_type(value));
+        }
+
+        auto insert(const_iterator const hint, value_type&& value) -> iterator
+        {
+            return insert_unique(hint, std::move(value));
+        }
+
+        /// Appends the elements to the end of the sequence, sorts them, and merges them
+        /// with the existing ones. Elements with keys already present are not inserted.
+        template <std::input_iterator I>
+        auto insert(I const first, I const last) -> void
+        {
+            auto const old_size = static_cast<difference_type>(storage_.size());
+            storage_.insert(storage_.end(), first, last);
+            sort_and_unique(storage_.begin() + old_size);
+        }
+
+        auto insert(std::initializer_list<value_type> const init_list) -> void
+        {
+            insert(init_list.begin(), init_list.end());
+        }
+
+        /// Inserts the elements of [first, last), which must be sorted and free of equivalent keys
+        /// (checked in debug builds), in linear time: they are appended and merged in without sorting.
+        template <std::input_iterator I>
+        auto insert(sorted_unique_t, I const first, I const last) -> void
+        {
+            auto const old_size = static_cast<difference_type>(storage_.size());
+            storage_.insert(storage_.end(), first, last);
+            assert_sorted<true>(storage_.begin() + old_size);
+            merge_and_unique(storage_.begin() + old_size);
+        }
+
+        /// Inserts the elements of [first, last), which must be sorted (checked in debug builds),
+        /// in linear time. Of multiple elements with equivalent keys, only the first one is kept.
+        template <std::input_iterator I>
+        auto insert(sorted_equivalent_t, I const first, I const last) -> void
+        {
+            auto const old_size = static_cast<difference_type>(storage_.size());
+            storage_.insert(storage_.end(), first, last);
+            assert_sorted<false>(storage_.begin() + old_size);
+            merge_and_unique(storage_.begin() + old_size);
+        }
+
+        template <typename... Args>
+        auto emplace(Args&& ... args) -> std::pair<iterator, bool>
+        {
+            return insert_unique(value_type(std::forward<Args>(args)...));
+        }
+
+        template <typename... Args>
+        auto emplace_hint(const_iterator const hint, Args&& ... args) -> iterator
+        {
+            return insert_unique(hint, value_type(std::forward<Args>(args)...));
+        }
+
+        auto erase(iterator const pos) -> iterator
+        requires MutableIterators
+        {
+            return storage_.erase(pos);
+        }
+
+        auto erase(const_iterator const pos) -> iterator
+        {
+            return storage_.erase(pos);
+        }
+
+        auto erase(const_iterator const first, const_iterator const last) -> iterator
+        {
+            return storage_.erase(first, last);
+        }
+
+        auto erase(key_type const& key) -> size_type
+        {
+            auto const [first, last] = equal_range(key);
+            auto const count = static_cast<size_type>(last - first);
+            storage_.erase(first, last);
+            return count;
+        }
+
+        auto clear() noexcept -> void
+        {
+            storage_.clear();
+        }
+
+        auto swap(flat_tree& other) noexcept(std::is_nothrow_swappable_v<container_type> and
+                                             std::is_nothrow_swappable_v<key_compare>) -> void
+        {
+            using std::swap;
+            swap(storage_, other.storage_);
+            swap(comp_, other.comp_);
+        }
+
+        /// Moves the underlying sorted sequence out, leaving the container empty.
+        [[nodiscard]] auto extract() && -> container_type
+        {
+            auto result = std::move(storage_);
+            storage_.clear();
+            return result;
+        }
+
+        /// Replaces the underlying sequence, which must be sorted and free of equivalent keys.
+        auto replace(container_type&& storage) -> void
+        {
+            storage_ = std::move(storage);
+        }
+
+        // Comparison
+
+        friend auto operator==(flat_tree const& lhs, flat_tree const& rhs) -> bool
+        requires std::equality_comparable<value_type>
+        {
+            return lhs.storage_.size() == rhs.storage_.size() and
+                   std::equal(lhs.storage_.begin(), lhs.storage_.end(), rhs.storage_.begin());
+        }
+
+        friend auto operator<=>(flat_tree const& lhs, flat_tree const& rhs)
+        requires requires(value_type const& value) { synth_three_way(value, value); }
+        {
+            return std::lexicographical_compare_three_way(
+                lhs.storage_.begin(), lhs.storage_.end(),
+                rhs.storage_.begin(), rhs.storage_.end(),
+                synth_three_way);
+        }
+
+        friend auto swap(flat_tree& lhs, flat_tree& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void
+        {
+            lhs.swap(rhs);
+        }
+
+    protected:
+        [[nodiscard]] auto to_iterator(const_iterator const pos) -> iterator
+        {
+            return storage_.begin() + (pos - storage_.cbegin());
+        }
+
+        [[nodiscard]] auto key_at_equals(const_iterator const pos, key_type const& key) const -> bool
+        {
+            return pos != end() and not comp_(key, KeyOfValue{}(*pos));
+        }
+
+        /// Inserts value at pos if no element with an equivalent key exists. The key of value
+        /// must not be less than the key at pos - 1, and not greater than the key at pos.
+        auto insert_unique_at(const_iterator const pos, value_type&& value) -> std::pair<iterator, bool>
+        {
+            if (key_at_equals(pos, KeyOfValue{}(value)))
+            {
+                return {to_iterator(pos), false};
+            }
+            return {storage_.insert(pos, std::move(value)), true};
+        }
+
+        auto insert_unique(value_type&& value) -> std::pair<iterator, bool>
+        {
+            auto const pos = lower_bound(KeyOfValue{}(value));
+            return insert_unique_at(pos, std::move(value));
+        }
+
+        auto insert_unique(const_iterator const hint, value_type&& value) -> iterator
+        {
+            auto const& key = KeyOfValue{}(value);
+            if ((hint == begin() or comp_(KeyOfValue{}(*std::prev(hint)), key)) and
+                (hint == end() or not comp_(KeyOfValue{}(*hint), key)))
+            {
+                return insert_unique_at(hint, std::move(value)).first;
+            }
+            return insert_unique(std::move(value)).first;
+        }
+
+        [[nodiscard]] auto storage() noexcept -> container_type& { return storage_; }
+
+        [[nodiscard]] auto compare() const noexcept -> key_compare const& { return comp_; }
+
+    private:
+        container_type storage_ = {};
+        [[no_unique_address]] key_compare comp_ = {};
+
+        template <typename K>
+        [[nodiscard]] auto lower_bound_of_key(K const& key) const -> const_iterator
+        {
+            return std::partition_point(
+                storage_.begin(), storage_.end(),
+                [&](value_type const& value) { return comp_(KeyOfValue{}(value), key); });
+        }
+
+        template <typename K>
+        [[nodiscard]] auto upper_bound_of_key(K const& key) const -> const_iterator
+        {
+            return std::partition_point(
+                storage_.begin(), storage_.end(),
+                [&](value_type const& value) { return not comp_(key, KeyOfValue{}(value)); });
+        }
+
+        template <typename K>
+        [[nodiscard]] auto find_key(K const& key) const -> const_iterator
+        {
+            auto const pos = lower_bound_of_key(key);
+            return pos != end() and not comp_(key, KeyOfValue{}(*pos)) ? pos : end();
+        }
+
+        template <typename K>
+        [[nodiscard]] auto equal_range_of_key(K const& key) const -> std::pair<const_iterator, const_iterator>
+        {
+            auto const first = lower_bound_of_key(key);
+            if constexpr (std::same_as<K, key_type>)
+            {
+                // The keys are unique, so the range has at most one element.
+                auto const last = first != end() and not comp_(key, KeyOfValue{}(*first)) ? std::next(first) : first;
+                return {first, last};
+            }
+            else
+            {
+                auto const last = std::partition_point(
+                    first, storage_.cend(),
+                    [&](value_type const& value) { return not comp_(key, KeyOfValue{}(value)); });
+                return {first, last};
+            }
+        }
+
+        /// Sorts the unsorted elements starting at first_unsorted, merges them into the sorted
+        /// elements before it, and removes elements with equivalent keys. Sorting and merging
+        /// are stable, so of multiple equivalent elements, the one that came first is kept.
+        auto sort_and_unique(typename container_type::iterator const first_unsorted) -> void
+        {
+            auto const value_comp = [&](value_type const& lhs, value_type const& rhs) {
+                return comp_(KeyOfValue{}(lhs), KeyOfValue{}(rhs));
+            };
+
+            std::stable_sort(first_unsorted, storage_.end(), value_comp);
+            merge_and_unique(first_unsorted);
+        }
+
+        /// Asserts that the elements starting at first are sorted (strictly, if Unique).
+        template <bool Unique>
+        auto assert_sorted([[maybe_unused]] typename container_type::iterator const first) -> void
+        {
+            assert(std::adjacent_find(
+                       first, storage_.end(),
+                       [&](value_type const& lhs, value_type const& rhs) {
+                           return Unique ? not comp_(KeyOfValue{}(lhs), KeyOfValue{}(rhs))
+                                         : comp_(KeyOfValue{}(rhs), KeyOfValue{}(lhs));
+                       }) == storage_.end() and
+                   "the elements must be sorted");
+        }
+
+        /// Merges the sorted elements starting at first_new into the sorted elements before it,
+        /// and removes elements with equivalent keys, keeping the first one.
+        auto merge_and_unique(typename container_type::iterator const first_new) -> void
+        {
+            auto const value_comp = [&](value_type const& lhs, value_type const& rhs) {
+                return comp_(KeyOfValue{}(lhs), KeyOfValue{}(rhs));
+            };
+
+            std::inplace_merge(storage_.begin(), first_new, storage_.end(), value_comp);
+
+            auto const new_end = std::unique(
+                storage_.begin(), storage_.end(),
+                [&](value_type const& lhs, value_type const& rhs) { return not value_comp(lhs, rhs); });
+            storage_.erase(new_end, storage_.end());
+        }
+    };
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+namespace more_concepts::detail
+{
+    /// Extracts the key from a map element.
+    struct pair_first
+    {
+        template <typename Pair>
+        constexpr auto operator()(Pair const& pair) const noexcept -> auto const&
+        {
+            return pair.first;
+        }
+    };
+
+    /// Extracts the key from a set element: the element itself.
+    struct identity_key
+    {
+        template <typename Value>
+        constexpr auto operator()(Value const& value) const noexcept -> Value const&
+        {
+            return value;
+        }
+    };
+}
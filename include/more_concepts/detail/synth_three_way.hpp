@@ -0,0 +1,44 @@
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <utility>
+
+namespace more_concepts::detail
+{
+    /// Three-way comparison of values that may only provide operator<, the way the standard
+    /// containers compare their elements (the exposition-only synth-three-way).
+    struct synth_three_way_fn
+    {
+        template <typename T, typename U>
+        requires requires(T const& lhs, U const& rhs)
+        {
+            { lhs < rhs } -> std::convertible_to<bool>;
+            { rhs < lhs } -> std::convertible_to<bool>;
+        }
+        constexpr auto operator()(T const& lhs, U const& rhs) const
+        {
+            if constexpr (std::three_way_comparable_with<T, U>)
+            {
+                return lhs <=> rhs;
+            }
+            else
+            {
+                if (lhs < rhs)
+                {
+                    return std::weak_ordering::less;
+                }
+                if (rhs < lhs)
+                {
+                    return std::weak_ordering::greater;
+                }
+                return std::weak_ordering::equivalent;
+            }
+        }
+    };
+
+    inline constexpr auto synth_three_way = synth_three_way_fn{};
+
+    template <typename T, typename U = T>
+    using synth_three_way_result = decltype(synth_three_way(std::declval<T const&>(), std::declval<U const&>()));
+}
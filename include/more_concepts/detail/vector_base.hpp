@@ -0,0 +1,687 @@
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/detail/synth_three_way.hpp"
+#include "more_concepts/relocation.hpp"
+
+namespace more_concepts::detail
+{
+    /// Uninitialized storage for N objects of type T.
+    template <typename T, std::size_t N>
+    struct inline_storage
+    {
+        alignas(T) std::byte bytes[N * sizeof(T)];
+
+        [[nodiscard]] auto data() noexcept -> T*
+        {
+            return reinterpret_cast<T*>(bytes);
+        }
+
+        [[nodiscard]] auto data() const noexcept -> T const*
+        {
+            return reinterpret_cast<T const*>(bytes);
+        }
+    };
+
+    template <typename T>
+    struct inline_storage<T, 0>
+    {
+        [[nodiscard]] auto data() const noexcept -> T*
+        {
+            return nullptr;
+        }
+    };
+
+    /// Versions of the uninitialized memory algorithms that can be used in constant evaluation.
+    /// If a constructor throws, the objects constructed so far are destroyed.
+    template <typename T>
+    constexpr auto construct_fill_n(T* const first, std::size_t const count, T const& value) -> T*
+    {
+        if (not std::is_constant_evaluated())
+        {
+            return std::uninitialized_fill_n(first, count, value);
+        }
+
+        auto* current = first;
+        try
+        {
+            for (auto* const last = first + count; current != last; ++current)
+            {
+                std::construct_at(current, value);
+            }
+        }
+        catch (...)
+        {
+            std::destroy(first, current);
+            throw;
+        }
+        return current;
+    }
+
+    template <typename T>
+    constexpr auto construct_value_n(T* const first, std::size_t const count) -> T*
+    {
+        if (not std::is_constant_evaluated())
+        {
+            return std::uninitialized_value_construct_n(first, count);
+        }
+
+        auto* current = first;
+        try
+        {
+            for (auto* const last = first + count; current != last; ++current)
+            {
+                std::construct_at(current);
+            }
+        }
+        catch (...)
+        {
+            std::destroy(first, current);
+            throw;
+        }
+        return current;
+    }
+
+    template <std::input_iterator I, std::sentinel_for<I> S, typename T>
+    constexpr auto construct_copy(I first, S const last, T* const d_first) -> T*
+    {
+        if (not std::is_constant_evaluated())
+        {
+            return std::ranges::uninitialized_copy(
+                std::move(first), last, d_first, std::unreachable_sentinel).out;
+        }
+
+        auto* current = d_first;
+        try
+        {
+            for (; first != last; ++first, ++current)
+            {
+                std::construct_at(current, *first);
+            }
+        }
+        catch (...)
+        {
+            std::destroy(d_first, current);
+            throw;
+        }
+        return current;
+    }
+
+    /// The interface of a contiguous vector, implemented on top of storage owned by Derived.
+    /// Derived provides:
+    /// - data(), size(), capacity() and max_size(),
+    /// - set_size(n), called after constructing or destroying elements at the end,
+    /// - allocate_buffer(n) and deallocate_buffer(buffer, n), managing uninitialized storage for n elements,
+    /// - adopt_buffer(buffer, n), replacing the current storage, whose elements have been relocated to buffer or destroyed,
+    /// - throw_capacity_exceeded(), called if more than max_size() elements are requested.
+    ///
+    /// Reallocation relocates the elements (see relocation.hpp) if that cannot throw; otherwise,
+    /// they are copied (or moved, if they are not copyable), and the vector is unchanged if that throws.
+    template <typename Derived, typename T>
+    class vector_base
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = T const&;
+        using pointer = T*;
+        using const_pointer = T const*;
+        using iterator = T*;
+        using const_iterator = T const*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        // Iterators
+
+        [[nodiscard]] constexpr auto begin() noexcept -> iterator
+        {
+            return derived().data();
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator
+        {
+            return derived().data();
+        }
+
+        [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator
+        {
+            return begin();
+        }
+
+        [[nodiscard]] constexpr auto end() noexcept -> iterator
+        {
+            return derived().data() + derived().size();
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept -> const_iterator
+        {
+            return derived().data() + derived().size();
+        }
+
+        [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator
+        {
+            return end();
+        }
+
+        [[nodiscard]] constexpr auto rbegin() noexcept -> reverse_iterator
+        {
+            return reverse_iterator{end()};
+        }
+
+        [[nodiscard]] constexpr auto rbegin() const noexcept -> const_reverse_iterator
+        {
+            return const_reverse_iterator{end()};
+        }
+
+        [[nodiscard]] constexpr auto crbegin() const noexcept -> const_reverse_iterator
+        {
+            return rbegin();
+        }
+
+        [[nodiscard]] constexpr auto rend() noexcept -> reverse_iterator
+        {
+            return reverse_iterator{begin()};
+        }
+
+        [[nodiscard]] constexpr auto rend() const noexcept -> const_reverse_iterator
+        {
+            return const_reverse_iterator{begin()};
+        }
+
+        [[nodiscard]] constexpr auto crend() const noexcept -> const_reverse_iterator
+        {
+            return rend();
+        }
+
+        // Element access
+
+        [[nodiscard]] constexpr auto operator[](size_type const pos) noexcept -> reference
+        {
+            return derived().data()[pos];
+        }
+
+        [[nodiscard]] constexpr auto operator[](size_type const pos) const noexcept -> const_reference
+        {
+            return derived().data()[pos];
+        }
+
+        [[nodiscard]] constexpr auto at(size_type const pos) -> reference
+        {
+            if (pos >= derived().size())
+            {
+                throw std::out_of_range{"more_concepts::vector_base::at: index out of range"};
+            }
+            return derived().data()[pos];
+        }
+
+        [[nodiscard]] constexpr auto at(size_type const pos) const -> const_reference
+        {
+            return const_cast<vector_base&>(*this).at(pos);
+        }
+
+        [[nodiscard]] constexpr auto front() noexcept -> reference
+        {
+            return *begin();
+        }
+
+        [[nodiscard]] constexpr auto front() const noexcept -> const_reference
+        {
+            return *begin();
+        }
+
+        [[nodiscard]] constexpr auto back() noexcept -> reference
+        {
+            return *(end() - 1);
+        }
+
+        [[nodiscard]] constexpr auto back() const noexcept -> const_reference
+        {
+            return *(end() - 1);
+        }
+
+        // Capacity
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool
+        {
+            return derived().size() == 0;
+        }
+
+        constexpr auto reserve(size_type const new_capacity) -> void
+        {
+            if (new_capacity > derived().capacity())
+            {
+                reallocate_with_gap(checked_capacity(new_capacity), derived().size(), 0, [](T*) {});
+            }
+        }
+
+        // Modifiers
+
+        constexpr auto clear() noexcept -> void
+        {
+            std::destroy(begin(), end());
+            derived().set_size(0);
+        }
+
+        constexpr auto assign(size_type const count, T const& value) -> void
+        {
+            if (count > derived().capacity())
+            {
+                // value may be an element of this vector; the new elements are built first.
+                replace_with_buffer(checked_capacity(count), count, [&](T* const buffer) {
+                    detail::construct_fill_n(buffer, count, value);
+                });
+                return;
+            }
+
+            auto const old_size = derived().size();
+            auto* const data = derived().data();
+            std::fill_n(data, std::min(count, old_size), value);
+            if (count > old_size)
+            {
+                detail::construct_fill_n(data + old_size, count - old_size, value);
+            }
+            else
+            {
+                std::destroy(data + count, data + old_size);
+            }
+            derived().set_size(count);
+        }
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        requires std::constructible_from<T, std::iter_reference_t<I>>
+        constexpr auto assign(I first, S const last) -> void
+        {
+            if constexpr (std::forward_iterator<I>)
+            {
+                auto const count = static_cast<size_type>(std::ranges::distance(first, last));
+                if (count > derived().capacity())
+                {
+                    replace_with_buffer(checked_capacity(count), count, [&](T* const buffer) {
+                        detail::construct_copy(first, last, buffer);
+                    });
+                    return;
+                }
+
+                auto const old_size = derived().size();
+                auto* const data = derived().data();
+                auto const assigned = std::min(count, old_size);
+                for (auto i = size_type{0}; i < assigned; ++i, ++first)
+                {
+                    data[i] = *first;
+                }
+                if (count > old_size)
+                {
+                    detail::construct_copy(first, last, data + old_size);
+                }
+                else
+                {
+                    std::destroy(data + count, data + old_size);
+                }
+                derived().set_size(count);
+            }
+            else
+            {
+                clear();
+                for (; first != last; ++first)
+                {
+                    emplace_back(*first);
+                }
+            }
+        }
+
+        constexpr auto assign(std::initializer_list<T> const init_list) -> void
+        {
+            assign(init_list.begin(), init_list.end());
+        }
+
+        constexpr auto push_back(T const& value) -> void
+        {
+            emplace_back(value);
+        }
+
+        constexpr auto push_back(T&& value) -> void
+        {
+            emplace_back(std::move(value));
+        }
+
+        template <typename... Args>
+        constexpr auto emplace_back(Args&& ... args) -> reference
+        {
+            auto const size = derived().size();
+            if (size == derived().capacity())
+            {
+                // The arguments may refer to elements, so they are used before relocating them.
+                reallocate_with_gap(grown_capacity(size + 1), size, 1, [&](T* const gap) {
+                    std::construct_at(gap, std::forward<Args>(args)...);
+                });
+            }
+            else
+            {
+                std::construct_at(derived().data() + size, std::forward<Args>(args)...);
+                derived().set_size(size + 1);
+            }
+            return back();
+        }
+
+        constexpr auto pop_back() noexcept -> void
+        {
+            auto const size = derived().size();
+            std::destroy_at(derived().data() + size - 1);
+            derived().set_size(size - 1);
+        }
+
+        template <typename... Args>
+        constexpr auto emplace(const_iterator const pos, Args&& ... args) -> iterator
+        {
+            auto const index = index_of(pos);
+            auto const size = derived().size();
+            if (size == derived().capacity())
+            {
+                reallocate_with_gap(grown_capacity(size + 1), index, 1, [&](T* const gap) {
+                    std::construct_at(gap, std::forward<Args>(args)...);
+                });
+            }
+            else if (index == size)
+            {
+                std::construct_at(derived().data() + size, std::forward<Args>(args)...);
+                derived().set_size(size + 1);
+            }
+            else
+            {
+                // Constructed before shifting, as the arguments may refer to elements.
+                auto value = T(std::forward<Args>(args)...);
+                auto* const data = derived().data();
+                std::construct_at(data + size, std::move(data[size - 1]));
+                derived().set_size(size + 1);
+                std::move_backward(data + index, data + size - 1, data + size);
+                data[index] = std::move(value);
+            }
+            return begin() + index;
+        }
+
+        constexpr auto insert(const_iterator const pos, T const& value) -> iterator
+        {
+            return emplace(pos, value);
+        }
+
+        constexpr auto insert(const_iterator const pos, T&& value) -> iterator
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        constexpr auto insert(const_iterator const pos, size_type const count, T const& value) -> iterator
+        {
+            auto const index = index_of(pos);
+            auto const size = derived().size();
+            if (size + count > derived().capacity())
+            {
+                reallocate_with_gap(grown_capacity(size + count), index, count, [&](T* const gap) {
+                    detail::construct_fill_n(gap, count, value);
+                });
+            }
+            else
+            {
+                detail::construct_fill_n(end(), count, value);
+                derived().set_size(size + count);
+                std::rotate(begin() + index, begin() + size, end());
+            }
+            return begin() + index;
+        }
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        requires std::constructible_from<T, std::iter_reference_t<I>>
+        constexpr auto insert(const_iterator const pos, I first, S const last) -> iterator
+        {
+            auto const index = index_of(pos);
+            auto const size = derived().size();
+            if constexpr (std::forward_iterator<I>)
+            {
+                auto const count = static_cast<size_type>(std::ranges::distance(first, last));
+                if (size + count > derived().capacity())
+                {
+                    reallocate_with_gap(grown_capacity(size + count), index, count, [&](T* const gap) {
+                        detail::construct_copy(first, last, gap);
+                    });
+                    return begin() + index;
+                }
+                detail::construct_copy(first, last, end());
+                derived().set_size(size + count);
+            }
+            else
+            {
+                try
+                {
+                    for (; first != last; ++first)
+                    {
+                        emplace_back(*first);
+                    }
+                }
+                catch (...)
+                {
+                    erase(begin() + size, end());
+                    throw;
+                }
+            }
+            std::rotate(begin() + index, begin() + size, end());
+            return begin() + index;
+        }
+
+        constexpr auto insert(const_iterator const pos, std::initializer_list<T> const init_list) -> iterator
+        {
+            return insert(pos, init_list.begin(), init_list.end());
+        }
+
+        constexpr auto erase(const_iterator const pos) -> iterator
+        {
+            return erase(pos, pos + 1);
+        }
+
+        constexpr auto erase(const_iterator const first, const_iterator const last) -> iterator
+        {
+            auto* const data = derived().data();
+            auto const first_index = index_of(first);
+            if (first != last)
+            {
+                auto* const old_end = end();
+                auto* const new_end = std::move(data + index_of(last), old_end, data + first_index);
+                std::destroy(new_end, old_end);
+                derived().set_size(static_cast<size_type>(new_end - data));
+            }
+            return data + first_index;
+        }
+
+        constexpr auto resize(size_type const count) -> void
+        {
+            resize_with(count, [](T* const first, size_type const n) {
+                detail::construct_value_n(first, n);
+            });
+        }
+
+        constexpr auto resize(size_type const count, T const& value) -> void
+        {
+            resize_with(count, [&](T* const first, size_type const n) {
+                detail::construct_fill_n(first, n, value);
+            });
+        }
+
+        // Comparison
+
+        friend constexpr auto operator==(Derived const& lhs, Derived const& rhs) -> bool
+        requires std::equality_comparable<T>
+        {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        friend constexpr auto operator<=>(Derived const& lhs, Derived const& rhs)
+        requires requires(T const& value) { synth_three_way(value, value); }
+        {
+            return std::lexicographical_compare_three_way(
+                lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), synth_three_way);
+        }
+
+    protected:
+        vector_base() = default;
+
+        /// Moves the elements to buffer, leaving gap_size uninitialized slots at index.
+        /// The current storage is left uninitialized. If this throws, nothing is changed.
+        constexpr auto transfer_elements(T* const buffer, size_type const index, size_type const gap_size) -> void
+        {
+            auto* const data = derived().data();
+            auto const size = derived().size();
+            if constexpr (nothrow_relocatable<T>)
+            {
+                uninitialized_relocate(data, data + index, buffer);
+                uninitialized_relocate(data + index, data + size, buffer + index + gap_size);
+            }
+            else
+            {
+                auto* const front_end = uninitialized_copy_or_move(data, data + index, buffer);
+                try
+                {
+                    uninitialized_copy_or_move(data + index, data + size, buffer + index + gap_size);
+                }
+                catch (...)
+                {
+                    std::destroy(buffer, front_end);
+                    throw;
+                }
+                std::destroy(data, data + size);
+            }
+        }
+
+        /// Moves the elements to a new buffer of new_capacity elements, in which construct
+        /// creates gap_size new elements at index. If this throws, nothing is changed.
+        template <typename F>
+        constexpr auto reallocate_with_gap(size_type const new_capacity, size_type const index, size_type const gap_size, F&& construct)
+        -> void
+        {
+            auto* const buffer = derived().allocate_buffer(new_capacity);
+            try
+            {
+                std::forward<F>(construct)(buffer + index);
+            }
+            catch (...)
+            {
+                derived().deallocate_buffer(buffer, new_capacity);
+                throw;
+            }
+
+            try
+            {
+                transfer_elements(buffer, index, gap_size);
+            }
+            catch (...)
+            {
+                std::destroy_n(buffer + index, gap_size);
+                derived().deallocate_buffer(buffer, new_capacity);
+                throw;
+            }
+
+            auto const size = derived().size();
+            derived().adopt_buffer(buffer, new_capacity);
+            derived().set_size(size + gap_size);
+        }
+
+        /// Replaces the elements with count elements that construct creates in a new buffer
+        /// of new_capacity elements. If this throws, nothing is changed.
+        template <typename F>
+        constexpr auto replace_with_buffer(size_type const new_capacity, size_type const count, F&& construct) -> void
+        {
+            auto* const buffer = derived().allocate_buffer(new_capacity);
+            try
+            {
+                std::forward<F>(construct)(buffer);
+            }
+            catch (...)
+            {
+                derived().deallocate_buffer(buffer, new_capacity);
+                throw;
+            }
+
+            clear();
+            derived().adopt_buffer(buffer, new_capacity);
+            derived().set_size(count);
+        }
+
+    private:
+        [[nodiscard]] constexpr auto derived() noexcept -> Derived&
+        {
+            return static_cast<Derived&>(*this);
+        }
+
+        [[nodiscard]] constexpr auto derived() const noexcept -> Derived const&
+        {
+            return static_cast<Derived const&>(*this);
+        }
+
+        [[nodiscard]] constexpr auto index_of(const_iterator const pos) const noexcept -> size_type
+        {
+            return static_cast<size_type>(pos - begin());
+        }
+
+        [[nodiscard]] constexpr auto checked_capacity(size_type const required) const -> size_type
+        {
+            if (required > derived().max_size())
+            {
+                Derived::throw_capacity_exceeded();
+            }
+            return required;
+        }
+
+        /// The capacity to grow to when at least required elements are needed: double the current
+        /// capacity, so that appending takes amortized constant time.
+        [[nodiscard]] constexpr auto grown_capacity(size_type const required) const -> size_type
+        {
+            auto const max_size = derived().max_size();
+            auto const capacity = derived().capacity();
+            return std::max(checked_capacity(required), capacity > max_size / 2 ? max_size : capacity * 2);
+        }
+
+        template <typename F>
+        constexpr auto resize_with(size_type const count, F construct_n) -> void
+        {
+            auto const size = derived().size();
+            if (count <= size)
+            {
+                std::destroy(begin() + count, end());
+                derived().set_size(count);
+            }
+            else if (count > derived().capacity())
+            {
+                reallocate_with_gap(grown_capacity(count), size, count - size, [&](T* const gap) {
+                    construct_n(gap, count - size);
+                });
+            }
+            else
+            {
+                construct_n(end(), count - size);
+                derived().set_size(count);
+            }
+        }
+
+        /// Copies if moving may throw and T is copyable (like std::move_if_noexcept).
+        static constexpr auto uninitialized_copy_or_move(T* const first, T* const last, T* const d_first) -> T*
+        {
+            if constexpr (std::is_copy_constructible_v<T>)
+            {
+                return detail::construct_copy(first, last, d_first);
+            }
+            else
+            {
+                return detail::construct_copy(std::make_move_iterator(first), std::make_move_iterator(last), d_first);
+            }
+        }
+    };
+}
@@ -0,0 +1,1348 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/base_concepts.hpp"
+#include "more_concepts/hashing.hpp"
+
+#if defined(__SSE2__) and not defined(MORE_CONCEPTS_DISABLE_SIMD)
+#define MORE_CONCEPTS_DETAIL_SWISS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace more_concepts
+{
+    namespace detail::swiss
+    {
+        /// Each slot of the table has a control byte. Full slots store the low 7 bits of the hash
+        /// of their key (h2), so their control bytes are non-negative; the special values all
+        /// have the sign bit set. The sentinel marks the end of the control bytes for iteration.
+        using ctrl_t = std::int8_t;
+
+        inline constexpr auto ctrl_empty = static_cast<ctrl_t>(-128);
+        inline constexpr auto ctrl_deleted = static_cast<ctrl_t>(-2);
+        inline constexpr auto ctrl_sentinel = static_cast<ctrl_t>(-1);
+
+        constexpr auto is_full(ctrl_t const ctrl) noexcept -> bool
+        {
+            return ctrl >= 0;
+        }
+
+        constexpr auto is_empty_or_deleted(ctrl_t const ctrl) noexcept -> bool
+        {
+            return ctrl < ctrl_sentinel;
+        }
+
+        constexpr auto h1(std::size_t const hash) noexcept -> std::size_t
+        {
+            return hash >> 7u;
+        }
+
+        constexpr auto h2(std::size_t const hash) noexcept -> ctrl_t
+        {
+            return static_cast<ctrl_t>(hash & 0x7Fu);
+        }
+
+        /// Positions of the control bytes in a group that matched a query.
+        /// Each matching byte is represented by the bit at (position << Shift).
+        template <std::unsigned_integral T, int Shift>
+        class bitmask
+        {
+        public:
+            constexpr explicit bitmask(T const bits) noexcept
+                : bits_{bits}
+            {
+            }
+
+            constexpr explicit operator bool() const noexcept
+            {
+                return bits_ != 0;
+            }
+
+            [[nodiscard]] constexpr auto lowest() const noexcept -> std::size_t
+            {
+                return static_cast<std::size_t>(std::countr_zero(bits_)) >> Shift;
+            }
+
+            [[nodiscard]] constexpr auto trailing_zeros() const noexcept -> std::size_t
+            {
+                return lowest();
+            }
+
+            [[nodiscard]] constexpr auto leading_zeros() const noexcept -> std::size_t
+            {
+                return static_cast<std::size_t>(std::countl_zero(bits_)) >> Shift;
+            }
+
+            constexpr auto clear_lowest() noexcept -> void
+            {
+                bits_ &= static_cast<T>(bits_ - 1u);
+            }
+
+        private:
+            T bits_;
+        };
+
+#ifdef MORE_CONCEPTS_DETAIL_SWISS_SSE2
+        /// A group of 16 control bytes, queried with SSE2 compares.
+        class group
+        {
+        public:
+            static constexpr auto width = std::size_t{16};
+
+            explicit group(ctrl_t const* const pos) noexcept
+                : ctrl_{_mm_loadu_si128(reinterpret_cast<__m128i const*>(pos))}
+            {
+            }
+
+            [[nodiscard]] auto match(ctrl_t const hash) const noexcept -> bitmask<std::uint16_t, 0>
+            {
+                return to_bitmask(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(hash)), ctrl_));
+            }
+
+            [[nodiscard]] auto match_empty() const noexcept -> bitmask<std::uint16_t, 0>
+            {
+                return to_bitmask(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(ctrl_empty)), ctrl_));
+            }
+
+            [[nodiscard]] auto match_empty_or_deleted() const noexcept -> bitmask<std::uint16_t, 0>
+            {
+                return to_bitmask(_mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(ctrl_sentinel)), ctrl_));
+            }
+
+            [[nodiscard]] auto count_leading_empty_or_deleted() const noexcept -> std::size_t
+            {
+                auto const mask = _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(ctrl_sentinel)), ctrl_);
+                return static_cast<std::size_t>(
+                    std::countr_one(static_cast<std::uint16_t>(_mm_movemask_epi8(mask))));
+            }
+
+        private:
+            __m128i ctrl_;
+
+            static auto to_bitmask(__m128i const mask) noexcept -> bitmask<std::uint16_t, 0>
+            {
+                return bitmask<std::uint16_t, 0>{static_cast<std::uint16_t>(_mm_movemask_epi8(mask))};
+            }
+        };
+#else
+        /// A group of 8 control bytes, queried with bitwise operations on a 64 bit word.
+        class group
+        {
+        public:
+            static constexpr auto width = std::size_t{8};
+
+            explicit group(ctrl_t const* const pos) noexcept
+            {
+                std::memcpy(&ctrl_, pos, sizeof(ctrl_));
+                if constexpr (std::endian::native == std::endian::big)
+                {
+                    auto swapped = std::uint64_t{0};
+                    for (auto i = 0; i < 8; ++i)
+                    {
+                        swapped = (swapped << 8u) | ((ctrl_ >> (8u * static_cast<unsigned>(i))) & 0xFFu);
+                    }
+                    ctrl_ = swapped;
+                }
+            }
+
+            /// May report false positives (after a true positive), which are filtered out
+            /// by the key comparison.
+            [[nodiscard]] auto match(ctrl_t const hash) const noexcept -> bitmask<std::uint64_t, 3>
+            {
+                auto const x = ctrl_ ^ (lsbs * static_cast<std::uint8_t>(hash));
+                return bitmask<std::uint64_t, 3>{(x - lsbs) & ~x & msbs};
+            }
+
+            [[nodiscard]] auto match_empty() const noexcept -> bitmask<std::uint64_t, 3>
+            {
+                return bitmask<std::uint64_t, 3>{ctrl_ & (~ctrl_ << 6u) & msbs};
+            }
+
+            [[nodiscard]] auto match_empty_or_deleted() const noexcept -> bitmask<std::uint64_t, 3>
+            {
+                return bitmask<std::uint64_t, 3>{ctrl_ & (~ctrl_ << 7u) & msbs};
+            }
+
+            [[nodiscard]] auto count_leading_empty_or_deleted() const noexcept -> std::size_t
+            {
+                auto const other = ~(ctrl_ & (~ctrl_ << 7u)) & msbs;
+                return other == 0 ? width : static_cast<std::size_t>(std::countr_zero(other)) >> 3u;
+            }
+
+        private:
+            static constexpr auto lsbs = std::uint64_t{0x0101010101010101u};
+            static constexpr auto msbs = std::uint64_t{0x8080808080808080u};
+
+            std::uint64_t ctrl_ = 0;
+        };
+#endif
+
+        /// Triangular probing over groups. With a capacity of 2^k - 1, every group start position
+        /// is visited once before the sequence repeats.
+        class probe_sequence
+        {
+        public:
+            probe_sequence(std::size_t const hash, std::size_t const mask) noexcept
+                : mask_{mask}
+                , offset_{hash & mask}
+            {
+            }
+
+            [[nodiscard]] auto offset() const noexcept -> std::size_t
+            {
+                return offset_;
+            }
+
+            [[nodiscard]] auto offset(std::size_t const i) const noexcept -> std::size_t
+            {
+                return (offset_ + i) & mask_;
+            }
+
+            auto next() noexcept -> void
+            {
+                index_ += group::width;
+                offset_ = (offset_ + index_) & mask_;
+            }
+
+        private:
+            std::size_t mask_;
+            std::size_t offset_;
+            std::size_t index_ = 0;
+        };
+
+        /// Number of cloned control bytes after the sentinel, which mirror the first bytes
+        /// of the table, so that a group can be loaded at any slot index without wrapping around.
+        inline constexpr auto num_cloned_bytes = group::width - 1;
+
+        /// Sets the control byte of slot i, and its clone if it has one.
+        inline auto set_ctrl(ctrl_t* const ctrl, std::size_t const capacity, std::size_t const i, ctrl_t const value)
+        noexcept -> void
+        {
+            ctrl[i] = value;
+            ctrl[((i - num_cloned_bytes) & capacity) + num_cloned_bytes] = value;
+        }
+
+        /// Returns the first empty or deleted slot in the probe sequence of hash.
+        /// The table must have at least one empty or deleted slot.
+        inline auto find_first_non_full(ctrl_t const* const ctrl, std::size_t const capacity, std::size_t const hash)
+        noexcept -> std::size_t
+        {
+            auto sequence = probe_sequence{h1(hash), capacity};
+            while (true)
+            {
+                auto const mask = group{ctrl + sequence.offset()}.match_empty_or_deleted();
+                if (mask)
+                {
+                    return sequence.offset(mask.lowest());
+                }
+                sequence.next();
+            }
+        }
+
+        /// Smallest valid capacity (2^k - 1, at least num_cloned_bytes) not less than n.
+        constexpr auto normalize_capacity(std::size_t const n) noexcept -> std::size_t
+        {
+            return std::max(num_cloned_bytes, std::bit_ceil(n + 1) - 1);
+        }
+    }
+
+    /// A hash map using open addressing with SIMD probing (the "Swiss table" design): each slot
+    /// has a control byte holding 7 bits of the hash of its key, and lookups compare a group
+    /// of 16 control bytes at a time with SSE2 (or 8 bytes at a time with bitwise operations
+    /// on other platforms), only comparing keys whose control bytes match.
+    /// Models unordered_unique_map_container.
+    ///
+    /// Compared to unordered_map, elements are stored inline in a single array, so lookups
+    /// usually touch one or two cache lines, and no allocation happens per element.
+    /// Unlike unordered_map, rehashing (and thus insertion) invalidates references to elements
+    /// and all iterators; erasure does not invalidate iterators to other elements.
+    /// The maximum load factor is at most 0.875 (which is also the default).
+    ///
+    /// The hash values are finalized with mix_hash, so identity hashes are safe, unless Hash
+    /// is an avalanching_hash_function (such as a mixed_hash), whose results are used as they are.
+    template <
+        typename Key,
+        typename T,
+        hash_function<Key> Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>,
+        typename Allocator = std::allocator<std::pair<Key const, T>>>
+    class flat_hash_map
+    {
+        template <bool Const>
+        class iterator_impl;
+
+        using ctrl_t = detail::swiss::ctrl_t;
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using ctrl_allocator = typename alloc_traits::template rebind_alloc<ctrl_t>;
+        using ctrl_alloc_traits = std::allocator_traits<ctrl_allocator>;
+
+        template <typename K>
+        static constexpr bool is_key_arg = std::same_as<std::remove_cvref_t<K>, Key>;
+
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<Key const, T>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocator_type = Allocator;
+        using reference = value_type&;
+        using const_reference = value_type const&;
+        using pointer = typename alloc_traits::pointer;
+        using const_pointer = typename alloc_traits::const_pointer;
+        using iterator = iterator_impl<false>;
+        using const_iterator = iterator_impl<true>;
+
+        static_assert(
+            std::same_as<typename alloc_traits::value_type, value_type>,
+            "Allocator::value_type must be the same as value_type");
+
+        static constexpr auto default_max_load_factor = 0.875f;
+
+        // Construction
+
+        flat_hash_map() = default;
+
+        explicit flat_hash_map(
+            size_type const bucket_count,
+            hasher const& hash = hasher(),
+            key_equal const& equal = key_equal(),
+            allocator_type const& alloc = allocator_type())
+            : hash_{hash}
+            , eq_{equal}
+            , alloc_{alloc}
+        {
+            rehash(bucket_count);
+        }
+
+        flat_hash_map(size_type const bucket_count, allocator_type const& alloc)
+            : flat_hash_map(bucket_count, hasher(), key_equal(), alloc)
+        {
+        }
+
+        flat_hash_map(size_type const bucket_count, hasher const& hash, allocator_type const& alloc)
+            : flat_hash_map(bucket_count, hash, key_equal(), alloc)
+        {
+        }
+
+        explicit flat_hash_map(allocator_type const& alloc)
+            : flat_hash_map(0, hasher(), key_equal(), alloc)
+        {
+        }
+
+        template <std::input_iterator I>
+        flat_hash_map(
+            I const first,
+            I const last,
+            size_type const bucket_count = 0,
+            hasher const& hash = hasher(),
+            key_equal const& equal = key_equal(),
+            allocator_type const& alloc = allocator_type())
+            : flat_hash_map(bucket_count, hash, equal, alloc)
+        {
+            insert(first, last);
+        }
+
+        flat_hash_map(
+            std::initializer_list<value_type> const init_list,
+            size_type const bucket_count = 0,
+            hasher const& hash = hasher(),
+            key_equal const& equal = key_equal(),
+            allocator_type const& alloc = allocator_type())
+            : flat_hash_map(init_list.begin(), init_list.end(), bucket_count, hash, equal, alloc)
+        {
+        }
+
+        flat_hash_map(flat_hash_map const& other)
+            : flat_hash_map(other, alloc_traits::select_on_container_copy_construction(other.alloc_))
+        {
+        }
+
+        flat_hash_map(flat_hash_map const& other, allocator_type const& alloc)
+            : flat_hash_map(0, other.hash_, other.eq_, alloc)
+        {
+            max_load_factor_ = other.max_load_factor_;
+            copy_elements_from(other);
+        }
+
+        flat_hash_map(flat_hash_map&& other) noexcept
+            : hash_{std::move(other.hash_)}
+            , eq_{std::move(other.eq_)}
+            , alloc_{std::move(other.alloc_)}
+        {
+            steal_elements_from(other);
+        }
+
+        flat_hash_map(flat_hash_map&& other, allocator_type const& alloc)
+            : flat_hash_map(0, other.hash_, other.eq_, alloc)
+        {
+            max_load_factor_ = other.max_load_factor_;
+            if (alloc_ == other.alloc_)
+            {
+                steal_elements_from(other);
+            }
+            else
+            {
+                move_elements_from(other);
+            }
+        }
+
+        auto operator=(flat_hash_map const& other) -> flat_hash_map&
+        {
+            if (this != &other)
+            {
+                constexpr auto propagate = alloc_traits::propagate_on_container_copy_assignment::value;
+                auto copy = flat_hash_map(other, propagate ? other.alloc_ : alloc_);
+                destroy_and_deallocate();
+                if constexpr (propagate)
+                {
+                    alloc_ = other.alloc_;
+                }
+                hash_ = std::move(copy.hash_);
+                eq_ = std::move(copy.eq_);
+                steal_elements_from(copy);
+            }
+            return *this;
+        }
+
+        auto operator=(flat_hash_map&& other)
+        noexcept(alloc_traits::propagate_on_container_move_assignment::value or
+                 alloc_traits::is_always_equal::value) -> flat_hash_map&
+        {
+            if (this != &other)
+            {
+                constexpr auto propagate = alloc_traits::propagate_on_container_move_assignment::value;
+                if (propagate or alloc_ == other.alloc_)
+                {
+                    destroy_and_deallocate();
+                    if constexpr (propagate)
+                    {
+                        alloc_ = std::move(other.alloc_);
+                    }
+                    hash_ = std::move(other.hash_);
+                    eq_ = std::move(other.eq_);
+                    steal_elements_from(other);
+                }
+                else
+                {
+                    clear();
+                    hash_ = other.hash_;
+                    eq_ = other.eq_;
+                    max_load_factor_ = other.max_load_factor_;
+                    move_elements_from(other);
+                }
+            }
+            return *this;
+        }
+
+        auto operator=(std::initializer_list<value_type> const init_list) -> flat_hash_map&
+        {
+            clear();
+            insert(init_list);
+            return *this;
+        }
+
+        ~flat_hash_map()
+        {
+            destroy_and_deallocate();
+        }
+
+        // Iterators
+
+        [[nodiscard]] auto begin() noexcept -> iterator
+        {
+            auto it = iterator{ctrl_, slots_};
+            if (size_ == 0)
+            {
+                return end();
+            }
+            it.skip_empty_or_deleted();
+            return it;
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> const_iterator
+        {
+            return const_cast<flat_hash_map&>(*this).begin();
+        }
+
+        [[nodiscard]] auto cbegin() const noexcept -> const_iterator
+        {
+            return begin();
+        }
+
+        [[nodiscard]] auto end() noexcept -> iterator
+        {
+            return iterator{ctrl_ + capacity_, slots_ + capacity_};
+        }
+
+        [[nodiscard]] auto end() const noexcept -> const_iterator
+        {
+            return const_cast<flat_hash_map&>(*this).end();
+        }
+
+        [[nodiscard]] auto cend() const noexcept -> const_iterator
+        {
+            return end();
+        }
+
+        // Capacity
+
+        [[nodiscard]] auto empty() const noexcept -> bool
+        {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] auto size() const noexcept -> size_type
+        {
+            return size_;
+        }
+
+        [[nodiscard]] auto max_size() const noexcept -> size_type
+        {
+            return std::min<size_type>(
+                alloc_traits::max_size(alloc_),
+                static_cast<size_type>(std::numeric_limits<difference_type>::max()));
+        }
+
+        // Lookup
+        //
+        // With a transparent hasher and key equality predicate, the lookup functions also accept
+        // any key type K that they can hash and compare with key_type, without converting it.
+
+        [[nodiscard]] auto find(key_type const& key) -> iterator
+        {
+            return find_key(key);
+        }
+
+        [[nodiscard]] auto find(key_type const& key) const -> const_iterator
+        {
+            return const_cast<flat_hash_map&>(*this).find_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Hash> and transparent_function<KeyEqual>
+        [[nodiscard]] auto find(K const& key) -> iterator
+        {
+            return find_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Hash> and transparent_function<KeyEqual>
+        [[nodiscard]] auto find(K const& key) const -> const_iterator
+        {
+            return const_cast<flat_hash_map&>(*this).find_key(key);
+        }
+
+        [[nodiscard]] auto count(key_type const& key) const -> size_type
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        template <typename K>
+        requires transparent_function<Hash> and transparent_function<KeyEqual>
+        [[nodiscard]] auto count(K const& key) const -> size_type
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        [[nodiscard]] auto contains(key_type const& key) const -> bool
+        {
+            return find(key) != end();
+        }
+
+        template <typename K>
+        requires transparent_function<Hash> and transparent_function<KeyEqual>
+        [[nodiscard]] auto contains(K const& key) const -> bool
+        {
+            return find(key) != end();
+        }
+
+        [[nodiscard]] auto equal_range(key_type const& key) -> std::pair<iterator, iterator>
+        {
+            auto const it = find(key);
+            return {it, it == end() ? it : std::next(it)};
+        }
+
+        [[nodiscard]] auto equal_range(key_type const& key) const -> std::pair<const_iterator, const_iterator>
+        {
+            auto const it = find(key);
+            return {it, it == end() ? it : std::next(it)};
+        }
+
+        template <typename K>
+        requires transparent_function<Hash> and transparent_function<KeyEqual>
+        [[nodiscard]] auto equal_range(K const& key) -> std::pair<iterator, iterator>
+        {
+            auto const it = find(key);
+            return {it, it == end() ? it : std::next(it)};
+        }
+
+        template <typename K>
+        requires transparent_function<Hash> and transparent_function<KeyEqual>
+        [[nodiscard]] auto equal_range(K const& key) const -> std::pair<const_iterator, const_iterator>
+        {
+            auto const it = find(key);
+            return {it, it == end() ? it : std::next(it)};
+        }
+
+        // Element access
+
+        [[nodiscard]] auto at(key_type const& key) -> mapped_type&
+        {
+            auto const it = find(key);
+            if (it == end())
+            {
+                throw std::out_of_range{"more_concepts::flat_hash_map::at: key not found"};
+            }
+            return it->second;
+        }
+
+        [[nodiscard]] auto at(key_type const& key) const -> mapped_type const&
+        {
+            return const_cast<flat_hash_map&>(*this).at(key);
+        }
+
+        auto operator[](key_type const& key) -> mapped_type&
+        {
+            return try_emplace(key).first->second;
+        }
+
+        auto operator[](key_type&& key) -> mapped_type&
+        {
+            return try_emplace(std::move(key)).first->second;
+        }
+
+        // Modifiers
+
+        auto insert(value_type const& value) -> std::pair<iterator, bool>
+        {
+            return emplace_with_key(value.first, value);
+        }
+
+        auto insert(value_type&& value) -> std::pair<iterator, bool>
+        {
+            return emplace_with_key(value.first, std::move(value));
+        }
+
+        auto insert(const_iterator, value_type const& value) -> iterator
+        {
+            return insert(value).first;
+        }
+
+        auto insert(const_iterator, value_type&& value) -> iterator
+        {
+            return insert(std::move(value)).first;
+        }
+
+        template <std::input_iterator I>
+        auto insert(I first, I const last) -> void
+        {
+            if constexpr (std::forward_iterator<I>)
+            {
+                reserve(size_ + static_cast<size_type>(std::distance(first, last)));
+            }
+            for (; first != last; ++first)
+            {
+                emplace(*first);
+            }
+        }
+
+        auto insert(std::initializer_list<value_type> const init_list) -> void
+        {
+            insert(init_list.begin(), init_list.end());
+        }
+
+        template <typename... Args>
+        auto emplace(Args&& ... args) -> std::pair<iterator, bool>
+        {
+            return emplace_decomposed(std::forward<Args>(args)...);
+        }
+
+        /// The hint is ignored.
+        template <typename... Args>
+        auto emplace_hint(const_iterator, Args&& ... args) -> iterator
+        {
+            return emplace(std::forward<Args>(args)...).first;
+        }
+
+        template <typename... Args>
+        auto try_emplace(key_type const& key, Args&& ... args) -> std::pair<iterator, bool>
+        {
+            return emplace_with_key(
+                key,
+                std::piecewise_construct,
+                std::forward_as_tuple(key),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        template <typename... Args>
+        auto try_emplace(key_type&& key, Args&& ... args) -> std::pair<iterator, bool>
+        {
+            return emplace_with_key(
+                key,
+                std::piecewise_construct,
+                std::forward_as_tuple(std::move(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        template <typename... Args>
+        auto try_emplace(const_iterator, key_type const& key, Args&& ... args) -> iterator
+        {
+            return try_emplace(key, std::forward<Args>(args)...).first;
+        }
+
+        template <typename... Args>
+        auto try_emplace(const_iterator, key_type&& key, Args&& ... args) -> iterator
+        {
+            return try_emplace(std::move(key), std::forward<Args>(args)...).first;
+        }
+
+        template <typename M>
+        requires std::is_assignable_v<mapped_type&, M&&>
+        auto insert_or_assign(key_type const& key, M&& obj) -> std::pair<iterator, bool>
+        {
+            return insert_or_assign_impl(key, std::forward<M>(obj));
+        }
+
+        template <typename M>
+        requires std::is_assignable_v<mapped_type&, M&&>
+        auto insert_or_assign(key_type&& key, M&& obj) -> std::pair<iterator, bool>
+        {
+            return insert_or_assign_impl(std::move(key), std::forward<M>(obj));
+        }
+
+        template <typename M>
+        requires std::is_assignable_v<mapped_type&, M&&>
+        auto insert_or_assign(const_iterator, key_type const& key, M&& obj) -> iterator
+        {
+            return insert_or_assign_impl(key, std::forward<M>(obj)).first;
+        }
+
+        template <typename M>
+        requires std::is_assignable_v<mapped_type&, M&&>
+        auto insert_or_assign(const_iterator, key_type&& key, M&& obj) -> iterator
+        {
+            return insert_or_assign_impl(std::move(key), std::forward<M>(obj)).first;
+        }
+
+        auto erase(iterator const pos) -> iterator
+        {
+            return erase(const_iterator{pos});
+        }
+
+        auto erase(const_iterator const pos) -> iterator
+        {
+            auto const index = static_cast<size_type>(pos.slot_ - slots_);
+            erase_at(index);
+            auto next = iterator_at(index);
+            ++next;
+            return next;
+        }
+
+        auto erase(const_iterator first, const_iterator const last) -> iterator
+        {
+            while (first != last)
+            {
+                first = erase(first);
+            }
+            return iterator_at(static_cast<size_type>(last.slot_ - slots_));
+        }
+
+        auto erase(key_type const& key) -> size_type
+        {
+            auto const it = find(key);
+            if (it == end())
+            {
+                return 0;
+            }
+            erase_at(static_cast<size_type>(it.slot_ - slots_));
+            return 1;
+        }
+
+        /// Destroys all elements, keeping the allocated capacity.
+        auto clear() noexcept -> void
+        {
+            if (capacity_ == 0)
+            {
+                return;
+            }
+            destroy_elements();
+            reset_ctrl();
+            size_ = 0;
+            growth_left_ = growth_for(capacity_);
+        }
+
+        auto swap(flat_hash_map& other) noexcept -> void
+        {
+            using std::swap;
+            swap(ctrl_, other.ctrl_);
+            swap(slots_, other.slots_);
+            swap(size_, other.size_);
+            swap(capacity_, other.capacity_);
+            swap(growth_left_, other.growth_left_);
+            swap(max_load_factor_, other.max_load_factor_);
+            swap(hash_, other.hash_);
+            swap(eq_, other.eq_);
+            if constexpr (alloc_traits::propagate_on_container_swap::value)
+            {
+                swap(alloc_, other.alloc_);
+            }
+        }
+
+        // Hash policy
+
+        /// The number of slots.
+        [[nodiscard]] auto bucket_count() const noexcept -> size_type
+        {
+            return capacity_;
+        }
+
+        [[nodiscard]] auto load_factor() const noexcept -> float
+        {
+            return capacity_ == 0 ? 0.0f : static_cast<float>(size_) / static_cast<float>(capacity_);
+        }
+
+        [[nodiscard]] auto max_load_factor() const noexcept -> float
+        {
+            return max_load_factor_;
+        }
+
+        /// Sets the maximum load factor, clamped to [1/16, 0.875] (open addressing needs empty slots
+        /// to terminate unsuccessful lookups). Rehashes the table.
+        auto max_load_factor(float const ml) -> void
+        {
+            max_load_factor_ = std::clamp(ml, 0.0625f, default_max_load_factor);
+            if (capacity_ != 0)
+            {
+                resize(std::max(capacity_, capacity_for(size_)));
+            }
+        }
+
+        /// Sets the number of slots to at least bucket_count, and enough for size() elements
+        /// under the maximum load factor. May shrink the table; rehash(0) shrinks it to fit.
+        auto rehash(size_type const bucket_count) -> void
+        {
+            if (bucket_count == 0 and size_ == 0)
+            {
+                destroy_and_deallocate();
+                return;
+            }
+
+            auto const new_capacity = std::max(
+                bucket_count == 0 ? 0 : detail::swiss::normalize_capacity(bucket_count),
+                capacity_for(size_));
+            if (new_capacity != capacity_)
+            {
+                resize(new_capacity);
+            }
+        }
+
+        /// Makes room for count elements without rehashing.
+        auto reserve(size_type const count) -> void
+        {
+            if (count <= size_ + growth_left_)
+            {
+                return;
+            }
+            resize(std::max(capacity_, capacity_for(count)));
+        }
+
+        // Observers
+
+        [[nodiscard]] auto hash_function() const -> hasher
+        {
+            return hash_;
+        }
+
+        [[nodiscard]] auto key_eq() const -> key_equal
+        {
+            return eq_;
+        }
+
+        [[nodiscard]] auto get_allocator() const noexcept -> allocator_type
+        {
+            return alloc_;
+        }
+
+        // Comparison
+
+        friend auto operator==(flat_hash_map const& lhs, flat_hash_map const& rhs) -> bool
+        requires std::equality_comparable<mapped_type>
+        {
+            if (lhs.size() != rhs.size())
+            {
+                return false;
+            }
+            return std::all_of(lhs.begin(), lhs.end(), [&](value_type const& value) {
+                auto const it = rhs.find(value.first);
+                return it != rhs.end() and it->second == value.second;
+            });
+        }
+
+        friend auto swap(flat_hash_map& lhs, flat_hash_map& rhs) noexcept -> void
+        {
+            lhs.swap(rhs);
+        }
+
+    private:
+        static constexpr auto npos = static_cast<size_type>(-1);
+
+        /// The control bytes: capacity_ slot bytes, the sentinel, and the cloned bytes.
+        /// Null if capacity_ is 0.
+        ctrl_t* ctrl_ = nullptr;
+        value_type* slots_ = nullptr;
+        size_type size_ = 0;
+        /// 2^k - 1, or 0.
+        size_type capacity_ = 0;
+        /// The number of empty slots that can be filled before the table has to be rehashed.
+        size_type growth_left_ = 0;
+        float max_load_factor_ = default_max_load_factor;
+        [[no_unique_address]] hasher hash_ = {};
+        [[no_unique_address]] key_equal eq_ = {};
+        [[no_unique_address]] allocator_type alloc_ = {};
+
+        template <bool Const>
+        class iterator_impl
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename flat_hash_map::value_type;
+            using difference_type = typename flat_hash_map::difference_type;
+            using reference = std::conditional_t<Const, value_type const&, value_type&>;
+            using pointer = std::conditional_t<Const, value_type const*, value_type*>;
+
+            iterator_impl() = default;
+
+            template <bool OtherConst>
+            requires (Const and not OtherConst)
+            iterator_impl(iterator_impl<OtherConst> const& other) noexcept
+                : ctrl_{other.ctrl_}
+                , slot_{other.slot_}
+            {
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> reference
+            {
+                return *slot_;
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> pointer
+            {
+                return slot_;
+            }
+
+            auto operator++() noexcept -> iterator_impl&
+            {
+                ++ctrl_;
+                ++slot_;
+                skip_empty_or_deleted();
+                return *this;
+            }
+
+            auto operator++(int) noexcept -> iterator_impl
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            [[nodiscard]] friend auto operator==(iterator_impl const& lhs, iterator_impl const& rhs) noexcept
+            -> bool
+            {
+                return lhs.slot_ == rhs.slot_;
+            }
+
+        private:
+            friend class flat_hash_map;
+            friend class iterator_impl<not Const>;
+
+            ctrl_t const* ctrl_ = nullptr;
+            pointer slot_ = nullptr;
+
+            iterator_impl(ctrl_t const* const ctrl, pointer const slot) noexcept
+                : ctrl_{ctrl}
+                , slot_{slot}
+            {
+            }
+
+            /// Advances to the next full slot, or to the sentinel.
+            auto skip_empty_or_deleted() noexcept -> void
+            {
+                while (detail::swiss::is_empty_or_deleted(*ctrl_))
+                {
+                    auto const shift = detail::swiss::group{ctrl_}.count_leading_empty_or_deleted();
+                    ctrl_ += shift;
+                    slot_ += shift;
+                }
+            }
+        };
+
+        template <typename K>
+        [[nodiscard]] auto find_key(K const& key) -> iterator
+        {
+            if (size_ == 0)
+            {
+                return end();
+            }
+            auto const index = find_index(key, hash_of(key));
+            return index == npos ? end() : iterator_at(index);
+        }
+
+        template <typename K>
+        [[nodiscard]] auto hash_of(K const& key) const -> std::size_t
+        {
+            return finalize_hash(hash_, key);
+        }
+
+        [[nodiscard]] auto iterator_at(size_type const index) noexcept -> iterator
+        {
+            return iterator{ctrl_ + index, slots_ + index};
+        }
+
+        /// The number of elements that fit in a table of the given capacity.
+        [[nodiscard]] auto growth_for(size_type const capacity) const noexcept -> size_type
+        {
+            if (capacity == 0)
+            {
+                return 0;
+            }
+            auto const growth = static_cast<size_type>(static_cast<double>(capacity) * max_load_factor_);
+            return std::clamp<size_type>(growth, 1, capacity - 1);
+        }
+
+        /// The smallest capacity that fits count elements.
+        [[nodiscard]] auto capacity_for(size_type const count) const noexcept -> size_type
+        {
+            if (count == 0)
+            {
+                return 0;
+            }
+            auto capacity = detail::swiss::normalize_capacity(
+                static_cast<size_type>(std::ceil(static_cast<double>(count) / max_load_factor_)));
+            while (growth_for(capacity) < count)
+            {
+                capacity = capacity * 2 + 1;
+            }
+            return capacity;
+        }
+
+        template <typename K>
+        [[nodiscard]] auto find_index(K const& key, std::size_t const hash) const -> size_type
+        {
+            auto sequence = detail::swiss::probe_sequence{detail::swiss::h1(hash), capacity_};
+            while (true)
+            {
+                auto const group = detail::swiss::group{ctrl_ + sequence.offset()};
+                for (auto match = group.match(detail::swiss::h2(hash)); match; match.clear_lowest())
+                {
+                    auto const index = sequence.offset(match.lowest());
+                    if (eq_(slots_[index].first, key))
+                    {
+                        return index;
+                    }
+                }
+                if (group.match_empty())
+                {
+                    return npos;
+                }
+                sequence.next();
+            }
+        }
+
+        /// Returns the slot where an element with the given hash can be inserted,
+        /// growing or rehashing the table if needed.
+        auto prepare_insert(std::size_t const hash) -> size_type
+        {
+            if (capacity_ != 0)
+            {
+                auto const index = detail::swiss::find_first_non_full(ctrl_, capacity_, hash);
+                if (growth_left_ > 0 or ctrl_[index] == detail::swiss::ctrl_deleted)
+                {
+                    return index;
+                }
+            }
+
+            if (capacity_ == 0)
+            {
+                resize(capacity_for(1));
+            }
+            else if (size_ < growth_for(capacity_) / 2)
+            {
+                // Mostly deleted slots: rehashing at the same capacity frees them.
+                resize(capacity_);
+            }
+            else
+            {
+                resize(std::max(capacity_ * 2 + 1, capacity_for(size_ + 1)));
+            }
+            return detail::swiss::find_first_non_full(ctrl_, capacity_, hash);
+        }
+
+        /// Marks the slot at index, in which an element was just constructed, as full.
+        auto commit_insert(size_type const index, std::size_t const hash) noexcept -> void
+        {
+            if (ctrl_[index] == detail::swiss::ctrl_empty)
+            {
+                --growth_left_;
+            }
+            detail::swiss::set_ctrl(ctrl_, capacity_, index, detail::swiss::h2(hash));
+            ++size_;
+        }
+
+        /// Inserts value_type(args...) if there is no element with the given key.
+        /// The key must not refer to an element of this table.
+        template <typename... Args>
+        auto emplace_with_key(key_type const& key, Args&& ... args) -> std::pair<iterator, bool>
+        {
+            auto const hash = hash_of(key);
+            if (size_ != 0)
+            {
+                if (auto const index = find_index(key, hash); index != npos)
+                {
+                    return {iterator_at(index), false};
+                }
+            }
+
+            auto const index = prepare_insert(hash);
+            alloc_traits::construct(alloc_, slots_ + index, std::forward<Args>(args)...);
+            commit_insert(index, hash);
+            return {iterator_at(index), true};
+        }
+
+        template <typename K, typename M>
+        requires is_key_arg<K>
+        auto emplace_decomposed(K&& key, M&& obj) -> std::pair<iterator, bool>
+        {
+            return emplace_with_key(key, std::forward<K>(key), std::forward<M>(obj));
+        }
+
+        template <typename P>
+        requires is_key_arg<decltype(std::declval<P&>().first)>
+        auto emplace_decomposed(P&& value) -> std::pair<iterator, bool>
+        {
+            return emplace_with_key(value.first, std::forward<P>(value));
+        }
+
+        template <typename K, typename... MappedArgs>
+        requires is_key_arg<K>
+        auto emplace_decomposed(
+            std::piecewise_construct_t,
+            std::tuple<K> key_args,
+            std::tuple<MappedArgs...> mapped_args)
+        -> std::pair<iterator, bool>
+        {
+            auto const& key = std::get<0>(key_args);
+            return emplace_with_key(key, std::piecewise_construct, std::move(key_args), std::move(mapped_args));
+        }
+
+        /// Constructs the value first to find out its key; it is moved into the table if it is inserted.
+        template <typename... Args>
+        auto emplace_decomposed(Args&& ... args) -> std::pair<iterator, bool>
+        {
+            auto value = value_type(std::forward<Args>(args)...);
+            return emplace_with_key(value.first, std::move(value));
+        }
+
+        template <typename K, typename M>
+        auto insert_or_assign_impl(K&& key, M&& obj) -> std::pair<iterator, bool>
+        {
+            auto const hash = hash_of(key);
+            if (size_ != 0)
+            {
+                if (auto const index = find_index(key, hash); index != npos)
+                {
+                    slots_[index].second = std::forward<M>(obj);
+                    return {iterator_at(index), false};
+                }
+            }
+
+            auto const index = prepare_insert(hash);
+            alloc_traits::construct(alloc_, slots_ + index, std::forward<K>(key), std::forward<M>(obj));
+            commit_insert(index, hash);
+            return {iterator_at(index), true};
+        }
+
+        /// Destroys the element at index. The slot is marked as empty if no probe sequence
+        /// could have passed over it while it was full (there is an empty slot in every group
+        /// window containing it), otherwise as deleted.
+        auto erase_at(size_type const index) noexcept -> void
+        {
+            using detail::swiss::group;
+
+            alloc_traits::destroy(alloc_, slots_ + index);
+            --size_;
+
+            auto const index_before = (index - group::width) & capacity_;
+            auto const empty_after = group{ctrl_ + index}.match_empty();
+            auto const empty_before = group{ctrl_ + index_before}.match_empty();
+            auto const was_never_full
+                = empty_before and empty_after and
+                  empty_after.trailing_zeros() + empty_before.leading_zeros() < group::width;
+
+            if (was_never_full)
+            {
+                detail::swiss::set_ctrl(ctrl_, capacity_, index, detail::swiss::ctrl_empty);
+                ++growth_left_;
+            }
+            else
+            {
+                detail::swiss::set_ctrl(ctrl_, capacity_, index, detail::swiss::ctrl_deleted);
+            }
+        }
+
+        auto reset_ctrl() noexcept -> void
+        {
+            std::fill_n(ctrl_, capacity_ + detail::swiss::group::width, detail::swiss::ctrl_empty);
+            ctrl_[capacity_] = detail::swiss::ctrl_sentinel;
+        }
+
+        auto destroy_elements() noexcept -> void
+        {
+            if constexpr (not std::is_trivially_destructible_v<value_type>)
+            {
+                for (auto i = size_type{0}; i < capacity_; ++i)
+                {
+                    if (detail::swiss::is_full(ctrl_[i]))
+                    {
+                        alloc_traits::destroy(alloc_, slots_ + i);
+                    }
+                }
+            }
+        }
+
+        auto deallocate(ctrl_t* const ctrl, value_type* const slots, size_type const capacity) noexcept -> void
+        {
+            if (capacity != 0)
+            {
+                auto ctrl_alloc = ctrl_allocator(alloc_);
+                ctrl_alloc_traits::deallocate(ctrl_alloc, ctrl, capacity + detail::swiss::group::width);
+                alloc_traits::deallocate(alloc_, slots, capacity);
+            }
+        }
+
+        auto destroy_and_deallocate() noexcept -> void
+        {
+            if (capacity_ != 0)
+            {
+                destroy_elements();
+                deallocate(ctrl_, slots_, capacity_);
+            }
+            ctrl_ = nullptr;
+            slots_ = nullptr;
+            size_ = 0;
+            capacity_ = 0;
+            growth_left_ = 0;
+        }
+
+        /// Moves all elements to newly allocated arrays of new_capacity slots.
+        /// If moving an element throws, the table is left unchanged.
+        auto resize(size_type const new_capacity) -> void
+        {
+            auto ctrl_alloc = ctrl_allocator(alloc_);
+            auto* const new_ctrl = ctrl_alloc_traits::allocate(ctrl_alloc, new_capacity + detail::swiss::group::width);
+            auto* new_slots = static_cast<value_type*>(nullptr);
+            try
+            {
+                new_slots = alloc_traits::allocate(alloc_, new_capacity);
+            }
+            catch (...)
+            {
+                ctrl_alloc_traits::deallocate(ctrl_alloc, new_ctrl, new_capacity + detail::swiss::group::width);
+                throw;
+            }
+
+            std::fill_n(new_ctrl, new_capacity + detail::swiss::group::width, detail::swiss::ctrl_empty);
+            new_ctrl[new_capacity] = detail::swiss::ctrl_sentinel;
+
+            auto i = size_type{0};
+            try
+            {
+                for (; i < capacity_; ++i)
+                {
+                    if (detail::swiss::is_full(ctrl_[i]))
+                    {
+                        auto const hash = hash_of(slots_[i].first);
+                        auto const index = detail::swiss::find_first_non_full(new_ctrl, new_capacity, hash);
+                        alloc_traits::construct(alloc_, new_slots + index, std::move_if_noexcept(slots_[i]));
+                        detail::swiss::set_ctrl(new_ctrl, new_capacity, index, detail::swiss::h2(hash));
+                    }
+                }
+            }
+            catch (...)
+            {
+                for (auto j = size_type{0}; j < new_capacity; ++j)
+                {
+                    if (detail::swiss::is_full(new_ctrl[j]))
+                    {
+                        alloc_traits::destroy(alloc_, new_slots + j);
+                    }
+                }
+                deallocate(new_ctrl, new_slots, new_capacity);
+                throw;
+            }
+
+            if (capacity_ != 0)
+            {
+                destroy_elements();
+                deallocate(ctrl_, slots_, capacity_);
+            }
+            ctrl_ = new_ctrl;
+            slots_ = new_slots;
+            capacity_ = new_capacity;
+            growth_left_ = growth_for(new_capacity) - size_;
+        }
+
+        auto steal_elements_from(flat_hash_map& other) noexcept -> void
+        {
+            ctrl_ = std::exchange(other.ctrl_, nullptr);
+            slots_ = std::exchange(other.slots_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            capacity_ = std::exchange(other.capacity_, 0);
+            growth_left_ = std::exchange(other.growth_left_, 0);
+            max_load_factor_ = other.max_load_factor_;
+        }
+
+        auto copy_elements_from(flat_hash_map const& other) -> void
+        {
+            reserve(other.size_);
+            for (auto const& value : other)
+            {
+                auto const hash = hash_of(value.first);
+                auto const index = prepare_insert(hash);
+                alloc_traits::construct(alloc_, slots_ + index, value);
+                commit_insert(index, hash);
+            }
+        }
+
+        auto move_elements_from(flat_hash_map& other) -> void
+        {
+            reserve(other.size_);
+            for (auto& value : other)
+            {
+                auto const hash = hash_of(value.first);
+                auto const index = prepare_insert(hash);
+                alloc_traits::construct(alloc_, slots_ + index, std::move(value));
+                commit_insert(index, hash);
+            }
+            other.clear();
+        }
+    };
+}
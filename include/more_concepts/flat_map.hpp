@@ -0,0 +1,201 @@
+#pragma once
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "more_concepts/detail/flat_tree.hpp"
+#include "more_concepts/detail/key_of_value.hpp"
+
+namespace more_concepts
+{
+    /// An ordered unique map that stores its elements in a sorted random access container
+    /// (by default a vector), and looks them up with binary search. Models ordered_unique_map_container.
+    ///
+    /// Compared to map, lookup and iteration are faster (there are no nodes to chase), and memory use
+    /// is lower, while insertion and erasure are linear in the size of the map. Use it for tables
+    /// that are built once and looked up many times; build them from an unsorted container or range,
+    /// rather than by inserting one element at a time.
+    ///
+    /// Unlike map, the value type is pair<Key, T> (not pair<Key const, T>), as the elements
+    /// have to be move assignable. The keys must not be modified through iterators.
+    /// Insertion and erasure invalidate all iterators.
+    template <
+        typename Key,
+        typename T,
+        typename Compare = std::less<Key>,
+        detail::flat_tree_storage<std::pair<Key, T>> Container = std::vector<std::pair<Key, T>>>
+    class flat_map
+        : public detail::flat_tree<Key, std::pair<Key, T>, detail::pair_first, Compare, Container, true>
+    {
+        using base = detail::flat_tree<Key, std::pair<Key, T>, detail::pair_first, Compare, Container, true>;
+
+    public:
+        using mapped_type = T;
+        using typename base::key_type;
+        using typename base::value_type;
+        using typename base::key_compare;
+        using typename base::iterator;
+        using typename base::const_iterator;
+
+        class value_compare
+        {
+        public:
+            auto operator()(value_type const& lhs, value_type const& rhs) const -> bool
+            {
+                return comp(lhs.first, rhs.first);
+            }
+
+        protected:
+            friend class flat_map;
+
+            explicit value_compare(key_compare const& comp)
+                : comp{comp}
+            {
+            }
+
+            key_compare comp;
+        };
+
+        using base::base;
+
+        auto operator=(std::initializer_list<value_type> const init_list) -> flat_map&
+        {
+            *this = flat_map(init_list, this->key_comp());
+            return *this;
+        }
+
+        [[nodiscard]] auto value_comp() const -> value_compare { return value_compare{this->key_comp()}; }
+
+        // Element access
+
+        [[nodiscard]] auto at(key_type const& key) -> mapped_type&
+        {
+            return const_cast<mapped_type&>(std::as_const(*this).at(key));
+        }
+
+        [[nodiscard]] auto at(key_type const& key) const -> mapped_type const&
+        {
+            auto const pos = this->find(key);
+            if (pos == this->end())
+            {
+                throw std::out_of_range{"more_concepts::flat_map::at: key not found"};
+            }
+            return pos->second;
+        }
+
+        auto operator[](key_type const& key) -> mapped_type&
+        {
+            return try_emplace(key).first->second;
+        }
+
+        auto operator[](key_type&& key) -> mapped_type&
+        {
+            return try_emplace(std::move(key)).first->second;
+        }
+
+        // Modifiers
+
+        template <typename... Args>
+        auto try_emplace(key_type const& key, Args&& ... args) -> std::pair<iterator, bool>
+        {
+            return try_emplace_at(this->lower_bound(key), key, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        auto try_emplace(key_type&& key, Args&& ... args) -> std::pair<iterator, bool>
+        {
+            return try_emplace_at(this->lower_bound(key), std::move(key), std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        auto try_emplace(const_iterator const hint, key_type const& key, Args&& ... args) -> iterator
+        {
+            return try_emplace_at(find_position(hint, key), key, std::forward<Args>(args)...).first;
+        }
+
+        template <typename... Args>
+        auto try_emplace(const_iterator const hint, key_type&& key, Args&& ... args) -> iterator
+        {
+            return try_emplace_at(find_position(hint, key), std::move(key), std::forward<Args>(args)...).first;
+        }
+
+        template <typename M>
+        requires std::is_assignable_v<mapped_type&, M&&>
+        auto insert_or_assign(key_type const& key, M&& obj) -> std::pair<iterator, bool>
+        {
+            return insert_or_assign_at(this->lower_bound(key), key, std::forward<M>(obj));
+        }
+
+        template <typename M>
+        requires std::is_assignable_v<mapped_type&, M&&>
+        auto insert_or_assign(key_type&& key, M&& obj) -> std::pair<iterator, bool>
+        {
+            return insert_or_assign_at(this->lower_bound(key), std::move(key), std::forward<M>(obj));
+        }
+
+        template <typename M>
+        requires std::is_assignable_v<mapped_type&, M&&>
+        auto insert_or_assign(const_iterator const hint, key_type const& key, M&& obj) -> iterator
+        {
+            return insert_or_assign_at(find_position(hint, key), key, std::forward<M>(obj)).first;
+        }
+
+        template <typename M>
+        requires std::is_assignable_v<mapped_type&, M&&>
+        auto insert_or_assign(const_iterator const hint, key_type&& key, M&& obj) -> iterator
+        {
+            return insert_or_assign_at(find_position(hint, key), std::move(key), std::forward<M>(obj)).first;
+        }
+
+    private:
+        /// Returns the lower bound of key, using hint if it is the correct position.
+        [[nodiscard]] auto find_position(const_iterator const hint, key_type const& key) -> iterator
+        {
+            auto const& comp = this->compare();
+            if ((hint == this->begin() or comp(std::prev(hint)->first, key)) and
+                (hint == this->end() or not comp(hint->first, key)))
+            {
+                return this->to_iterator(hint);
+            }
+            return this->lower_bound(key);
+        }
+
+        template <typename K, typename... Args>
+        auto try_emplace_at(const_iterator const pos, K&& key, Args&& ... args) -> std::pair<iterator, bool>
+        {
+            if (this->key_at_equals(pos, key))
+            {
+                return {this->to_iterator(pos), false};
+            }
+
+            auto const inserted = this->storage().insert(
+                pos,
+                value_type(
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...)));
+            return {inserted, true};
+        }
+
+        template <typename K, typename M>
+        auto insert_or_assign_at(const_iterator const pos, K&& key, M&& obj) -> std::pair<iterator, bool>
+        {
+            if (this->key_at_equals(pos, key))
+            {
+                auto const existing = this->to_iterator(pos);
+                existing->second = std::forward<M>(obj);
+                return {existing, false};
+            }
+
+            auto const inserted = this->storage().insert(
+                pos,
+                value_type(std::forward<K>(key), std::forward<M>(obj)));
+            return {inserted, true};
+        }
+    };
+}
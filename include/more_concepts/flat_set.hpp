@@ -0,0 +1,41 @@
+#pragma once
+
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#include "more_concepts/detail/flat_tree.hpp"
+#include "more_concepts/detail/key_of_value.hpp"
+
+namespace more_concepts
+{
+    /// An ordered unique set that stores its elements in a sorted random access container
+    /// (by default a vector), and looks them up with binary search.
+    /// Models ordered_unique_associative_container.
+    ///
+    /// See flat_map for the trade-offs compared to the node-based set.
+    /// Insertion and erasure invalidate all iterators.
+    template <
+        typename Key,
+        typename Compare = std::less<Key>,
+        detail::flat_tree_storage<Key> Container = std::vector<Key>>
+    class flat_set
+        : public detail::flat_tree<Key, Key, detail::identity_key, Compare, Container, false>
+    {
+        using base = detail::flat_tree<Key, Key, detail::identity_key, Compare, Container, false>;
+
+    public:
+        using typename base::value_type;
+        using value_compare = Compare;
+
+        using base::base;
+
+        auto operator=(std::initializer_list<value_type> const init_list) -> flat_set&
+        {
+            *this = flat_set(init_list, this->key_comp());
+            return *this;
+        }
+
+        [[nodiscard]] auto value_comp() const -> value_compare { return this->key_comp(); }
+    };
+}
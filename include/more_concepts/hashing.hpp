@@ -0,0 +1,94 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "more_concepts/base_concepts.hpp"
+
+namespace more_concepts
+{
+    /// Finalizes a hash value, so that all of its bits depend on all bits of the input
+    /// (the splitmix64 finalizer, or the murmur3 one for 32-bit size_t). Cheap enough to apply
+    /// on every lookup, it makes hashes that leave bits unpopulated, such as identity hashes,
+    /// safe for tables that index with the low (or high) bits only.
+    [[nodiscard]] constexpr auto mix_hash(std::size_t const hash) noexcept -> std::size_t
+    {
+        if constexpr (sizeof(std::size_t) >= 8)
+        {
+            auto x = static_cast<std::uint64_t>(hash);
+            x = (x ^ (x >> 30u)) * 0xbf58476d1ce4e5b9u;
+            x = (x ^ (x >> 27u)) * 0x94d049bb133111ebu;
+            return static_cast<std::size_t>(x ^ (x >> 31u));
+        }
+        else
+        {
+            auto x = static_cast<std::uint32_t>(hash);
+            x = (x ^ (x >> 16u)) * 0x85ebca6bu;
+            x = (x ^ (x >> 13u)) * 0xc2b2ae35u;
+            return static_cast<std::size_t>(x ^ (x >> 16u));
+        }
+    }
+
+    /// Applies mix_hash to the result of hash, unless Hash is an avalanching_hash_function
+    /// for the key type, in which case the result is already well mixed.
+    template <typename Hash, typename K>
+    [[nodiscard]] constexpr auto finalize_hash(Hash const& hash, K const& key)
+    noexcept(noexcept(hash(key))) -> std::size_t
+    {
+        if constexpr (avalanching_hash_function<Hash, K>)
+        {
+            return hash(key);
+        }
+        else
+        {
+            return mix_hash(hash(key));
+        }
+    }
+
+    namespace detail
+    {
+        template <typename Hash>
+        struct mixed_hash_base
+        {
+        };
+
+        template <transparent_function Hash>
+        struct mixed_hash_base<Hash>
+        {
+            using is_transparent = void;
+        };
+    }
+
+    /// A hash function adaptor that finalizes the results of Hash with mix_hash, unless Hash
+    /// is already an avalanching_hash_function. It is itself an avalanching_hash_function,
+    /// and transparent if Hash is, e.g. mixed_hash<std::hash<int>> can be used with tables that
+    /// do not mix hashes themselves.
+    template <typename Hash>
+    class mixed_hash : public detail::mixed_hash_base<Hash>
+    {
+    public:
+        using is_avalanching = void;
+
+        mixed_hash() = default;
+
+        explicit mixed_hash(Hash const& hash)
+            : hash_{hash}
+        {
+        }
+
+        template <typename K>
+        requires std::is_invocable_r_v<std::size_t, Hash const&, K const&>
+        [[nodiscard]] auto operator()(K const& key) const noexcept(noexcept(hash_(key))) -> std::size_t
+        {
+            return finalize_hash(hash_, key);
+        }
+
+        /// The adapted hash function.
+        [[nodiscard]] auto base() const noexcept -> Hash const& { return hash_; }
+
+    private:
+        [[no_unique_address]] Hash hash_ = {};
+    };
+}
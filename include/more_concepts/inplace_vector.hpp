@@ -0,0 +1,293 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/detail/vector_base.hpp"
+
+namespace more_concepts
+{
+    namespace detail
+    {
+        /// The elements and size of an inplace_vector.
+        ///
+        /// Trivially copyable elements are stored in an array of value-initialized objects, overwritten
+        /// as elements are added; this keeps the vector trivially copyable and usable in constant evaluation.
+        template <
+            typename T,
+            std::size_t N,
+            bool Trivial = std::is_trivially_copyable_v<T> and std::is_default_constructible_v<T>>
+        class inplace_vector_storage
+        {
+        public:
+            [[nodiscard]] constexpr auto data() noexcept -> T*
+            {
+                return elements_;
+            }
+
+            [[nodiscard]] constexpr auto data() const noexcept -> T const*
+            {
+                return elements_;
+            }
+
+            [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+            {
+                return size_;
+            }
+
+        protected:
+            constexpr auto set_size(std::size_t const size) noexcept -> void
+            {
+                size_ = size;
+            }
+
+        private:
+            T elements_[N == 0 ? 1 : N] = {};
+            std::size_t size_ = 0;
+        };
+
+        template <typename T, std::size_t N>
+        class inplace_vector_storage<T, N, false>
+        {
+        public:
+            inplace_vector_storage() = default;
+
+            inplace_vector_storage(inplace_vector_storage const& other)
+            {
+                std::uninitialized_copy_n(other.data(), other.size_, data());
+                size_ = other.size_;
+            }
+
+            inplace_vector_storage(inplace_vector_storage&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+            {
+                std::uninitialized_move_n(other.data(), other.size_, data());
+                size_ = other.size_;
+            }
+
+            auto operator=(inplace_vector_storage const& other) -> inplace_vector_storage&
+            {
+                if (this != &other)
+                {
+                    assign_elements(other.data(), other.size_);
+                }
+                return *this;
+            }
+
+            auto operator=(inplace_vector_storage&& other)
+            noexcept(std::is_nothrow_move_constructible_v<T> and std::is_nothrow_move_assignable_v<T>)
+            -> inplace_vector_storage&
+            {
+                if (this != &other)
+                {
+                    assign_elements(std::make_move_iterator(other.data()), other.size_);
+                }
+                return *this;
+            }
+
+            ~inplace_vector_storage()
+            {
+                std::destroy_n(data(), size_);
+            }
+
+            [[nodiscard]] auto data() noexcept -> T*
+            {
+                return storage_.data();
+            }
+
+            [[nodiscard]] auto data() const noexcept -> T const*
+            {
+                return storage_.data();
+            }
+
+            [[nodiscard]] auto size() const noexcept -> std::size_t
+            {
+                return size_;
+            }
+
+        protected:
+            auto set_size(std::size_t const size) noexcept -> void
+            {
+                size_ = size;
+            }
+
+        private:
+            [[no_unique_address]] inline_storage<T, N> storage_;
+            std::size_t size_ = 0;
+
+            /// Assigns count elements from first over the current elements, constructing
+            /// or destroying the elements past the end of the shorter sequence.
+            template <typename I>
+            auto assign_elements(I const first, std::size_t const count) -> void
+            {
+                auto* const elements = data();
+                auto const assigned = std::min(count, size_);
+                std::copy_n(first, assigned, elements);
+                if (count > size_)
+                {
+                    std::uninitialized_copy_n(first + assigned, count - assigned, elements + assigned);
+                }
+                else
+                {
+                    std::destroy(elements + count, elements + size_);
+                }
+                size_ = count;
+            }
+        };
+    }
+
+    /// A vector with a fixed capacity of N elements, stored inside the object itself.
+    /// It never allocates memory: growing it beyond N elements throws std::bad_alloc.
+    /// Models contiguous_container, inplace_back_constructing_container and fixed_capacity_container.
+    ///
+    /// If T is trivially copyable (and default constructible), so is the inplace_vector,
+    /// and it can be used in constant evaluation; its unused elements are value-initialized.
+    /// Moving an inplace_vector moves the elements one by one, leaving the moved-from elements in place.
+    template <typename T, std::size_t N>
+    class inplace_vector
+        : public detail::inplace_vector_storage<T, N>,
+          public detail::vector_base<inplace_vector<T, N>, T>
+    {
+        using storage = detail::inplace_vector_storage<T, N>;
+        using base = detail::vector_base<inplace_vector<T, N>, T>;
+
+        friend base;
+
+    public:
+        using typename base::value_type;
+        using typename base::size_type;
+        using typename base::difference_type;
+        using typename base::reference;
+        using typename base::const_reference;
+        using typename base::pointer;
+        using typename base::const_pointer;
+        using typename base::iterator;
+        using typename base::const_iterator;
+        using typename base::reverse_iterator;
+        using typename base::const_reverse_iterator;
+
+        // Construction
+
+        inplace_vector() = default;
+
+        constexpr explicit inplace_vector(size_type const count)
+        {
+            this->resize(count);
+        }
+
+        constexpr inplace_vector(size_type const count, T const& value)
+        {
+            this->assign(count, value);
+        }
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        requires std::constructible_from<T, std::iter_reference_t<I>>
+        constexpr inplace_vector(I const first, S const last)
+        {
+            this->assign(first, last);
+        }
+
+        constexpr inplace_vector(std::initializer_list<T> const init_list)
+        {
+            this->assign(init_list);
+        }
+
+        constexpr auto operator=(std::initializer_list<T> const init_list) -> inplace_vector&
+        {
+            this->assign(init_list);
+            return *this;
+        }
+
+        // Element access
+
+        using storage::data;
+
+        // Capacity
+
+        using storage::size;
+
+        [[nodiscard]] static constexpr auto capacity() noexcept -> size_type
+        {
+            return N;
+        }
+
+        [[nodiscard]] static constexpr auto max_size() noexcept -> size_type
+        {
+            return N;
+        }
+
+        // Modifiers
+
+        /// Appends an element constructed from args if the vector is not full.
+        /// Returns a pointer to the new element, or nullptr if the vector was full.
+        template <typename... Args>
+        requires std::constructible_from<T, Args...>
+        constexpr auto try_emplace_back(Args&& ... args) -> T*
+        {
+            auto const size = this->size();
+            if (size == N)
+            {
+                return nullptr;
+            }
+            auto* const element = std::construct_at(data() + size, std::forward<Args>(args)...);
+            this->set_size(size + 1);
+            return element;
+        }
+
+        constexpr auto try_push_back(T const& value) -> T*
+        {
+            return try_emplace_back(value);
+        }
+
+        constexpr auto try_push_back(T&& value) -> T*
+        {
+            return try_emplace_back(std::move(value));
+        }
+
+        constexpr auto swap(inplace_vector& other)
+        noexcept(std::is_nothrow_swappable_v<T> and std::is_nothrow_move_constructible_v<T>) -> void
+        {
+            auto& shorter = this->size() <= other.size() ? *this : other;
+            auto& longer = this->size() <= other.size() ? other : *this;
+            auto const common = shorter.size();
+            std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+            shorter.insert(shorter.end(), std::make_move_iterator(longer.begin() + common), std::make_move_iterator(longer.end()));
+            longer.erase(longer.begin() + common, longer.end());
+        }
+
+        friend constexpr auto swap(inplace_vector& lhs, inplace_vector& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void
+        {
+            lhs.swap(rhs);
+        }
+
+    private:
+        using storage::set_size;
+
+        // The storage cannot grow; the base class checks the requested capacity against
+        // max_size() before allocating, and throws through throw_capacity_exceeded() instead.
+
+        [[noreturn]] static auto allocate_buffer(size_type) -> T*
+        {
+            throw_capacity_exceeded();
+        }
+
+        static constexpr auto deallocate_buffer(T*, size_type) noexcept -> void
+        {
+        }
+
+        static constexpr auto adopt_buffer(T*, size_type) noexcept -> void
+        {
+        }
+
+        [[noreturn]] static auto throw_capacity_exceeded() -> void
+        {
+            throw std::bad_alloc{};
+        }
+    };
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <concepts>
+#include <iterator>
+#include <utility>
+
+/// Cheap versions of the container concepts.
+///
+/// Each lite concept checks only the core lookup and mutation surface of its full counterpart,
+/// so constraining on it costs a fraction of the front-end time. The full concepts are defined
+/// in terms of the lite ones, so they subsume them: an overload constrained on a full concept
+/// is always preferred over one constrained on the matching lite concept.
+namespace more_concepts::lite
+{
+    /// A type with the basic container member types, that can be iterated over.
+    template <typename C>
+    concept container =
+    requires(C& cont, C const& const_cont)
+    {
+        typename C::value_type;
+        typename C::reference;
+        typename C::const_reference;
+        typename C::size_type;
+
+        typename C::iterator;
+        typename C::const_iterator;
+        requires std::forward_iterator<typename C::iterator>;
+        requires std::forward_iterator<typename C::const_iterator>;
+
+        { cont.begin() } -> std::same_as<typename C::iterator>;
+        { cont.end() } -> std::same_as<typename C::iterator>;
+        { const_cont.begin() } -> std::same_as<typename C::const_iterator>;
+        { const_cont.end() } -> std::same_as<typename C::const_iterator>;
+    };
+
+    /// A lite container that knows its size.
+    template <typename C>
+    concept sized_container
+    = container<C> and
+      requires(C const& const_cont)
+      {
+          { const_cont.size() } -> std::same_as<typename C::size_type>;
+      };
+
+    /// A lite container with access to the beginning of the sequence.
+    template <typename C>
+    concept sequence_container
+    = container<C> and
+      requires(C& cont)
+      {
+          { cont.front() } -> std::same_as<typename C::reference>;
+      };
+
+    /// A lite sequence container that allows indexed access.
+    template <typename C>
+    concept random_access_container
+    = sequence_container<C> and
+      sized_container<C> and
+      requires(C& cont, typename C::size_type const idx)
+      {
+          requires std::random_access_iterator<typename C::iterator>;
+
+          { cont[idx] } -> std::same_as<typename C::reference>;
+      };
+
+    /// A lite random access container that stores elements in a contiguous memory region.
+    template <typename C>
+    concept contiguous_container
+    = random_access_container<C> and
+      requires(C& cont)
+      {
+          requires std::contiguous_iterator<typename C::iterator>;
+
+          cont.data();
+      };
+
+    /// A lite sequence container that allows insertion and erasure at the back.
+    template <typename C>
+    concept back_growable_container
+    = sequence_container<C> and
+      requires(C& cont, typename C::value_type&& tmp_value)
+      {
+          { cont.back() } -> std::same_as<typename C::reference>;
+          cont.pop_back();
+
+          requires not std::movable<typename C::value_type> or
+                   requires { cont.push_back(std::move(tmp_value)); };
+      };
+
+    /// A lite container that provides lookup and erasure of objects based on keys.
+    template <typename C>
+    concept associative_container
+    = sized_container<C> and
+      requires(C& cont, C const& const_cont)
+      {
+          typename C::key_type;
+
+          requires
+          requires(typename C::key_type const& key)
+          {
+              { const_cont.contains(key) } -> std::same_as<bool>;
+              { cont.find(key) } -> std::same_as<typename C::iterator>;
+              { const_cont.find(key) } -> std::same_as<typename C::const_iterator>;
+              { cont.erase(key) } -> std::same_as<typename C::size_type>;
+          };
+      };
+
+    /// A lite associative container ordered on keys.
+    template <typename C>
+    concept ordered_associative_container
+    = associative_container<C> and
+      requires(C& cont)
+      {
+          typename C::key_compare;
+
+          requires
+          requires(typename C::key_type const& key)
+          {
+              { cont.lower_bound(key) } -> std::same_as<typename C::iterator>;
+              { cont.upper_bound(key) } -> std::same_as<typename C::iterator>;
+          };
+      };
+
+    /// A lite associative container based on key hashing.
+    template <typename C>
+    concept unordered_associative_container
+    = associative_container<C> and
+      requires
+      {
+          typename C::hasher;
+          typename C::key_equal;
+      };
+
+    /// A lite associative container that stores a mapped object alongside its keys.
+    template <typename C>
+    concept map_container
+    = associative_container<C> and
+      requires
+      {
+          typename C::mapped_type;
+      };
+
+    /// A lite map container without multiple key occurrence.
+    template <typename C>
+    concept unique_map_container
+    = map_container<C> and
+      requires(C& cont, C const& const_cont, typename C::key_type const& key)
+      {
+          // Checked access
+          { cont.at(key) } -> std::same_as<typename C::mapped_type&>;
+          { const_cont.at(key) } -> std::same_as<typename C::mapped_type const&>;
+
+          // operator[] access
+          requires not std::default_initializable<typename C::mapped_type> or
+                   not std::copyable<typename C::key_type> or
+                   requires {{ cont[key] } -> std::same_as<typename C::mapped_type&>; };
+
+          // Insertion
+          requires not std::copyable<typename C::mapped_type> or
+                   not std::copyable<typename C::key_type> or
+                   requires(typename C::mapped_type const& obj)
+                   {
+                       {
+                       cont.insert_or_assign(key, obj)
+                       } -> std::same_as<std::pair<typename C::iterator, bool>>;
+                   };
+      };
+}
@@ -0,0 +1,352 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/base_concepts.hpp"
+#include "more_concepts/detail/file_mapping.hpp"
+#include "more_concepts/flat_map.hpp"
+
+namespace more_concepts
+{
+    namespace detail
+    {
+        /// Types that can be written to a file as bytes, and used in place once mapped back.
+        template <typename T>
+        concept mappable = std::is_trivially_copyable_v<T> and not std::is_pointer_v<T>;
+
+        /// The header of a mapped_flat_map file, followed (at data_offset) by size values.
+        /// The sizes identify the key and mapped types, and byte_order the endianness of the writer.
+        struct mapped_flat_map_header
+        {
+            static constexpr auto expected_magic = std::array<char, 8>{'m', 'c', 'f', 'l', 'a', 't', '0', '1'};
+            static constexpr std::uint32_t expected_byte_order = 0x01020304;
+
+            std::array<char, 8> magic;
+            std::uint32_t byte_order;
+            std::uint32_t key_size;
+            std::uint32_t mapped_size;
+            std::uint32_t value_size;
+            std::uint64_t size;
+            std::uint64_t data_offset;
+        };
+
+        template <typename Value>
+        inline constexpr std::size_t mapped_flat_map_data_offset
+            = (sizeof(mapped_flat_map_header) + alignof(Value) - 1) / alignof(Value) * alignof(Value);
+    }
+
+    /// A read-only ordered unique map served directly from a memory-mapped file, written
+    /// beforehand by write_mapped_flat_map. Models read_only_associative_container.
+    ///
+    /// Opening the map only maps the file: there is no parsing or allocation per element, pages
+    /// are read from disk as lookups touch them, and processes mapping the same file share them.
+    /// Lookups are binary searches, as in flat_map.
+    ///
+    /// Key and T must be trivially copyable (the elements are the bytes of the file), and the file
+    /// must have been written on a platform with the same type layout. Copies share the mapping.
+    template <detail::mappable Key, detail::mappable T, typename Compare = std::less<Key>>
+    class mapped_flat_map
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<Key, T>;
+        using key_compare = Compare;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = value_type const&;
+        using iterator = value_type const*;
+        using const_iterator = value_type const*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        mapped_flat_map() = default;
+
+        /// Maps the file at path. Throws std::system_error if it cannot be mapped,
+        /// and std::runtime_error if it was not written for this key and mapped type.
+        explicit mapped_flat_map(std::filesystem::path const& path, key_compare const& comp = key_compare())
+            : mapping_{std::make_shared<detail::file_mapping const>(path)}
+            , comp_{comp}
+        {
+            auto const bytes = mapping_->bytes();
+            auto header = detail::mapped_flat_map_header{};
+            if (bytes.size() < sizeof(header))
+            {
+                throw_invalid_file(path);
+            }
+            std::memcpy(&header, bytes.data(), sizeof(header));
+
+            if (header.magic != header.expected_magic or
+                header.byte_order != header.expected_byte_order or
+                header.key_size != sizeof(key_type) or
+                header.mapped_size != sizeof(mapped_type) or
+                header.value_size != sizeof(value_type) or
+                header.data_offset != detail::mapped_flat_map_data_offset<value_type> or
+                bytes.size() < header.data_offset or
+                header.size > (bytes.size() - header.data_offset) / sizeof(value_type))
+            {
+                throw_invalid_file(path);
+            }
+
+            // Mappings are page aligned, so the values are suitably aligned.
+            values_ = {
+                reinterpret_cast<value_type const*>(bytes.data() + header.data_offset),
+                static_cast<size_type>(header.size)};
+        }
+
+        mapped_flat_map(mapped_flat_map const&) = default;
+
+        mapped_flat_map(mapped_flat_map&& other) noexcept
+            : mapping_{std::move(other.mapping_)}
+            , values_{std::exchange(other.values_, {})}
+            , comp_{other.comp_}
+        {
+        }
+
+        auto operator=(mapped_flat_map const&) -> mapped_flat_map& = default;
+
+        auto operator=(mapped_flat_map&& other) noexcept -> mapped_flat_map&
+        {
+            mapping_ = std::move(other.mapping_);
+            values_ = std::exchange(other.values_, {});
+            comp_ = other.comp_;
+            return *this;
+        }
+
+        ~mapped_flat_map() = default;
+
+        // Iterators
+
+        [[nodiscard]] auto begin() const noexcept -> const_iterator { return values_.data(); }
+
+        [[nodiscard]] auto cbegin() const noexcept -> const_iterator { return begin(); }
+
+        [[nodiscard]] auto end() const noexcept -> const_iterator { return values_.data() + values_.size(); }
+
+        [[nodiscard]] auto cend() const noexcept -> const_iterator { return end(); }
+
+        [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator{end()}; }
+
+        [[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator { return rbegin(); }
+
+        [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator{begin()}; }
+
+        [[nodiscard]] auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+        // Capacity
+
+        [[nodiscard]] auto empty() const noexcept -> bool { return values_.empty(); }
+
+        [[nodiscard]] auto size() const noexcept -> size_type { return values_.size(); }
+
+        [[nodiscard]] auto max_size() const noexcept -> size_type
+        {
+            return static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(value_type);
+        }
+
+        /// The sorted elements.
+        [[nodiscard]] auto sequence() const noexcept -> std::span<value_type const> { return values_; }
+
+        // Observers
+
+        [[nodiscard]] auto key_comp() const -> key_compare { return comp_; }
+
+        // Lookup
+        //
+        // With a transparent comparator, the lookup functions also accept any key type K
+        // comparable with key_type, without converting it.
+
+        [[nodiscard]] auto at(key_type const& key) const -> mapped_type const&
+        {
+            auto const pos = find(key);
+            if (pos == end())
+            {
+                throw std::out_of_range{"more_concepts::mapped_flat_map::at: key not found"};
+            }
+            return pos->second;
+        }
+
+        [[nodiscard]] auto find(key_type const& key) const -> const_iterator
+        {
+            return find_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto find(K const& key) const -> const_iterator
+        {
+            return find_key(key);
+        }
+
+        [[nodiscard]] auto count(key_type const& key) const -> size_type
+        {
+            return find_key(key) != end() ? 1 : 0;
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto count(K const& key) const -> size_type
+        {
+            // A transparent comparator may consider several keys equivalent to key.
+            auto const [first, last] = equal_range(key);
+            return static_cast<size_type>(last - first);
+        }
+
+        [[nodiscard]] auto contains(key_type const& key) const -> bool
+        {
+            return find_key(key) != end();
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto contains(K const& key) const -> bool
+        {
+            return find_key(key) != end();
+        }
+
+        [[nodiscard]] auto lower_bound(key_type const& key) const -> const_iterator
+        {
+            return lower_bound_of_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto lower_bound(K const& key) const -> const_iterator
+        {
+            return lower_bound_of_key(key);
+        }
+
+        [[nodiscard]] auto upper_bound(key_type const& key) const -> const_iterator
+        {
+            return upper_bound_of_key(key);
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto upper_bound(K const& key) const -> const_iterator
+        {
+            return upper_bound_of_key(key);
+        }
+
+        [[nodiscard]] auto equal_range(key_type const& key) const -> std::pair<const_iterator, const_iterator>
+        {
+            // The keys are unique, so the range has at most one element.
+            auto const first = lower_bound_of_key(key);
+            auto const found = first != end() and not comp_(key, first->first);
+            return {first, found ? first + 1 : first};
+        }
+
+        template <typename K>
+        requires transparent_function<Compare>
+        [[nodiscard]] auto equal_range(K const& key) const -> std::pair<const_iterator, const_iterator>
+        {
+            return {lower_bound_of_key(key), upper_bound_of_key(key)};
+        }
+
+        // Comparison
+
+        friend auto operator==(mapped_flat_map const& lhs, mapped_flat_map const& rhs) -> bool
+        requires std::equality_comparable<value_type>
+        {
+            return std::ranges::equal(lhs.values_, rhs.values_);
+        }
+
+    private:
+        std::shared_ptr<detail::file_mapping const> mapping_;
+        std::span<value_type const> values_;
+        [[no_unique_address]] key_compare comp_ = {};
+
+        template <typename K>
+        [[nodiscard]] auto lower_bound_of_key(K const& key) const -> const_iterator
+        {
+            return std::partition_point(
+                begin(), end(), [&](value_type const& value) { return comp_(value.first, key); });
+        }
+
+        template <typename K>
+        [[nodiscard]] auto upper_bound_of_key(K const& key) const -> const_iterator
+        {
+            return std::partition_point(
+                begin(), end(), [&](value_type const& value) { return not comp_(key, value.first); });
+        }
+
+        template <typename K>
+        [[nodiscard]] auto find_key(K const& key) const -> const_iterator
+        {
+            auto const pos = lower_bound_of_key(key);
+            return pos != end() and not comp_(key, pos->first) ? pos : end();
+        }
+
+        [[noreturn]] static auto throw_invalid_file(std::filesystem::path const& path) -> void
+        {
+            throw std::runtime_error{
+                "more_concepts::mapped_flat_map: " + path.string() +
+                " is not a mapped_flat_map file of this key and mapped type"};
+        }
+    };
+
+    /// Writes the elements of map to a file at path that mapped_flat_map<Key, T, Compare> can map.
+    /// The file is written next to path first, and then renamed over it, so processes that have
+    /// the previous file mapped keep their view of it. Throws std::ios_base::failure
+    /// or std::filesystem::filesystem_error on failure.
+    template <detail::mappable Key, detail::mappable T, typename Compare, typename Container>
+    auto write_mapped_flat_map(std::filesystem::path const& path, flat_map<Key, T, Compare, Container> const& map)
+    -> void
+    {
+        using value_type = std::pair<Key, T>;
+
+        auto header = detail::mapped_flat_map_header{};
+        header.magic = header.expected_magic;
+        header.byte_order = header.expected_byte_order;
+        header.key_size = sizeof(Key);
+        header.mapped_size = sizeof(T);
+        header.value_size = sizeof(value_type);
+        header.size = map.size();
+        header.data_offset = detail::mapped_flat_map_data_offset<value_type>;
+
+        auto temporary_path = path;
+        temporary_path += ".tmp";
+        {
+            auto file = std::ofstream{};
+            file.exceptions(std::ios::failbit | std::ios::badbit);
+            file.open(temporary_path, std::ios::binary | std::ios::trunc);
+
+            auto padded_header = std::array<char, detail::mapped_flat_map_data_offset<value_type>>{};
+            std::memcpy(padded_header.data(), &header, sizeof(header));
+            file.write(padded_header.data(), static_cast<std::streamsize>(padded_header.size()));
+
+            auto const& values = map.sequence();
+            if constexpr (std::ranges::contiguous_range<Container>)
+            {
+                file.write(
+                    reinterpret_cast<char const*>(std::ranges::data(values)),
+                    static_cast<std::streamsize>(values.size() * sizeof(value_type)));
+            }
+            else
+            {
+                for (auto const& value : values)
+                {
+                    file.write(reinterpret_cast<char const*>(&value), sizeof(value_type));
+                }
+            }
+        }
+        std::filesystem::rename(temporary_path, path);
+    }
+}
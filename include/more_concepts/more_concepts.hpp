@@ -3,7 +3,15 @@
 #include "more_concepts/associative_containers.hpp"
 #include "more_concepts/base_concepts.hpp"
 #include "more_concepts/base_containers.hpp"
+#include "more_concepts/bulk_algorithms.hpp"
+#include "more_concepts/columnar_containers.hpp"
+#include "more_concepts/concurrent_containers.hpp"
+#include "more_concepts/container_category.hpp"
+#include "more_concepts/hashing.hpp"
+#include "more_concepts/lite_containers.hpp"
 #include "more_concepts/mock_iterator.hpp"
+#include "more_concepts/node_algorithms.hpp"
+#include "more_concepts/relocation.hpp"
 #include "more_concepts/sequence_containers.hpp"
 
 // TODO write readme
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "more_concepts/associative_containers.hpp"
+#include "more_concepts/base_concepts.hpp"
+
+namespace more_concepts
+{
+    namespace detail
+    {
+        /// Node extractable containers whose nodes can be inserted into each other,
+        /// e.g. map and multimap with the same key, mapped and allocator types.
+        template <typename Src, typename Dst>
+        concept node_compatible_containers
+        = node_extractable_container<Src> and
+          node_extractable_container<Dst> and
+          std::same_as<typename Src::node_type, typename Dst::node_type>;
+
+        /// A random access range of containers that the nodes of Src can be inserted into.
+        template <typename R, typename Src>
+        concept node_destination_range
+        = requires(R& range)
+        {
+            { std::ranges::begin(range) } -> std::random_access_iterator;
+            { std::ranges::size(range) } -> std::convertible_to<std::size_t>;
+        } and
+          node_compatible_containers<Src, std::iter_value_t<decltype(std::ranges::begin(std::declval<R&>()))>>;
+
+        template <typename C>
+        auto key_of(typename C::value_type const& value) -> typename C::key_type const&
+        {
+            if constexpr (requires { typename C::mapped_type; })
+            {
+                return value.first;
+            }
+            else
+            {
+                return value;
+            }
+        }
+
+        /// Moves the node at pos from src to dst, unless dst has unique keys and already contains
+        /// the key (then the element stays in src). Returns whether the node was moved.
+        template <typename Src, typename Dst>
+        auto transfer_node(Src& src, typename Src::iterator const pos, Dst& dst) -> bool
+        {
+            if constexpr (unique_associative_container<Dst>)
+            {
+                if (dst.contains(key_of<Src>(*pos)))
+                {
+                    return false;
+                }
+            }
+            dst.insert(src.extract(pos));
+            return true;
+        }
+    }
+
+    /// Moves the elements of src that satisfy pred to dst (a different container), by relinking
+    /// their nodes: no element is copied, moved or reallocated. If dst has unique keys,
+    /// elements whose key it already contains stay in src. Returns the number of elements moved.
+    template <node_extractable_container Src, node_extractable_container Dst, typename Pred>
+    requires detail::node_compatible_containers<Src, Dst> and
+             invocable_as<Pred, bool(typename Src::value_type const&)>
+    auto move_matching(Src& src, Dst& dst, Pred pred) -> typename Src::size_type
+    {
+        auto moved = typename Src::size_type{0};
+        for (auto it = src.begin(); it != src.end();)
+        {
+            auto const pos = it++;
+            if (std::invoke(pred, std::as_const(*pos)) and detail::transfer_node(src, pos, dst))
+            {
+                ++moved;
+            }
+        }
+        return moved;
+    }
+
+    /// Distributes the elements of src between destinations (a random access range of containers,
+    /// not including src) by relinking their nodes: each element is moved to destinations[i],
+    /// where i is bucket_of(element). Elements whose i is not less than the number of destinations
+    /// stay in src, as do elements whose key is already contained in a destination with unique keys.
+    /// Returns the number of elements moved.
+    template <node_extractable_container Src, detail::node_destination_range<Src> Dsts, typename BucketFn>
+    requires invocable_as<BucketFn, std::size_t(typename Src::value_type const&)>
+    auto rebucket(Src& src, Dsts& destinations, BucketFn bucket_of) -> typename Src::size_type
+    {
+        auto const first = std::ranges::begin(destinations);
+        auto const count = static_cast<std::size_t>(std::ranges::size(destinations));
+
+        auto moved = typename Src::size_type{0};
+        for (auto it = src.begin(); it != src.end();)
+        {
+            auto const pos = it++;
+            auto const bucket = static_cast<std::size_t>(std::invoke(bucket_of, std::as_const(*pos)));
+            if (bucket < count and
+                detail::transfer_node(src, pos, first[static_cast<std::iter_difference_t<decltype(first)>>(bucket)]))
+            {
+                ++moved;
+            }
+        }
+        return moved;
+    }
+}
@@ -0,0 +1,331 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "more_concepts/sequence_containers.hpp"
+
+namespace more_concepts
+{
+    namespace detail
+    {
+        /// Max-heap operations on a d-ary heap stored in a random access container.
+        /// The children of the element at index i are at indices i * Arity + 1 to i * Arity + Arity.
+        template <std::size_t Arity>
+        struct dary_heap
+        {
+            /// Moves value up from the hole at index, until its parent is not less than it.
+            template <std::random_access_iterator I, typename T, typename Compare>
+            static constexpr auto sift_up(I const first, std::size_t index, T&& value, Compare& comp) -> void
+            {
+                while (index > 0)
+                {
+                    auto const parent = (index - 1) / Arity;
+                    if (not comp(first[parent], value))
+                    {
+                        break;
+                    }
+                    first[index] = std::move(first[parent]);
+                    index = parent;
+                }
+                first[index] = std::forward<T>(value);
+            }
+
+            /// Moves value down from the hole at index, until none of its children are greater than it.
+            template <std::random_access_iterator I, typename T, typename Compare>
+            static constexpr auto sift_down(I const first, std::size_t const size, std::size_t index, T&& value, Compare& comp)
+            -> void
+            {
+                while (true)
+                {
+                    auto const first_child = index * Arity + 1;
+                    if (first_child >= size)
+                    {
+                        break;
+                    }
+
+                    auto const last_child = std::min(first_child + Arity, size);
+                    auto greatest = first_child;
+                    for (auto child = first_child + 1; child < last_child; ++child)
+                    {
+                        greatest = comp(first[greatest], first[child]) ? child : greatest;
+                    }
+
+                    if (not comp(value, first[greatest]))
+                    {
+                        break;
+                    }
+                    first[index] = std::move(first[greatest]);
+                    index = greatest;
+                }
+                first[index] = std::forward<T>(value);
+            }
+
+            /// Moves the greatest children up into the hole at index until it reaches a leaf,
+            /// then moves value up from there. The value moved into the hole is usually taken
+            /// from the bottom of the heap, and belongs near the bottom again; this way, it is only
+            /// compared against its few final ancestors instead of against every level's children.
+            template <std::random_access_iterator I, typename T, typename Compare>
+            static constexpr auto sift_down_to_leaf(
+                I const first,
+                std::size_t const size,
+                std::size_t index,
+                T&& value,
+                Compare& comp)
+            -> void
+            {
+                while (true)
+                {
+                    auto const first_child = index * Arity + 1;
+                    if (first_child >= size)
+                    {
+                        break;
+                    }
+
+                    auto const last_child = std::min(first_child + Arity, size);
+                    auto greatest = first_child;
+                    for (auto child = first_child + 1; child < last_child; ++child)
+                    {
+                        greatest = comp(first[greatest], first[child]) ? child : greatest;
+                    }
+
+                    first[index] = std::move(first[greatest]);
+                    index = greatest;
+                }
+                sift_up(first, index, std::forward<T>(value), comp);
+            }
+
+            /// Restores the heap property of the subtree rooted at index.
+            template <std::random_access_iterator I, typename Compare>
+            static constexpr auto sift_down(I const first, std::size_t const size, std::size_t const index, Compare& comp)
+            -> void
+            {
+                auto value = std::move(first[index]);
+                sift_down(first, size, index, std::move(value), comp);
+            }
+
+            /// Floyd's bottom-up heap construction, in linear time.
+            template <std::random_access_iterator I, typename Compare>
+            static constexpr auto make_heap(I const first, std::size_t const size, Compare& comp) -> void
+            {
+                if (size < 2)
+                {
+                    return;
+                }
+                for (auto index = (size - 2) / Arity + 1; index-- > 0;)
+                {
+                    sift_down(first, size, index, comp);
+                }
+            }
+        };
+    }
+
+    /// A priority queue adaptor, keeping the elements of a random access container in a d-ary max-heap.
+    /// The greatest element according to Compare is at the top.
+    ///
+    /// Compared to a binary heap (std::priority_queue), a 4-ary or 8-ary heap is half or a third
+    /// as deep, and the children of a node are adjacent in memory, so sifting touches fewer
+    /// cache lines; pop does more comparisons per level in exchange.
+    template <
+        typename T,
+        random_access_container_of<T> Seq = std::vector<T>,
+        typename Compare = std::less<T>,
+        std::size_t Arity = 4>
+    requires back_growable_container<Seq> and
+             std::strict_weak_order<Compare&, T const&, T const&> and
+             (Arity >= 2)
+    class priority_queue
+    {
+        using heap = detail::dary_heap<Arity>;
+
+    public:
+        using container_type = Seq;
+        using value_compare = Compare;
+        using value_type = typename Seq::value_type;
+        using size_type = typename Seq::size_type;
+        using reference = typename Seq::reference;
+        using const_reference = typename Seq::const_reference;
+
+        static constexpr auto arity = Arity;
+
+        priority_queue() = default;
+
+        explicit priority_queue(Compare const& comp)
+            : comp_{comp}
+        {
+        }
+
+        /// Adopts the elements of storage, and builds a heap from them in linear time.
+        priority_queue(Compare const& comp, Seq storage)
+            : storage_{std::move(storage)}
+            , comp_{comp}
+        {
+            make_heap();
+        }
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        priority_queue(I const first, S const last, Compare const& comp = Compare())
+            : comp_{comp}
+        {
+            push_range(std::ranges::subrange(first, last));
+        }
+
+        // Element access
+
+        [[nodiscard]] auto top() const -> const_reference
+        {
+            return storage_.front();
+        }
+
+        // Capacity
+
+        [[nodiscard]] auto empty() const -> bool
+        {
+            return storage_.empty();
+        }
+
+        [[nodiscard]] auto size() const -> size_type
+        {
+            return storage_.size();
+        }
+
+        auto reserve(size_type const n) -> void
+        requires requires(Seq& storage) { storage.reserve(n); }
+        {
+            storage_.reserve(n);
+        }
+
+        // Modifiers
+
+        auto push(value_type const& value) -> void
+        {
+            storage_.push_back(value);
+            sift_up_back();
+        }
+
+        auto push(value_type&& value) -> void
+        {
+            storage_.push_back(std::move(value));
+            sift_up_back();
+        }
+
+        template <typename... Args>
+        requires requires(Seq& storage, Args&& ... args) { storage.emplace_back(std::forward<Args>(args)...); }
+        auto emplace(Args&& ... args) -> void
+        {
+            storage_.emplace_back(std::forward<Args>(args)...);
+            sift_up_back();
+        }
+
+        /// Pushes all elements of range. If they outnumber the elements already in the queue
+        /// by enough, the heap is rebuilt bottom-up in linear time instead of sifting up each one.
+        template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, value_type>
+        auto push_range(R&& range) -> void
+        {
+            auto const old_size = storage_.size();
+            if constexpr (std::ranges::sized_range<R> and requires(Seq& storage) { storage.reserve(size_type{}); })
+            {
+                storage_.reserve(old_size + static_cast<size_type>(std::ranges::size(range)));
+            }
+            for (auto&& value : range)
+            {
+                storage_.push_back(std::forward<decltype(value)>(value));
+            }
+
+            auto const new_size = storage_.size();
+            auto const pushed = new_size - old_size;
+            // Sifting up costs up to one comparison per level of the heap for each pushed element,
+            // heapifying up to about two comparisons per element in the heap.
+            auto depth = size_type{0};
+            for (auto n = new_size; n > 1; n /= Arity)
+            {
+                ++depth;
+            }
+            if (pushed * depth > 2 * new_size)
+            {
+                make_heap();
+            }
+            else
+            {
+                auto const first = storage_.begin();
+                for (auto index = old_size; index < new_size; ++index)
+                {
+                    auto value = std::move(first[index]);
+                    heap::sift_up(first, index, std::move(value), comp_);
+                }
+            }
+        }
+
+        auto pop() -> void
+        {
+            auto value = std::move(storage_.back());
+            storage_.pop_back();
+            if (not storage_.empty())
+            {
+                heap::sift_down_to_leaf(storage_.begin(), storage_.size(), 0, std::move(value), comp_);
+            }
+        }
+
+        /// Replaces the top element with value. Equivalent to pop() followed by push(value),
+        /// but only restores the heap once.
+        auto pop_push(value_type const& value) -> void
+        {
+            // value may refer to an element (e.g. top()), which sifting overwrites.
+            pop_push_impl(value_type(value));
+        }
+
+        auto pop_push(value_type&& value) -> void
+        {
+            pop_push_impl(std::move(value));
+        }
+
+        auto swap(priority_queue& other)
+        noexcept(std::is_nothrow_swappable_v<Seq> and std::is_nothrow_swappable_v<Compare>) -> void
+        {
+            using std::swap;
+            swap(storage_, other.storage_);
+            swap(comp_, other.comp_);
+        }
+
+        friend auto swap(priority_queue& lhs, priority_queue& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void
+        {
+            lhs.swap(rhs);
+        }
+
+    private:
+        Seq storage_ = Seq();
+        [[no_unique_address]] Compare comp_ = Compare();
+
+        auto make_heap() -> void
+        {
+            heap::make_heap(storage_.begin(), storage_.size(), comp_);
+        }
+
+        auto sift_up_back() -> void
+        {
+            auto const index = storage_.size() - 1;
+            auto const first = storage_.begin();
+            auto value = std::move(first[index]);
+            heap::sift_up(first, index, std::move(value), comp_);
+        }
+
+        template <typename V>
+        auto pop_push_impl(V&& value) -> void
+        {
+            if (storage_.empty())
+            {
+                storage_.push_back(std::forward<V>(value));
+                return;
+            }
+            heap::sift_down_to_leaf(storage_.begin(), storage_.size(), 0, std::forward<V>(value), comp_);
+        }
+    };
+}
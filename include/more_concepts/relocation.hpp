@@ -0,0 +1,182 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/base_concepts.hpp"
+
+namespace more_concepts
+{
+    namespace detail
+    {
+        /// Types that can be relocated without the possibility of throwing.
+        template <typename T>
+        concept nothrow_relocatable
+        = trivially_relocatable<T> or
+          std::is_nothrow_move_constructible_v<T>;
+
+        template <typename I, typename O>
+        concept bytewise_relocatable_iterators
+        = std::contiguous_iterator<I> and
+          std::contiguous_iterator<O> and
+          std::same_as<std::iter_value_t<I>, std::iter_value_t<O>> and
+          trivially_relocatable<std::iter_value_t<I>>;
+    }
+
+    /// Relocates the object pointed to by src to the uninitialized storage pointed to by dest.
+    /// After the call, src points to uninitialized storage, and dest to the relocated object.
+    ///
+    /// Trivially relocatable objects are relocated by copying their bytes.
+    template <std::destructible T>
+    requires detail::nothrow_relocatable<T>
+    constexpr auto relocate_at(T* const src, T* const dest) noexcept -> T*
+    {
+        if constexpr (trivially_relocatable<T>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                std::memcpy(static_cast<void*>(dest), static_cast<void const*>(src), sizeof(T));
+                return dest;
+            }
+        }
+
+        std::construct_at(dest, std::move(*src));
+        std::destroy_at(src);
+        return dest;
+    }
+
+    /// Relocates the objects in the range [first, last) to the uninitialized storage beginning
+    /// at d_first. The ranges must not overlap. After the call, [first, last) is uninitialized.
+    /// Returns the end of the destination range.
+    ///
+    /// If both ranges are contiguous and the value type is trivially relocatable,
+    /// the objects are relocated with a single memcpy. Otherwise, the objects are move
+    /// constructed into the destination, and the source objects are destroyed afterwards.
+    /// If a move constructor throws, the already constructed destination objects are destroyed,
+    /// and the source range is left intact (with some objects in a moved-from state).
+    template <std::forward_iterator I, std::forward_iterator O>
+    requires std::same_as<std::iter_value_t<I>, std::iter_value_t<O>> and
+             std::is_lvalue_reference_v<std::iter_reference_t<I>> and
+             std::is_lvalue_reference_v<std::iter_reference_t<O>>
+    constexpr auto uninitialized_relocate(I first, I const last, O d_first) -> O
+    {
+        if constexpr (detail::bytewise_relocatable_iterators<I, O>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                auto const count = last - first;
+                if (count > 0)
+                {
+                    std::memcpy(
+                        static_cast<void*>(std::to_address(d_first)),
+                        static_cast<void const*>(std::to_address(first)),
+                        static_cast<std::size_t>(count) * sizeof(std::iter_value_t<I>));
+                }
+                return d_first + count;
+            }
+        }
+
+        auto const src_first = first;
+        auto d_current = d_first;
+        try
+        {
+            for (; first != last; ++first, ++d_current)
+            {
+                std::construct_at(std::addressof(*d_current), std::move(*first));
+            }
+        }
+        catch (...)
+        {
+            std::destroy(d_first, d_current);
+            throw;
+        }
+
+        std::destroy(src_first, last);
+        return d_current;
+    }
+
+    /// Relocates count objects beginning at first to the uninitialized storage beginning
+    /// at d_first, see uninitialized_relocate.
+    /// Returns the ends of the source and destination ranges.
+    template <std::forward_iterator I, std::forward_iterator O>
+    requires std::same_as<std::iter_value_t<I>, std::iter_value_t<O>> and
+             std::is_lvalue_reference_v<std::iter_reference_t<I>> and
+             std::is_lvalue_reference_v<std::iter_reference_t<O>>
+    constexpr auto uninitialized_relocate_n(I first, std::iter_difference_t<I> const count, O d_first)
+    -> std::pair<I, O>
+    {
+        auto last = std::next(first, count);
+        return {last, uninitialized_relocate(std::move(first), last, std::move(d_first))};
+    }
+
+    /// Relocates the objects in the contiguous range [first, last) to the range beginning
+    /// at d_first. Unlike uninitialized_relocate, the ranges may overlap, which makes this
+    /// suitable for shifting elements when inserting into or erasing from the middle of
+    /// a contiguous sequence. Parts of the destination range outside of [first, last) must be
+    /// uninitialized; parts of [first, last) outside of the destination range are uninitialized
+    /// after the call. Returns the end of the destination range.
+    ///
+    /// Trivially relocatable objects are relocated with a single memmove.
+    template <std::contiguous_iterator I>
+    requires std::is_lvalue_reference_v<std::iter_reference_t<I>> and
+             (not std::is_const_v<std::remove_reference_t<std::iter_reference_t<I>>>) and
+             detail::nothrow_relocatable<std::iter_value_t<I>>
+    constexpr auto relocate(I const first, I const last, I const d_first) noexcept -> I
+    {
+        auto const count = last - first;
+        auto* const src = std::to_address(first);
+        auto* const dest = std::to_address(d_first);
+
+        if (src == dest or count <= 0)
+        {
+            return d_first + count;
+        }
+
+        if constexpr (trivially_relocatable<std::iter_value_t<I>>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                std::memmove(
+                    static_cast<void*>(dest),
+                    static_cast<void const*>(src),
+                    static_cast<std::size_t>(count) * sizeof(std::iter_value_t<I>));
+                return d_first + count;
+            }
+        }
+
+        if (std::less<>{}(dest, src))
+        {
+            for (auto i = decltype(count){0}; i < count; ++i)
+            {
+                relocate_at(src + i, dest + i);
+            }
+        }
+        else
+        {
+            for (auto i = count; i > 0; --i)
+            {
+                relocate_at(src + i - 1, dest + i - 1);
+            }
+        }
+
+        return d_first + count;
+    }
+
+    /// Relocates count objects beginning at first to the range beginning at d_first,
+    /// see relocate. Returns the end of the destination range.
+    template <std::contiguous_iterator I>
+    requires std::is_lvalue_reference_v<std::iter_reference_t<I>> and
+             (not std::is_const_v<std::remove_reference_t<std::iter_reference_t<I>>>) and
+             detail::nothrow_relocatable<std::iter_value_t<I>>
+    constexpr auto relocate_n(I const first, std::iter_difference_t<I> const count, I const d_first) noexcept
+    -> I
+    {
+        return relocate(first, first + count, d_first);
+    }
+}
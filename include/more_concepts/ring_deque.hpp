@@ -0,0 +1,1029 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/detail/synth_three_way.hpp"
+#include "more_concepts/relocation.hpp"
+
+namespace more_concepts
+{
+    /// A double-ended queue stored in a single circular buffer, whose capacity is a power of two.
+    /// Models random_access_container, inplace_constructing_sequence_container,
+    /// inplace_front_constructing_container and inplace_back_constructing_container.
+    ///
+    /// Unlike deque, there is no map of blocks to go through on each access, and only one allocation
+    /// per growth; segments() exposes the (at most two) contiguous runs of elements for bulk processing.
+    /// Insertion and erasure at either end take amortized constant time, and in the middle, time
+    /// linear in the distance to the nearer end. Any insertion invalidates all iterators and references;
+    /// erasure at either end only invalidates the erased elements.
+    template <typename T, typename Allocator = std::allocator<T>>
+    class ring_deque
+    {
+        template <bool Const>
+        class iterator_impl;
+
+        using alloc_traits = std::allocator_traits<Allocator>;
+
+        static_assert(
+            std::same_as<typename alloc_traits::value_type, T>,
+            "Allocator::value_type must be the same as T");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using allocator_type = Allocator;
+        using reference = T&;
+        using const_reference = T const&;
+        using pointer = T*;
+        using const_pointer = T const*;
+        using iterator = iterator_impl<false>;
+        using const_iterator = iterator_impl<true>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        // Construction
+
+        ring_deque() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+        explicit ring_deque(Allocator const& alloc) noexcept
+            : alloc_{alloc}
+        {
+        }
+
+        explicit ring_deque(size_type const count, Allocator const& alloc = Allocator())
+            : ring_deque(alloc)
+        {
+            resize(count);
+        }
+
+        ring_deque(size_type const count, T const& value, Allocator const& alloc = Allocator())
+            : ring_deque(alloc)
+        {
+            insert(end(), count, value);
+        }
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        requires std::constructible_from<T, std::iter_reference_t<I>>
+        ring_deque(I const first, S const last, Allocator const& alloc = Allocator())
+            : ring_deque(alloc)
+        {
+            insert(end(), first, last);
+        }
+
+        ring_deque(std::initializer_list<T> const init_list, Allocator const& alloc = Allocator())
+            : ring_deque(init_list.begin(), init_list.end(), alloc)
+        {
+        }
+
+        ring_deque(ring_deque const& other)
+            : ring_deque(other, alloc_traits::select_on_container_copy_construction(other.alloc_))
+        {
+        }
+
+        ring_deque(ring_deque const& other, Allocator const& alloc)
+            : ring_deque(alloc)
+        {
+            reserve(other.size_);
+            copy_elements_from(other);
+        }
+
+        ring_deque(ring_deque&& other) noexcept
+            : alloc_{std::move(other.alloc_)}
+        {
+            steal_elements_from(other);
+        }
+
+        ring_deque(ring_deque&& other, Allocator const& alloc)
+            : ring_deque(alloc)
+        {
+            if (alloc_ == other.alloc_)
+            {
+                steal_elements_from(other);
+            }
+            else
+            {
+                reserve(other.size_);
+                move_elements_from(other);
+            }
+        }
+
+        auto operator=(ring_deque const& other) -> ring_deque&
+        {
+            if (this != &other)
+            {
+                if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+                {
+                    if (alloc_ != other.alloc_)
+                    {
+                        destroy_and_deallocate();
+                    }
+                    alloc_ = other.alloc_;
+                }
+                clear();
+                reserve(other.size_);
+                copy_elements_from(other);
+            }
+            return *this;
+        }
+
+        auto operator=(ring_deque&& other)
+        noexcept(alloc_traits::propagate_on_container_move_assignment::value or
+                 alloc_traits::is_always_equal::value) -> ring_deque&
+        {
+            if (this != &other)
+            {
+                constexpr auto propagate = alloc_traits::propagate_on_container_move_assignment::value;
+                if (propagate or alloc_ == other.alloc_)
+                {
+                    destroy_and_deallocate();
+                    if constexpr (propagate)
+                    {
+                        alloc_ = std::move(other.alloc_);
+                    }
+                    steal_elements_from(other);
+                }
+                else
+                {
+                    clear();
+                    reserve(other.size_);
+                    move_elements_from(other);
+                }
+            }
+            return *this;
+        }
+
+        auto operator=(std::initializer_list<T> const init_list) -> ring_deque&
+        {
+            assign(init_list);
+            return *this;
+        }
+
+        ~ring_deque()
+        {
+            destroy_and_deallocate();
+        }
+
+        auto assign(size_type const count, T const& value) -> void
+        {
+            // value may be an element of this deque.
+            auto const copy = value;
+            clear();
+            insert(end(), count, copy);
+        }
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        requires std::constructible_from<T, std::iter_reference_t<I>>
+        auto assign(I const first, S const last) -> void
+        {
+            clear();
+            insert(end(), first, last);
+        }
+
+        auto assign(std::initializer_list<T> const init_list) -> void
+        {
+            assign(init_list.begin(), init_list.end());
+        }
+
+        [[nodiscard]] auto get_allocator() const noexcept -> allocator_type
+        {
+            return alloc_;
+        }
+
+        // Iterators
+
+        [[nodiscard]] auto begin() noexcept -> iterator
+        {
+            return iterator{buffer_, mask(), head_};
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> const_iterator
+        {
+            return const_iterator{buffer_, mask(), head_};
+        }
+
+        [[nodiscard]] auto cbegin() const noexcept -> const_iterator
+        {
+            return begin();
+        }
+
+        [[nodiscard]] auto end() noexcept -> iterator
+        {
+            return iterator{buffer_, mask(), head_ + size_};
+        }
+
+        [[nodiscard]] auto end() const noexcept -> const_iterator
+        {
+            return const_iterator{buffer_, mask(), head_ + size_};
+        }
+
+        [[nodiscard]] auto cend() const noexcept -> const_iterator
+        {
+            return end();
+        }
+
+        [[nodiscard]] auto rbegin() noexcept -> reverse_iterator
+        {
+            return reverse_iterator{end()};
+        }
+
+        [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator
+        {
+            return const_reverse_iterator{end()};
+        }
+
+        [[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator
+        {
+            return rbegin();
+        }
+
+        [[nodiscard]] auto rend() noexcept -> reverse_iterator
+        {
+            return reverse_iterator{begin()};
+        }
+
+        [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator
+        {
+            return const_reverse_iterator{begin()};
+        }
+
+        [[nodiscard]] auto crend() const noexcept -> const_reverse_iterator
+        {
+            return rend();
+        }
+
+        /// The elements as at most two contiguous spans, in order; the second one is empty
+        /// unless the elements wrap around the end of the buffer.
+        [[nodiscard]] auto segments() noexcept -> std::array<std::span<T>, 2>
+        {
+            return segments_of(0, size_);
+        }
+
+        [[nodiscard]] auto segments() const noexcept -> std::array<std::span<T const>, 2>
+        {
+            auto const [first, second] = const_cast<ring_deque&>(*this).segments();
+            return {first, second};
+        }
+
+        // Element access
+
+        [[nodiscard]] auto operator[](size_type const pos) noexcept -> reference
+        {
+            return *slot(pos);
+        }
+
+        [[nodiscard]] auto operator[](size_type const pos) const noexcept -> const_reference
+        {
+            return *const_cast<ring_deque&>(*this).slot(pos);
+        }
+
+        [[nodiscard]] auto at(size_type const pos) -> reference
+        {
+            if (pos >= size_)
+            {
+                throw std::out_of_range{"more_concepts::ring_deque::at: index out of range"};
+            }
+            return *slot(pos);
+        }
+
+        [[nodiscard]] auto at(size_type const pos) const -> const_reference
+        {
+            return const_cast<ring_deque&>(*this).at(pos);
+        }
+
+        [[nodiscard]] auto front() noexcept -> reference
+        {
+            return buffer_[head_];
+        }
+
+        [[nodiscard]] auto front() const noexcept -> const_reference
+        {
+            return buffer_[head_];
+        }
+
+        [[nodiscard]] auto back() noexcept -> reference
+        {
+            return *slot(size_ - 1);
+        }
+
+        [[nodiscard]] auto back() const noexcept -> const_reference
+        {
+            return *const_cast<ring_deque&>(*this).slot(size_ - 1);
+        }
+
+        // Capacity
+
+        [[nodiscard]] auto empty() const noexcept -> bool
+        {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] auto size() const noexcept -> size_type
+        {
+            return size_;
+        }
+
+        [[nodiscard]] auto max_size() const noexcept -> size_type
+        {
+            return std::bit_floor(std::min<size_type>(
+                alloc_traits::max_size(alloc_),
+                static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(T)));
+        }
+
+        /// The size of the buffer, always a power of two (or zero).
+        [[nodiscard]] auto capacity() const noexcept -> size_type
+        {
+            return capacity_;
+        }
+
+        auto reserve(size_type const new_capacity) -> void
+        {
+            if (new_capacity > capacity_)
+            {
+                reallocate_with_gap(std::bit_ceil(checked_capacity(new_capacity)), size_, 0, [](T*) {});
+            }
+        }
+
+        /// Reduces the capacity to the smallest power of two not less than the size.
+        auto shrink_to_fit() -> void
+        {
+            if (size_ == 0)
+            {
+                destroy_and_deallocate();
+            }
+            else if (std::bit_ceil(size_) < capacity_)
+            {
+                reallocate_with_gap(std::bit_ceil(size_), size_, 0, [](T*) {});
+            }
+        }
+
+        // Modifiers
+
+        auto clear() noexcept -> void
+        {
+            for (auto const segment : segments())
+            {
+                std::destroy(segment.begin(), segment.end());
+            }
+            head_ = 0;
+            size_ = 0;
+        }
+
+        auto push_back(T const& value) -> void
+        {
+            emplace_back(value);
+        }
+
+        auto push_back(T&& value) -> void
+        {
+            emplace_back(std::move(value));
+        }
+
+        template <typename... Args>
+        auto emplace_back(Args&& ... args) -> reference
+        {
+            if (size_ == capacity_)
+            {
+                // The arguments may refer to elements, so they are used before relocating them.
+                reallocate_with_gap(grown_capacity(size_ + 1), size_, 1, [&](T* const gap) {
+                    std::construct_at(gap, std::forward<Args>(args)...);
+                });
+            }
+            else
+            {
+                std::construct_at(slot(size_), std::forward<Args>(args)...);
+                ++size_;
+            }
+            return back();
+        }
+
+        auto push_front(T const& value) -> void
+        {
+            emplace_front(value);
+        }
+
+        auto push_front(T&& value) -> void
+        {
+            emplace_front(std::move(value));
+        }
+
+        template <typename... Args>
+        auto emplace_front(Args&& ... args) -> reference
+        {
+            if (size_ == capacity_)
+            {
+                reallocate_with_gap(grown_capacity(size_ + 1), 0, 1, [&](T* const gap) {
+                    std::construct_at(gap, std::forward<Args>(args)...);
+                });
+            }
+            else
+            {
+                auto const new_head = (head_ - 1) & mask();
+                std::construct_at(buffer_ + new_head, std::forward<Args>(args)...);
+                head_ = new_head;
+                ++size_;
+            }
+            return front();
+        }
+
+        auto pop_back() noexcept -> void
+        {
+            std::destroy_at(slot(size_ - 1));
+            --size_;
+        }
+
+        auto pop_front() noexcept -> void
+        {
+            std::destroy_at(buffer_ + head_);
+            head_ = (head_ + 1) & mask();
+            --size_;
+        }
+
+        template <typename... Args>
+        auto emplace(const_iterator const pos, Args&& ... args) -> iterator
+        {
+            auto const index = index_of(pos);
+            if (index == size_)
+            {
+                emplace_back(std::forward<Args>(args)...);
+            }
+            else if (index == 0)
+            {
+                emplace_front(std::forward<Args>(args)...);
+            }
+            else if (size_ == capacity_)
+            {
+                reallocate_with_gap(grown_capacity(size_ + 1), index, 1, [&](T* const gap) {
+                    std::construct_at(gap, std::forward<Args>(args)...);
+                });
+            }
+            else
+            {
+                // Constructed before shifting, as the arguments may refer to elements.
+                auto value = T(std::forward<Args>(args)...);
+                if (index < size_ - index)
+                {
+                    emplace_front(std::move(front()));
+                    std::move(begin() + 2, begin() + index + 1, begin() + 1);
+                }
+                else
+                {
+                    emplace_back(std::move(back()));
+                    std::move_backward(begin() + index, end() - 2, end() - 1);
+                }
+                (*this)[index] = std::move(value);
+            }
+            return begin() + index;
+        }
+
+        auto insert(const_iterator const pos, T const& value) -> iterator
+        {
+            return emplace(pos, value);
+        }
+
+        auto insert(const_iterator const pos, T&& value) -> iterator
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        auto insert(const_iterator const pos, size_type const count, T const& value) -> iterator
+        {
+            return insert_n(index_of(pos), count, [&](T* const element) {
+                std::construct_at(element, value);
+            });
+        }
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        requires std::constructible_from<T, std::iter_reference_t<I>>
+        auto insert(const_iterator const pos, I first, S const last) -> iterator
+        {
+            auto const index = index_of(pos);
+            if constexpr (std::forward_iterator<I>)
+            {
+                auto const count = static_cast<size_type>(std::ranges::distance(first, last));
+                return insert_n(index, count, [&](T* const element) {
+                    std::construct_at(element, *first);
+                    ++first;
+                });
+            }
+            else
+            {
+                auto const old_size = size_;
+                try
+                {
+                    for (; first != last; ++first)
+                    {
+                        emplace_back(*first);
+                    }
+                }
+                catch (...)
+                {
+                    erase(begin() + old_size, end());
+                    throw;
+                }
+                std::rotate(begin() + index, begin() + old_size, end());
+                return begin() + index;
+            }
+        }
+
+        auto insert(const_iterator const pos, std::initializer_list<T> const init_list) -> iterator
+        {
+            return insert(pos, init_list.begin(), init_list.end());
+        }
+
+        auto erase(const_iterator const pos) -> iterator
+        {
+            return erase(pos, pos + 1);
+        }
+
+        /// Moves the elements on the side with fewer elements to close the gap.
+        auto erase(const_iterator const first, const_iterator const last) -> iterator
+        {
+            auto const index = index_of(first);
+            auto const count = index_of(last) - index;
+            if (count == 0)
+            {
+                return begin() + index;
+            }
+
+            if (index < size_ - index - count)
+            {
+                std::move_backward(begin(), begin() + index, begin() + index + count);
+                destroy_range(0, count);
+                head_ = (head_ + count) & mask();
+            }
+            else
+            {
+                std::move(begin() + index + count, end(), begin() + index);
+                destroy_range(size_ - count, size_);
+            }
+            size_ -= count;
+            return begin() + index;
+        }
+
+        auto resize(size_type const count) -> void
+        {
+            resize_with(count, [](T* const element) {
+                std::construct_at(element);
+            });
+        }
+
+        auto resize(size_type const count, T const& value) -> void
+        {
+            resize_with(count, [&](T* const element) {
+                std::construct_at(element, value);
+            });
+        }
+
+        auto swap(ring_deque& other) noexcept -> void
+        {
+            using std::swap;
+            swap(buffer_, other.buffer_);
+            swap(capacity_, other.capacity_);
+            swap(head_, other.head_);
+            swap(size_, other.size_);
+            if constexpr (alloc_traits::propagate_on_container_swap::value)
+            {
+                swap(alloc_, other.alloc_);
+            }
+        }
+
+        friend auto swap(ring_deque& lhs, ring_deque& rhs) noexcept -> void
+        {
+            lhs.swap(rhs);
+        }
+
+        // Comparison
+
+        friend auto operator==(ring_deque const& lhs, ring_deque const& rhs) -> bool
+        requires std::equality_comparable<T>
+        {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        friend auto operator<=>(ring_deque const& lhs, ring_deque const& rhs)
+        requires requires(T const& value) { detail::synth_three_way(value, value); }
+        {
+            return std::lexicographical_compare_three_way(
+                lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), detail::synth_three_way);
+        }
+
+    private:
+        T* buffer_ = nullptr;
+        /// 2^k, or 0.
+        size_type capacity_ = 0;
+        /// The index in buffer_ of the first element.
+        size_type head_ = 0;
+        size_type size_ = 0;
+        [[no_unique_address]] Allocator alloc_ = Allocator();
+
+        template <bool Const>
+        class iterator_impl
+        {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<Const, T const&, T&>;
+            using pointer = std::conditional_t<Const, T const*, T*>;
+
+            iterator_impl() = default;
+
+            template <bool OtherConst>
+            requires (Const and not OtherConst)
+            iterator_impl(iterator_impl<OtherConst> const& other) noexcept
+                : buffer_{other.buffer_}
+                , mask_{other.mask_}
+                , position_{other.position_}
+            {
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> reference
+            {
+                return buffer_[position_ & mask_];
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> pointer
+            {
+                return buffer_ + (position_ & mask_);
+            }
+
+            [[nodiscard]] auto operator[](difference_type const offset) const noexcept -> reference
+            {
+                return *(*this + offset);
+            }
+
+            auto operator++() noexcept -> iterator_impl&
+            {
+                ++position_;
+                return *this;
+            }
+
+            auto operator++(int) noexcept -> iterator_impl
+            {
+                auto copy = *this;
+                ++position_;
+                return copy;
+            }
+
+            auto operator--() noexcept -> iterator_impl&
+            {
+                --position_;
+                return *this;
+            }
+
+            auto operator--(int) noexcept -> iterator_impl
+            {
+                auto copy = *this;
+                --position_;
+                return copy;
+            }
+
+            auto operator+=(difference_type const offset) noexcept -> iterator_impl&
+            {
+                position_ += static_cast<size_type>(offset);
+                return *this;
+            }
+
+            auto operator-=(difference_type const offset) noexcept -> iterator_impl&
+            {
+                position_ -= static_cast<size_type>(offset);
+                return *this;
+            }
+
+            [[nodiscard]] friend auto operator+(iterator_impl it, difference_type const offset) noexcept
+            -> iterator_impl
+            {
+                return it += offset;
+            }
+
+            [[nodiscard]] friend auto operator+(difference_type const offset, iterator_impl it) noexcept
+            -> iterator_impl
+            {
+                return it += offset;
+            }
+
+            [[nodiscard]] friend auto operator-(iterator_impl it, difference_type const offset) noexcept
+            -> iterator_impl
+            {
+                return it -= offset;
+            }
+
+            [[nodiscard]] friend auto operator-(iterator_impl const& lhs, iterator_impl const& rhs) noexcept
+            -> difference_type
+            {
+                return static_cast<difference_type>(lhs.position_ - rhs.position_);
+            }
+
+            [[nodiscard]] friend auto operator==(iterator_impl const& lhs, iterator_impl const& rhs) noexcept
+            -> bool
+            {
+                return lhs.position_ == rhs.position_;
+            }
+
+            [[nodiscard]] friend auto operator<=>(iterator_impl const& lhs, iterator_impl const& rhs) noexcept
+            -> std::strong_ordering
+            {
+                return lhs - rhs <=> 0;
+            }
+
+        private:
+            friend class ring_deque;
+            friend class iterator_impl<not Const>;
+
+            T* buffer_ = nullptr;
+            size_type mask_ = 0;
+            /// The index of the element in the buffer, before wrapping around (masking);
+            /// head_ + index within the deque.
+            size_type position_ = 0;
+
+            iterator_impl(T* const buffer, size_type const mask, size_type const position) noexcept
+                : buffer_{buffer}
+                , mask_{mask}
+                , position_{position}
+            {
+            }
+        };
+
+        [[nodiscard]] auto mask() const noexcept -> size_type
+        {
+            return capacity_ - 1;
+        }
+
+        /// The slot of the element at index (which may be one past the last element).
+        [[nodiscard]] auto slot(size_type const index) noexcept -> T*
+        {
+            return buffer_ + ((head_ + index) & mask());
+        }
+
+        [[nodiscard]] auto index_of(const_iterator const pos) const noexcept -> size_type
+        {
+            return static_cast<size_type>(pos - begin());
+        }
+
+        /// The slots from index first to index last, as at most two contiguous spans.
+        [[nodiscard]] auto segments_of(size_type const first, size_type const last) noexcept
+        -> std::array<std::span<T>, 2>
+        {
+            if (first == last)
+            {
+                return {};
+            }
+            auto const start = (head_ + first) & mask();
+            auto const count = last - first;
+            auto const first_count = std::min(count, capacity_ - start);
+            return {std::span<T>{buffer_ + start, first_count}, std::span<T>{buffer_, count - first_count}};
+        }
+
+        auto destroy_range(size_type const first, size_type const last) noexcept -> void
+        {
+            for (auto const segment : segments_of(first, last))
+            {
+                std::destroy(segment.begin(), segment.end());
+            }
+        }
+
+        [[nodiscard]] auto checked_capacity(size_type const required) const -> size_type
+        {
+            if (required > max_size())
+            {
+                throw std::length_error{"more_concepts::ring_deque: maximum size exceeded"};
+            }
+            return required;
+        }
+
+        /// The capacity to grow to when at least required elements are needed: double the current
+        /// capacity, so that insertion at either end takes amortized constant time.
+        [[nodiscard]] auto grown_capacity(size_type const required) const -> size_type
+        {
+            auto const max_size = this->max_size();
+            auto const doubled = capacity_ == 0 ? std::min<size_type>(4, max_size) : std::min(capacity_ * 2, max_size);
+            return std::max(std::bit_ceil(checked_capacity(required)), doubled);
+        }
+
+        /// Copies if moving may throw and T is copyable (like std::move_if_noexcept).
+        static auto uninitialized_copy_or_move(std::span<T> const segment, T* const d_first) -> T*
+        {
+            if constexpr (std::is_copy_constructible_v<T>)
+            {
+                return std::uninitialized_copy(segment.begin(), segment.end(), d_first);
+            }
+            else
+            {
+                return std::uninitialized_move(segment.begin(), segment.end(), d_first);
+            }
+        }
+
+        /// Copies (or moves) the elements from index first to index last to d_first.
+        /// If this throws, the elements constructed so far are destroyed.
+        auto uninitialized_copy_or_move_range(size_type const first, size_type const last, T* const d_first) -> T*
+        {
+            auto const [head, tail] = segments_of(first, last);
+            auto* const middle = uninitialized_copy_or_move(head, d_first);
+            try
+            {
+                return uninitialized_copy_or_move(tail, middle);
+            }
+            catch (...)
+            {
+                std::destroy(d_first, middle);
+                throw;
+            }
+        }
+
+        /// Moves the elements to a new buffer of new_capacity elements, starting at its beginning,
+        /// in which construct creates gap_size new elements at index. If this throws, nothing is changed.
+        template <typename F>
+        auto reallocate_with_gap(size_type const new_capacity, size_type const index, size_type const gap_size, F&& construct)
+        -> void
+        {
+            auto* const buffer = alloc_traits::allocate(alloc_, new_capacity);
+            try
+            {
+                std::forward<F>(construct)(buffer + index);
+            }
+            catch (...)
+            {
+                alloc_traits::deallocate(alloc_, buffer, new_capacity);
+                throw;
+            }
+
+            if constexpr (detail::nothrow_relocatable<T>)
+            {
+                for (auto* out = buffer; auto const segment : segments_of(0, index))
+                {
+                    out = uninitialized_relocate(segment.data(), segment.data() + segment.size(), out);
+                }
+                for (auto* out = buffer + index + gap_size; auto const segment : segments_of(index, size_))
+                {
+                    out = uninitialized_relocate(segment.data(), segment.data() + segment.size(), out);
+                }
+            }
+            else
+            {
+                try
+                {
+                    auto* const front_end = uninitialized_copy_or_move_range(0, index, buffer);
+                    try
+                    {
+                        uninitialized_copy_or_move_range(index, size_, buffer + index + gap_size);
+                    }
+                    catch (...)
+                    {
+                        std::destroy(buffer, front_end);
+                        throw;
+                    }
+                }
+                catch (...)
+                {
+                    std::destroy_n(buffer + index, gap_size);
+                    alloc_traits::deallocate(alloc_, buffer, new_capacity);
+                    throw;
+                }
+                destroy_range(0, size_);
+            }
+
+            if (buffer_ != nullptr)
+            {
+                alloc_traits::deallocate(alloc_, buffer_, capacity_);
+            }
+            buffer_ = buffer;
+            capacity_ = new_capacity;
+            head_ = 0;
+            size_ += gap_size;
+        }
+
+        /// Inserts count elements at index, each constructed in place by construct(T*), in order.
+        /// If there is room, the new elements are constructed at the nearer end and rotated into place.
+        template <typename F>
+        auto insert_n(size_type const index, size_type const count, F construct) -> iterator
+        {
+            if (count == 0)
+            {
+                return begin() + index;
+            }
+
+            if (size_ + count > capacity_)
+            {
+                reallocate_with_gap(grown_capacity(size_ + count), index, count, [&](T* const gap) {
+                    auto constructed = size_type{0};
+                    try
+                    {
+                        for (; constructed < count; ++constructed)
+                        {
+                            construct(gap + constructed);
+                        }
+                    }
+                    catch (...)
+                    {
+                        std::destroy_n(gap, constructed);
+                        throw;
+                    }
+                });
+                return begin() + index;
+            }
+
+            auto const at_front = index < size_ - index;
+            auto const start = at_front ? (head_ - count) & mask() : (head_ + size_) & mask();
+            auto constructed = size_type{0};
+            try
+            {
+                for (; constructed < count; ++constructed)
+                {
+                    construct(buffer_ + ((start + constructed) & mask()));
+                }
+            }
+            catch (...)
+            {
+                for (auto i = size_type{0}; i < constructed; ++i)
+                {
+                    std::destroy_at(buffer_ + ((start + i) & mask()));
+                }
+                throw;
+            }
+
+            size_ += count;
+            if (at_front)
+            {
+                head_ = start;
+                std::rotate(begin(), begin() + count, begin() + count + index);
+            }
+            else
+            {
+                std::rotate(begin() + index, begin() + (size_ - count), end());
+            }
+            return begin() + index;
+        }
+
+        template <typename F>
+        auto resize_with(size_type const count, F construct) -> void
+        {
+            if (count <= size_)
+            {
+                destroy_range(count, size_);
+                size_ = count;
+            }
+            else
+            {
+                insert_n(size_, count - size_, construct);
+            }
+        }
+
+        /// Copies the elements of other to the end. There must be enough capacity.
+        auto copy_elements_from(ring_deque const& other) -> void
+        {
+            for (auto const segment : other.segments())
+            {
+                insert_n(size_, segment.size(), [it = segment.begin()](T* const element) mutable {
+                    std::construct_at(element, *it++);
+                });
+            }
+        }
+
+        /// Moves the elements of other to the end, leaving other empty. There must be enough capacity.
+        auto move_elements_from(ring_deque& other) -> void
+        {
+            for (auto const segment : other.segments())
+            {
+                insert_n(size_, segment.size(), [it = segment.begin()](T* const element) mutable {
+                    std::construct_at(element, std::move(*it++));
+                });
+            }
+            other.clear();
+        }
+
+        /// Takes the buffer of other, which is left empty. This must have no buffer.
+        auto steal_elements_from(ring_deque& other) noexcept -> void
+        {
+            buffer_ = std::exchange(other.buffer_, nullptr);
+            capacity_ = std::exchange(other.capacity_, 0);
+            head_ = std::exchange(other.head_, 0);
+            size_ = std::exchange(other.size_, 0);
+        }
+
+        auto destroy_and_deallocate() noexcept -> void
+        {
+            clear();
+            if (buffer_ != nullptr)
+            {
+                alloc_traits::deallocate(alloc_, buffer_, capacity_);
+                buffer_ = nullptr;
+                capacity_ = 0;
+            }
+        }
+    };
+}
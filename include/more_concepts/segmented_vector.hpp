@@ -0,0 +1,735 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "more_concepts/base_concepts.hpp"
+#include "more_concepts/detail/synth_three_way.hpp"
+
+namespace more_concepts
+{
+    namespace detail
+    {
+        /// About 4 KiB worth of elements, rounded down to a power of two, and at least 16.
+        template <typename T>
+        inline constexpr auto default_chunk_size = std::bit_floor(std::max<std::size_t>(16, 4096 / sizeof(T)));
+    }
+
+    /// A vector that stores its elements in chunks of ChunkSize elements each, allocated separately.
+    /// Models random_access_container, back_growable_container and inplace_back_constructing_container.
+    ///
+    /// Growing allocates one more chunk, and never moves, copies or reallocates the existing elements:
+    /// references to the elements are only invalidated by removing them. There is no reallocation
+    /// spike either, so the peak memory use stays close to the size, which matters for huge buffers.
+    /// Like deque's, iterators are invalidated by any insertion, as they point into the table of chunks.
+    /// Indexing takes a division and a load more than vector's (a shift and a mask, if ChunkSize
+    /// is a power of two); for_each_segment() passes the elements to a function as contiguous spans,
+    /// one per chunk, for bulk processing.
+    template <typename T, std::size_t ChunkSize = detail::default_chunk_size<T>, typename Allocator = std::allocator<T>>
+    requires (ChunkSize > 0)
+    class segmented_vector
+    {
+        template <bool Const>
+        class iterator_impl;
+
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using chunk_table = std::vector<T*, typename alloc_traits::template rebind_alloc<T*>>;
+
+        static_assert(
+            std::same_as<typename alloc_traits::value_type, T>,
+            "Allocator::value_type must be the same as T");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using allocator_type = Allocator;
+        using reference = T&;
+        using const_reference = T const&;
+        using pointer = T*;
+        using const_pointer = T const*;
+        using iterator = iterator_impl<false>;
+        using const_iterator = iterator_impl<true>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        /// The number of elements in each chunk.
+        static constexpr size_type chunk_size = ChunkSize;
+
+        /// Marks a container whose reserve allocates more storage without moving the elements,
+        /// so generic code (e.g. append_range) reserves exactly what it needs instead of doubling.
+        using is_segmented = void;
+
+        // Construction
+
+        segmented_vector() noexcept(std::is_nothrow_default_constructible_v<Allocator>)
+            : segmented_vector(Allocator())
+        {
+        }
+
+        explicit segmented_vector(Allocator const& alloc) noexcept
+            : chunks_(typename chunk_table::allocator_type(alloc))
+        {
+        }
+
+        explicit segmented_vector(size_type const count, Allocator const& alloc = Allocator())
+            : segmented_vector(alloc)
+        {
+            resize(count);
+        }
+
+        segmented_vector(size_type const count, T const& value, Allocator const& alloc = Allocator())
+            : segmented_vector(alloc)
+        {
+            resize(count, value);
+        }
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        requires std::constructible_from<T, std::iter_reference_t<I>>
+        segmented_vector(I const first, S const last, Allocator const& alloc = Allocator())
+            : segmented_vector(alloc)
+        {
+            append(first, last);
+        }
+
+        segmented_vector(std::initializer_list<T> const init_list, Allocator const& alloc = Allocator())
+            : segmented_vector(init_list.begin(), init_list.end(), alloc)
+        {
+        }
+
+        segmented_vector(segmented_vector const& other)
+            : segmented_vector(other, alloc_traits::select_on_container_copy_construction(other.get_allocator()))
+        {
+        }
+
+        segmented_vector(segmented_vector const& other, Allocator const& alloc)
+            : segmented_vector(alloc)
+        {
+            reserve(other.size_);
+            append(other.begin(), other.end());
+        }
+
+        segmented_vector(segmented_vector&& other) noexcept
+            : chunks_{std::move(other.chunks_)}
+            , size_{std::exchange(other.size_, 0)}
+        {
+            other.chunks_.clear();
+        }
+
+        segmented_vector(segmented_vector&& other, Allocator const& alloc)
+            : segmented_vector(alloc)
+        {
+            if (get_allocator() == other.get_allocator())
+            {
+                chunks_.swap(other.chunks_);
+                size_ = std::exchange(other.size_, 0);
+            }
+            else
+            {
+                reserve(other.size_);
+                append(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+            }
+        }
+
+        auto operator=(segmented_vector const& other) -> segmented_vector&
+        {
+            if (this != &other)
+            {
+                if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+                {
+                    if (get_allocator() != other.get_allocator())
+                    {
+                        destroy_and_deallocate();
+                        chunks_ = chunk_table(other.chunks_.get_allocator());
+                    }
+                }
+                clear();
+                reserve(other.size_);
+                append(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        auto operator=(segmented_vector&& other)
+        noexcept(alloc_traits::propagate_on_container_move_assignment::value or
+                 alloc_traits::is_always_equal::value) -> segmented_vector&
+        {
+            if (this != &other)
+            {
+                constexpr auto propagate = alloc_traits::propagate_on_container_move_assignment::value;
+                if (propagate or get_allocator() == other.get_allocator())
+                {
+                    // Only the table of chunks is moved, which takes its allocator along if it propagates.
+                    destroy_and_deallocate();
+                    chunks_ = std::move(other.chunks_);
+                    other.chunks_.clear();
+                    size_ = std::exchange(other.size_, 0);
+                }
+                else
+                {
+                    clear();
+                    reserve(other.size_);
+                    append(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                    other.clear();
+                }
+            }
+            return *this;
+        }
+
+        auto operator=(std::initializer_list<T> const init_list) -> segmented_vector&
+        {
+            assign(init_list);
+            return *this;
+        }
+
+        ~segmented_vector()
+        {
+            destroy_and_deallocate();
+        }
+
+        auto assign(size_type const count, T const& value) -> void
+        {
+            // value may be an element of this vector.
+            auto const copy = value;
+            clear();
+            resize(count, copy);
+        }
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        requires std::constructible_from<T, std::iter_reference_t<I>>
+        auto assign(I const first, S const last) -> void
+        {
+            clear();
+            append(first, last);
+        }
+
+        auto assign(std::initializer_list<T> const init_list) -> void
+        {
+            assign(init_list.begin(), init_list.end());
+        }
+
+        [[nodiscard]] auto get_allocator() const noexcept -> allocator_type
+        {
+            return allocator_type(chunks_.get_allocator());
+        }
+
+        // Iterators
+
+        [[nodiscard]] auto begin() noexcept -> iterator
+        {
+            return iterator{chunks_.data(), 0};
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> const_iterator
+        {
+            return const_iterator{chunks_.data(), 0};
+        }
+
+        [[nodiscard]] auto cbegin() const noexcept -> const_iterator
+        {
+            return begin();
+        }
+
+        [[nodiscard]] auto end() noexcept -> iterator
+        {
+            return iterator{chunks_.data(), size_};
+        }
+
+        [[nodiscard]] auto end() const noexcept -> const_iterator
+        {
+            return const_iterator{chunks_.data(), size_};
+        }
+
+        [[nodiscard]] auto cend() const noexcept -> const_iterator
+        {
+            return end();
+        }
+
+        [[nodiscard]] auto rbegin() noexcept -> reverse_iterator
+        {
+            return reverse_iterator{end()};
+        }
+
+        [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator
+        {
+            return const_reverse_iterator{end()};
+        }
+
+        [[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator
+        {
+            return rbegin();
+        }
+
+        [[nodiscard]] auto rend() noexcept -> reverse_iterator
+        {
+            return reverse_iterator{begin()};
+        }
+
+        [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator
+        {
+            return const_reverse_iterator{begin()};
+        }
+
+        [[nodiscard]] auto crend() const noexcept -> const_reverse_iterator
+        {
+            return rend();
+        }
+
+        /// Calls fn with the elements of each chunk in turn, in order, as a contiguous std::span;
+        /// all the spans but the last one hold chunk_size elements.
+        template <typename Fn>
+        requires invocable_as<Fn, void(std::span<T>)>
+        auto for_each_segment(Fn&& fn) -> void
+        {
+            for (auto first = size_type{0}; first < size_; first += ChunkSize)
+            {
+                std::invoke(fn, std::span<T>{chunks_[first / ChunkSize], std::min(ChunkSize, size_ - first)});
+            }
+        }
+
+        template <typename Fn>
+        requires invocable_as<Fn, void(std::span<T const>)>
+        auto for_each_segment(Fn&& fn) const -> void
+        {
+            for (auto first = size_type{0}; first < size_; first += ChunkSize)
+            {
+                std::invoke(fn, std::span<T const>{chunks_[first / ChunkSize], std::min(ChunkSize, size_ - first)});
+            }
+        }
+
+        // Element access
+
+        [[nodiscard]] auto operator[](size_type const pos) noexcept -> reference
+        {
+            return *slot(pos);
+        }
+
+        [[nodiscard]] auto operator[](size_type const pos) const noexcept -> const_reference
+        {
+            return *slot(pos);
+        }
+
+        [[nodiscard]] auto at(size_type const pos) -> reference
+        {
+            if (pos >= size_)
+            {
+                throw std::out_of_range{"more_concepts::segmented_vector::at: index out of range"};
+            }
+            return *slot(pos);
+        }
+
+        [[nodiscard]] auto at(size_type const pos) const -> const_reference
+        {
+            return const_cast<segmented_vector&>(*this).at(pos);
+        }
+
+        [[nodiscard]] auto front() noexcept -> reference
+        {
+            return *slot(0);
+        }
+
+        [[nodiscard]] auto front() const noexcept -> const_reference
+        {
+            return *slot(0);
+        }
+
+        [[nodiscard]] auto back() noexcept -> reference
+        {
+            return *slot(size_ - 1);
+        }
+
+        [[nodiscard]] auto back() const noexcept -> const_reference
+        {
+            return *slot(size_ - 1);
+        }
+
+        // Capacity
+
+        [[nodiscard]] auto empty() const noexcept -> bool
+        {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] auto size() const noexcept -> size_type
+        {
+            return size_;
+        }
+
+        [[nodiscard]] auto max_size() const noexcept -> size_type
+        {
+            return std::min<size_type>(
+                alloc_traits::max_size(get_allocator()) / ChunkSize * ChunkSize,
+                static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(T));
+        }
+
+        /// The number of elements the allocated chunks can hold, always a multiple of chunk_size.
+        [[nodiscard]] auto capacity() const noexcept -> size_type
+        {
+            return chunks_.size() * ChunkSize;
+        }
+
+        /// Allocates chunks until there is room for new_capacity elements.
+        auto reserve(size_type const new_capacity) -> void
+        {
+            if (new_capacity > capacity())
+            {
+                check_capacity(new_capacity);
+                auto const chunk_count = (new_capacity - 1) / ChunkSize + 1;
+                chunks_.reserve(chunk_count);
+                while (chunks_.size() < chunk_count)
+                {
+                    // Cannot throw: the table has room.
+                    chunks_.push_back(allocate_chunk());
+                }
+            }
+        }
+
+        /// Deallocates the chunks that hold no elements.
+        auto shrink_to_fit() -> void
+        {
+            auto const chunk_count = (size_ + ChunkSize - 1) / ChunkSize;
+            while (chunks_.size() > chunk_count)
+            {
+                deallocate_chunk(chunks_.back());
+                chunks_.pop_back();
+            }
+            chunks_.shrink_to_fit();
+        }
+
+        // Modifiers
+
+        /// Destroys the elements, keeping the chunks allocated.
+        auto clear() noexcept -> void
+        {
+            destroy_from(0);
+        }
+
+        auto push_back(T const& value) -> void
+        {
+            emplace_back(value);
+        }
+
+        auto push_back(T&& value) -> void
+        {
+            emplace_back(std::move(value));
+        }
+
+        /// The elements never move, so the arguments may refer to them.
+        template <typename... Args>
+        auto emplace_back(Args&& ... args) -> reference
+        {
+            if (size_ == capacity())
+            {
+                add_chunk();
+            }
+            auto* const element = std::construct_at(slot(size_), std::forward<Args>(args)...);
+            ++size_;
+            return *element;
+        }
+
+        auto pop_back() noexcept -> void
+        {
+            std::destroy_at(slot(size_ - 1));
+            --size_;
+        }
+
+        auto resize(size_type const count) -> void
+        {
+            resize_with(count, [](T* const element) {
+                std::construct_at(element);
+            });
+        }
+
+        auto resize(size_type const count, T const& value) -> void
+        {
+            resize_with(count, [&](T* const element) {
+                std::construct_at(element, value);
+            });
+        }
+
+        auto swap(segmented_vector& other) noexcept -> void
+        {
+            // Swaps the allocators along with the tables of chunks if they propagate.
+            chunks_.swap(other.chunks_);
+            std::swap(size_, other.size_);
+        }
+
+        friend auto swap(segmented_vector& lhs, segmented_vector& rhs) noexcept -> void
+        {
+            lhs.swap(rhs);
+        }
+
+        // Comparison
+
+        friend auto operator==(segmented_vector const& lhs, segmented_vector const& rhs) -> bool
+        requires std::equality_comparable<T>
+        {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        friend auto operator<=>(segmented_vector const& lhs, segmented_vector const& rhs)
+        requires requires(T const& value) { detail::synth_three_way(value, value); }
+        {
+            return std::lexicographical_compare_three_way(
+                lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), detail::synth_three_way);
+        }
+
+    private:
+        /// The allocated chunks, each of ChunkSize elements; the elements are in the first size_ slots.
+        /// Holds the allocator.
+        chunk_table chunks_;
+        size_type size_ = 0;
+
+        template <bool Const>
+        class iterator_impl
+        {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<Const, T const&, T&>;
+            using pointer = std::conditional_t<Const, T const*, T*>;
+
+            iterator_impl() = default;
+
+            template <bool OtherConst>
+            requires (Const and not OtherConst)
+            iterator_impl(iterator_impl<OtherConst> const& other) noexcept
+                : chunks_{other.chunks_}
+                , index_{other.index_}
+            {
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> reference
+            {
+                return chunks_[index_ / ChunkSize][index_ % ChunkSize];
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> pointer
+            {
+                return chunks_[index_ / ChunkSize] + index_ % ChunkSize;
+            }
+
+            [[nodiscard]] auto operator[](difference_type const offset) const noexcept -> reference
+            {
+                return *(*this + offset);
+            }
+
+            auto operator++() noexcept -> iterator_impl&
+            {
+                ++index_;
+                return *this;
+            }
+
+            auto operator++(int) noexcept -> iterator_impl
+            {
+                auto copy = *this;
+                ++index_;
+                return copy;
+            }
+
+            auto operator--() noexcept -> iterator_impl&
+            {
+                --index_;
+                return *this;
+            }
+
+            auto operator--(int) noexcept -> iterator_impl
+            {
+                auto copy = *this;
+                --index_;
+                return copy;
+            }
+
+            auto operator+=(difference_type const offset) noexcept -> iterator_impl&
+            {
+                index_ += static_cast<size_type>(offset);
+                return *this;
+            }
+
+            auto operator-=(difference_type const offset) noexcept -> iterator_impl&
+            {
+                index_ -= static_cast<size_type>(offset);
+                return *this;
+            }
+
+            [[nodiscard]] friend auto operator+(iterator_impl it, difference_type const offset) noexcept
+            -> iterator_impl
+            {
+                return it += offset;
+            }
+
+            [[nodiscard]] friend auto operator+(difference_type const offset, iterator_impl it) noexcept
+            -> iterator_impl
+            {
+                return it += offset;
+            }
+
+            [[nodiscard]] friend auto operator-(iterator_impl it, difference_type const offset) noexcept
+            -> iterator_impl
+            {
+                return it -= offset;
+            }
+
+            [[nodiscard]] friend auto operator-(iterator_impl const& lhs, iterator_impl const& rhs) noexcept
+            -> difference_type
+            {
+                return static_cast<difference_type>(lhs.index_ - rhs.index_);
+            }
+
+            [[nodiscard]] friend auto operator==(iterator_impl const& lhs, iterator_impl const& rhs) noexcept
+            -> bool
+            {
+                return lhs.index_ == rhs.index_;
+            }
+
+            [[nodiscard]] friend auto operator<=>(iterator_impl const& lhs, iterator_impl const& rhs) noexcept
+            -> std::strong_ordering
+            {
+                return lhs - rhs <=> 0;
+            }
+
+        private:
+            friend class segmented_vector;
+            friend class iterator_impl<not Const>;
+
+            T* const* chunks_ = nullptr;
+            /// The index of the element within the vector.
+            size_type index_ = 0;
+
+            iterator_impl(T* const* const chunks, size_type const index) noexcept
+                : chunks_{chunks}
+                , index_{index}
+            {
+            }
+        };
+
+        /// The slot of the element at index (which may be one past the last element, if there is room).
+        [[nodiscard]] auto slot(size_type const index) const noexcept -> T*
+        {
+            return chunks_[index / ChunkSize] + index % ChunkSize;
+        }
+
+        auto check_capacity(size_type const required) const -> void
+        {
+            if (required > max_size())
+            {
+                throw std::length_error{"more_concepts::segmented_vector: maximum size exceeded"};
+            }
+        }
+
+        [[nodiscard]] auto allocate_chunk() -> T*
+        {
+            auto alloc = get_allocator();
+            return alloc_traits::allocate(alloc, ChunkSize);
+        }
+
+        auto deallocate_chunk(T* const chunk) noexcept -> void
+        {
+            auto alloc = get_allocator();
+            alloc_traits::deallocate(alloc, chunk, ChunkSize);
+        }
+
+        /// Allocates one more chunk. If this throws, nothing is changed.
+        auto add_chunk() -> void
+        {
+            check_capacity(capacity() + ChunkSize);
+            auto* const chunk = allocate_chunk();
+            try
+            {
+                chunks_.push_back(chunk);
+            }
+            catch (...)
+            {
+                deallocate_chunk(chunk);
+                throw;
+            }
+        }
+
+        /// Appends the elements of [first, last). If this throws, the appended elements are destroyed.
+        template <typename I, typename S>
+        auto append(I first, S const last) -> void
+        {
+            auto const old_size = size_;
+            try
+            {
+                for (; first != last; ++first)
+                {
+                    emplace_back(*first);
+                }
+            }
+            catch (...)
+            {
+                destroy_from(old_size);
+                throw;
+            }
+        }
+
+        template <typename F>
+        auto resize_with(size_type const count, F construct) -> void
+        {
+            if (count <= size_)
+            {
+                destroy_from(count);
+                return;
+            }
+
+            reserve(count);
+            auto const old_size = size_;
+            try
+            {
+                for (; size_ < count; ++size_)
+                {
+                    construct(slot(size_));
+                }
+            }
+            catch (...)
+            {
+                destroy_from(old_size);
+                throw;
+            }
+        }
+
+        /// Destroys the elements from index first on.
+        auto destroy_from(size_type const first) noexcept -> void
+        {
+            if constexpr (not std::is_trivially_destructible_v<T>)
+            {
+                for (auto index = first; index < size_;)
+                {
+                    auto const count = std::min(ChunkSize - index % ChunkSize, size_ - index);
+                    std::destroy_n(slot(index), count);
+                    index += count;
+                }
+            }
+            size_ = first;
+        }
+
+        auto destroy_and_deallocate() noexcept -> void
+        {
+            clear();
+            for (auto* const chunk : chunks_)
+            {
+                deallocate_chunk(chunk);
+            }
+            // Frees the table itself (shrink_to_fit may allocate).
+            auto empty = chunk_table(chunks_.get_allocator());
+            chunks_.swap(empty);
+        }
+    };
+}
@@ -0,0 +1,411 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/base_containers.hpp"
+#include "more_concepts/sequence_containers.hpp"
+
+#if not defined(MORE_CONCEPTS_DISABLE_SIMD) and \
+    (defined(__GNUC__) or defined(__clang__)) and \
+    (defined(__x86_64__) or defined(__i386__)) and \
+    defined(__SSE2__)
+#define MORE_CONCEPTS_DETAIL_SIMD_X86 1
+#include <emmintrin.h>
+#endif
+
+namespace more_concepts
+{
+    namespace detail
+    {
+        /// Value types that the vectorized kernels support.
+        template <typename T>
+        concept simd_value
+        = (std::integral<T> or std::floating_point<T>) and
+          not std::same_as<T, bool> and
+          sizeof(T) <= 8;
+
+        /// Containers whose elements can be scanned by the vectorized kernels.
+        template <typename C>
+        concept simd_scannable_container
+        = contiguous_container_of<C, typename C::value_type> and
+          simd_value<typename C::value_type>;
+
+#ifdef MORE_CONCEPTS_DETAIL_SIMD_X86
+        namespace simd
+        {
+            template <typename T, std::size_t Bytes>
+            using vector [[gnu::vector_size(Bytes)]] = T;
+
+            /// The kernels are written once over the vector width, and inlined into a baseline
+            /// (SSE2) and an AVX2 entry point, which are selected at runtime. They only use
+            /// generic vector operations and SSE2 intrinsics, so that they can be inlined
+            /// into functions compiled for either target. Vectors are never passed or returned
+            /// by value, as the calling convention for 32 byte vectors differs between the targets.
+            template <typename V, typename T>
+            [[gnu::always_inline]] inline auto load(V& dest, T const* const src) -> void
+            {
+                std::memcpy(&dest, src, sizeof(V));
+            }
+
+            /// One bit per byte of the mask, like _mm_movemask_epi8.
+            template <typename Mask>
+            [[gnu::always_inline]] inline auto movemask(Mask const& mask) -> std::uint32_t
+            {
+                auto result = std::uint32_t{0};
+                for (auto offset = std::size_t{0}; offset < sizeof(Mask); offset += 16)
+                {
+                    auto half = __m128i{};
+                    std::memcpy(&half, reinterpret_cast<char const*>(&mask) + offset, 16);
+                    result |= static_cast<std::uint32_t>(_mm_movemask_epi8(half)) << offset;
+                }
+                return result;
+            }
+
+            template <std::size_t Bytes, typename T>
+            [[gnu::always_inline]] inline auto find_kernel(T const* first, T const* const last, T const value)
+            -> T const*
+            {
+                constexpr auto lanes = static_cast<std::ptrdiff_t>(Bytes / sizeof(T));
+                auto const needle = value - vector<T, Bytes>{};
+
+                auto block = vector<T, Bytes>{};
+
+                for (; last - first >= lanes; first += lanes)
+                {
+                    load(block, first);
+                    auto const bits = movemask(block == needle);
+                    if (bits != 0)
+                    {
+                        return first + static_cast<std::size_t>(std::countr_zero(bits)) / sizeof(T);
+                    }
+                }
+
+                return std::find(first, last, value);
+            }
+
+            template <std::size_t Bytes, typename T>
+            [[gnu::always_inline]] inline auto count_kernel(T const* first, T const* const last, T const value)
+            -> std::size_t
+            {
+                constexpr auto lanes = static_cast<std::ptrdiff_t>(Bytes / sizeof(T));
+                auto const needle = value - vector<T, Bytes>{};
+                auto block = vector<T, Bytes>{};
+                auto result = std::size_t{0};
+
+                for (; last - first >= lanes; first += lanes)
+                {
+                    load(block, first);
+                    result += static_cast<std::size_t>(std::popcount(movemask(block == needle)));
+                }
+
+                return result / sizeof(T) + static_cast<std::size_t>(std::count(first, last, value));
+            }
+
+            /// Replaces current by candidate (lane-wise for vectors) if candidate is
+            /// strictly smaller (or larger if Max), the same way std::min_element (std::max_element) does.
+            template <bool Max, typename V>
+            [[gnu::always_inline]] inline auto select_extremum(V& current, V const& candidate) -> void
+            {
+                if constexpr (Max)
+                {
+                    current = current < candidate ? candidate : current;
+                }
+                else
+                {
+                    current = candidate < current ? candidate : current;
+                }
+            }
+
+            /// Returns the value of the element that std::min_element (or std::max_element)
+            /// would find in the non-empty range [first, last). The lanes are seeded with
+            /// the first element, so that unordered values (NaN) are treated the same way:
+            /// they are never selected, unless the first element is one.
+            template <std::size_t Bytes, bool Max, typename T>
+            [[gnu::always_inline]] inline auto extremum_kernel(T const* first, T const* const last) -> T
+            {
+                constexpr auto lanes = static_cast<std::ptrdiff_t>(Bytes / sizeof(T));
+
+                auto result = *first;
+                if (last - first >= lanes)
+                {
+                    auto acc = result - vector<T, Bytes>{};
+                    auto block = vector<T, Bytes>{};
+                    for (; last - first >= lanes; first += lanes)
+                    {
+                        load(block, first);
+                        select_extremum<Max>(acc, block);
+                    }
+                    for (auto lane = std::ptrdiff_t{0}; lane < lanes; ++lane)
+                    {
+                        select_extremum<Max>(result, static_cast<T>(acc[lane]));
+                    }
+                }
+                for (; first != last; ++first)
+                {
+                    select_extremum<Max>(result, *first);
+                }
+
+                return result;
+            }
+
+            /// Sums the range in the corresponding unsigned type, where the addition is associative.
+            template <std::size_t Bytes, std::integral T>
+            [[gnu::always_inline]] inline auto sum_kernel(T const* first, T const* const last, T const init) -> T
+            {
+                using unsigned_type = std::make_unsigned_t<T>;
+                constexpr auto lanes = static_cast<std::ptrdiff_t>(Bytes / sizeof(T));
+
+                auto acc = vector<unsigned_type, Bytes>{};
+                auto block = vector<unsigned_type, Bytes>{};
+                for (; last - first >= lanes; first += lanes)
+                {
+                    load(block, first);
+                    acc += block;
+                }
+
+                auto result = static_cast<unsigned_type>(init);
+                for (auto lane = std::ptrdiff_t{0}; lane < lanes; ++lane)
+                {
+                    result += acc[lane];
+                }
+                for (; first != last; ++first)
+                {
+                    result += static_cast<unsigned_type>(*first);
+                }
+
+                return static_cast<T>(result);
+            }
+
+            template <typename T>
+            [[gnu::target("avx2")]] auto find_avx2(T const* const first, T const* const last, T const value)
+            -> T const*
+            {
+                return find_kernel<32>(first, last, value);
+            }
+
+            template <typename T>
+            [[gnu::target("avx2")]] auto count_avx2(T const* const first, T const* const last, T const value)
+            -> std::size_t
+            {
+                return count_kernel<32>(first, last, value);
+            }
+
+            template <bool Max, typename T>
+            [[gnu::target("avx2")]] auto extremum_avx2(T const* const first, T const* const last) -> T
+            {
+                return extremum_kernel<32, Max>(first, last);
+            }
+
+            template <typename T>
+            [[gnu::target("avx2")]] auto sum_avx2(T const* const first, T const* const last, T const init) -> T
+            {
+                return sum_kernel<32>(first, last, init);
+            }
+
+            inline auto has_avx2() -> bool
+            {
+                // __builtin_cpu_init is needed if this runs before the static constructors of libgcc.
+                static auto const result = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+                return result;
+            }
+
+            template <typename T>
+            auto find(T const* const first, T const* const last, T const value) -> T const*
+            {
+                return has_avx2() ? find_avx2(first, last, value) : find_kernel<16>(first, last, value);
+            }
+
+            template <typename T>
+            auto count(T const* const first, T const* const last, T const value) -> std::size_t
+            {
+                return has_avx2() ? count_avx2(first, last, value) : count_kernel<16>(first, last, value);
+            }
+
+            template <bool Max, typename T>
+            auto extremum(T const* const first, T const* const last) -> T
+            {
+                return has_avx2() ? extremum_avx2<Max>(first, last) : extremum_kernel<16, Max>(first, last);
+            }
+
+            template <typename T>
+            auto sum(T const* const first, T const* const last, T const init) -> T
+            {
+                return has_avx2() ? sum_avx2(first, last, init) : sum_kernel<16>(first, last, init);
+            }
+        }
+
+        inline constexpr auto simd_enabled = true;
+#else
+        inline constexpr auto simd_enabled = false;
+#endif
+
+        template <typename C>
+        constexpr auto simd_find(C& cont, typename C::value_type const& value)
+        -> decltype(cont.begin())
+        {
+            using container_type = std::remove_const_t<C>;
+            if constexpr (simd_enabled and simd_scannable_container<container_type>)
+            {
+                if (not std::is_constant_evaluated())
+                {
+#ifdef MORE_CONCEPTS_DETAIL_SIMD_X86
+                    auto const* const first = std::as_const(cont).data();
+                    auto const* const found = simd::find(first, first + cont.size(), value);
+                    return cont.begin() + (found - first);
+#endif
+                }
+            }
+
+            return std::find(cont.begin(), cont.end(), value);
+        }
+
+        template <bool Max, typename C>
+        constexpr auto simd_extremum_element(C& cont) -> decltype(cont.begin())
+        {
+            using container_type = std::remove_const_t<C>;
+            if constexpr (simd_enabled and simd_scannable_container<container_type>)
+            {
+                if (not std::is_constant_evaluated())
+                {
+#ifdef MORE_CONCEPTS_DETAIL_SIMD_X86
+                    if (cont.empty())
+                    {
+                        return cont.end();
+                    }
+
+                    auto const* const first = std::as_const(cont).data();
+                    auto const* const last = first + cont.size();
+                    auto const value = simd::extremum<Max>(first, last);
+                    // A NaN is only selected if it is the first element, and compares unequal to itself.
+                    auto const* const found = value == value ? simd::find(first, last, value) : first;
+                    return cont.begin() + (found - first);
+#endif
+                }
+            }
+
+            if constexpr (Max)
+            {
+                return std::max_element(cont.begin(), cont.end());
+            }
+            else
+            {
+                return std::min_element(cont.begin(), cont.end());
+            }
+        }
+    }
+
+    /// Returns an iterator to the first element of cont equal to value, or cont.end().
+    ///
+    /// Contiguous containers of arithmetic types are scanned with SSE2 or AVX2 (selected at runtime)
+    /// on x86 with GCC or Clang. Other containers fall back to std::find.
+    template <container C>
+    requires std::equality_comparable<typename C::value_type>
+    constexpr auto find(C& cont, typename C::value_type const& value) -> typename C::iterator
+    {
+        return detail::simd_find(cont, value);
+    }
+
+    template <container C>
+    requires std::equality_comparable<typename C::value_type>
+    constexpr auto find(C const& cont, typename C::value_type const& value) -> typename C::const_iterator
+    {
+        return detail::simd_find(cont, value);
+    }
+
+    /// Checks whether cont contains an element equal to value, see find.
+    template <container C>
+    requires std::equality_comparable<typename C::value_type>
+    constexpr auto contains(C const& cont, typename C::value_type const& value) -> bool
+    {
+        return detail::simd_find(cont, value) != cont.end();
+    }
+
+    /// Returns the number of elements of cont equal to value, see find.
+    template <container C>
+    requires std::equality_comparable<typename C::value_type>
+    constexpr auto count(C const& cont, typename C::value_type const& value) -> typename C::size_type
+    {
+        if constexpr (detail::simd_enabled and detail::simd_scannable_container<C>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+#ifdef MORE_CONCEPTS_DETAIL_SIMD_X86
+                auto const* const first = cont.data();
+                return static_cast<typename C::size_type>(
+                    detail::simd::count(first, first + cont.size(), value));
+#endif
+            }
+        }
+
+        return static_cast<typename C::size_type>(std::count(cont.begin(), cont.end(), value));
+    }
+
+    /// Returns an iterator to the first smallest element of cont, or cont.end() if cont is empty.
+    /// The result is the same as std::min_element, including for floating point containers
+    /// with NaN values.
+    ///
+    /// Contiguous containers of arithmetic types are reduced with SSE2 or AVX2, see find.
+    template <container C>
+    requires std::totally_ordered<typename C::value_type>
+    constexpr auto min_element(C& cont) -> typename C::iterator
+    {
+        return detail::simd_extremum_element<false>(cont);
+    }
+
+    template <container C>
+    requires std::totally_ordered<typename C::value_type>
+    constexpr auto min_element(C const& cont) -> typename C::const_iterator
+    {
+        return detail::simd_extremum_element<false>(cont);
+    }
+
+    /// Returns an iterator to the first largest element of cont, or cont.end() if cont is empty,
+    /// see min_element.
+    template <container C>
+    requires std::totally_ordered<typename C::value_type>
+    constexpr auto max_element(C& cont) -> typename C::iterator
+    {
+        return detail::simd_extremum_element<true>(cont);
+    }
+
+    template <container C>
+    requires std::totally_ordered<typename C::value_type>
+    constexpr auto max_element(C const& cont) -> typename C::const_iterator
+    {
+        return detail::simd_extremum_element<true>(cont);
+    }
+
+    /// Returns the sum of init and all elements of cont, like std::accumulate.
+    ///
+    /// Contiguous containers of integral types are summed with SSE2 or AVX2 if T is the value type,
+    /// see find. Floating point containers are always summed in order, as reassociating
+    /// the additions would change the result.
+    template <container C, std::movable T>
+    requires requires(T acc, typename C::const_reference value) { acc = std::move(acc) + value; }
+    constexpr auto accumulate(C const& cont, T init) -> T
+    {
+        if constexpr (detail::simd_enabled and
+                      detail::simd_scannable_container<C> and
+                      std::integral<typename C::value_type> and
+                      std::same_as<T, typename C::value_type>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+#ifdef MORE_CONCEPTS_DETAIL_SIMD_X86
+                auto const* const first = cont.data();
+                return detail::simd::sum(first, first + cont.size(), init);
+#endif
+            }
+        }
+
+        return std::accumulate(cont.begin(), cont.end(), std::move(init));
+    }
+}
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/detail/vector_base.hpp"
+#include "more_concepts/relocation.hpp"
+
+namespace more_concepts
+{
+    /// A vector that stores up to N elements inline (inside the object itself), and only allocates
+    /// memory from Allocator once it grows beyond that. Models contiguous_container
+    /// and inplace_back_constructing_container.
+    ///
+    /// Use it for short sequences whose size is usually bounded, to avoid an allocation per sequence.
+    /// Unlike vector, moving (and swapping) a small_vector whose elements are stored inline moves
+    /// the elements, and invalidates iterators. Moved-from small_vectors are empty.
+    template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+    class small_vector : public detail::vector_base<small_vector<T, N, Allocator>, T>
+    {
+        using base = detail::vector_base<small_vector<T, N, Allocator>, T>;
+        using alloc_traits = std::allocator_traits<Allocator>;
+
+        friend base;
+
+        static_assert(
+            std::same_as<typename alloc_traits::value_type, T>,
+            "Allocator::value_type must be the same as T");
+
+    public:
+        using typename base::value_type;
+        using typename base::size_type;
+        using typename base::difference_type;
+        using typename base::reference;
+        using typename base::const_reference;
+        using typename base::pointer;
+        using typename base::const_pointer;
+        using typename base::iterator;
+        using typename base::const_iterator;
+        using typename base::reverse_iterator;
+        using typename base::const_reverse_iterator;
+        using allocator_type = Allocator;
+
+        /// The number of elements that can be stored without allocating.
+        static constexpr auto inline_capacity = N;
+
+        // Construction
+
+        small_vector() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+        explicit small_vector(Allocator const& alloc) noexcept
+            : alloc_{alloc}
+        {
+        }
+
+        explicit small_vector(size_type const count, Allocator const& alloc = Allocator())
+            : small_vector(alloc)
+        {
+            this->resize(count);
+        }
+
+        small_vector(size_type const count, T const& value, Allocator const& alloc = Allocator())
+            : small_vector(alloc)
+        {
+            this->assign(count, value);
+        }
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        requires std::constructible_from<T, std::iter_reference_t<I>>
+        small_vector(I const first, S const last, Allocator const& alloc = Allocator())
+            : small_vector(alloc)
+        {
+            this->assign(first, last);
+        }
+
+        small_vector(std::initializer_list<T> const init_list, Allocator const& alloc = Allocator())
+            : small_vector(init_list.begin(), init_list.end(), alloc)
+        {
+        }
+
+        small_vector(small_vector const& other)
+            : small_vector(other, alloc_traits::select_on_container_copy_construction(other.alloc_))
+        {
+        }
+
+        small_vector(small_vector const& other, Allocator const& alloc)
+            : small_vector(other.begin(), other.end(), alloc)
+        {
+        }
+
+        small_vector(small_vector&& other) noexcept(detail::nothrow_relocatable<T>)
+            : small_vector(other.alloc_)
+        {
+            take_elements_from(other);
+        }
+
+        small_vector(small_vector&& other, Allocator const& alloc)
+            : small_vector(alloc)
+        {
+            take_elements_from(other);
+        }
+
+        auto operator=(small_vector const& other) -> small_vector&
+        {
+            if (this != &other)
+            {
+                if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+                {
+                    if (alloc_ != other.alloc_)
+                    {
+                        this->clear();
+                        release_heap_buffer();
+                    }
+                    alloc_ = other.alloc_;
+                }
+                this->assign(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        auto operator=(small_vector&& other)
+        noexcept(detail::nothrow_relocatable<T> and
+                 (alloc_traits::propagate_on_container_move_assignment::value or
+                  alloc_traits::is_always_equal::value)) -> small_vector&
+        {
+            if (this != &other)
+            {
+                this->clear();
+                if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+                {
+                    release_heap_buffer();
+                    alloc_ = other.alloc_;
+                }
+                take_elements_from(other);
+            }
+            return *this;
+        }
+
+        auto operator=(std::initializer_list<T> const init_list) -> small_vector&
+        {
+            this->assign(init_list);
+            return *this;
+        }
+
+        ~small_vector()
+        {
+            this->clear();
+            release_heap_buffer();
+        }
+
+        [[nodiscard]] auto get_allocator() const noexcept -> allocator_type
+        {
+            return alloc_;
+        }
+
+        // Element access
+
+        [[nodiscard]] auto data() noexcept -> T*
+        {
+            return data_;
+        }
+
+        [[nodiscard]] auto data() const noexcept -> T const*
+        {
+            return data_;
+        }
+
+        // Capacity
+
+        [[nodiscard]] auto size() const noexcept -> size_type
+        {
+            return size_;
+        }
+
+        [[nodiscard]] auto capacity() const noexcept -> size_type
+        {
+            return capacity_;
+        }
+
+        [[nodiscard]] auto max_size() const noexcept -> size_type
+        {
+            return std::min<size_type>(
+                alloc_traits::max_size(alloc_),
+                static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(T));
+        }
+
+        /// Whether the elements are stored inline.
+        [[nodiscard]] auto is_inline() const noexcept -> bool
+        {
+            return data_ == inline_storage_.data();
+        }
+
+        /// Reduces the capacity to the size, moving the elements back inline if they fit.
+        auto shrink_to_fit() -> void
+        {
+            if (is_inline() or size_ == capacity_)
+            {
+                return;
+            }
+
+            if (size_ <= N)
+            {
+                this->transfer_elements(inline_storage_.data(), size_, 0);
+                release_heap_buffer();
+            }
+            else
+            {
+                this->reallocate_with_gap(size_, size_, 0, [](T*) {});
+            }
+        }
+
+        // Modifiers
+
+        auto swap(small_vector& other)
+        noexcept(detail::nothrow_relocatable<T> and
+                 (alloc_traits::propagate_on_container_swap::value or alloc_traits::is_always_equal::value)) -> void
+        {
+            constexpr auto propagate = alloc_traits::propagate_on_container_swap::value;
+            if (not is_inline() and not other.is_inline() and (propagate or alloc_ == other.alloc_))
+            {
+                using std::swap;
+                swap(data_, other.data_);
+                swap(size_, other.size_);
+                swap(capacity_, other.capacity_);
+                if constexpr (propagate)
+                {
+                    swap(alloc_, other.alloc_);
+                }
+                return;
+            }
+
+            // If the allocators propagate, each vector gets the allocator before taking the elements
+            // (and heap buffer) allocated with it, so nothing is allocated.
+            auto tmp = small_vector(std::move(other), other.alloc_);
+            if constexpr (propagate)
+            {
+                other.alloc_ = alloc_;
+            }
+            other.take_elements_from(*this);
+            if constexpr (propagate)
+            {
+                alloc_ = tmp.alloc_;
+            }
+            take_elements_from(tmp);
+        }
+
+        friend auto swap(small_vector& lhs, small_vector& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void
+        {
+            lhs.swap(rhs);
+        }
+
+    private:
+        [[no_unique_address]] detail::inline_storage<T, N> inline_storage_;
+        T* data_ = inline_storage_.data();
+        size_type size_ = 0;
+        size_type capacity_ = N;
+        [[no_unique_address]] Allocator alloc_ = Allocator();
+
+        auto set_size(size_type const size) noexcept -> void
+        {
+            size_ = size;
+        }
+
+        auto allocate_buffer(size_type const capacity) -> T*
+        {
+            return alloc_traits::allocate(alloc_, capacity);
+        }
+
+        auto deallocate_buffer(T* const buffer, size_type const capacity) noexcept -> void
+        {
+            alloc_traits::deallocate(alloc_, buffer, capacity);
+        }
+
+        auto adopt_buffer(T* const buffer, size_type const capacity) noexcept -> void
+        {
+            release_heap_buffer();
+            data_ = buffer;
+            capacity_ = capacity;
+        }
+
+        [[noreturn]] static auto throw_capacity_exceeded() -> void
+        {
+            throw std::length_error{"more_concepts::small_vector: maximum size exceeded"};
+        }
+
+        /// Deallocates the heap buffer, if any, and switches to the inline storage.
+        /// The elements must have been destroyed or relocated.
+        auto release_heap_buffer() noexcept -> void
+        {
+            if (not is_inline())
+            {
+                deallocate_buffer(data_, capacity_);
+                data_ = inline_storage_.data();
+                capacity_ = N;
+            }
+        }
+
+        /// Takes the elements of other, which is left empty. This must be empty, and have no heap buffer
+        /// if other's heap buffer can be taken (if other's allocator is propagated or equal).
+        auto take_elements_from(small_vector& other) -> void
+        {
+            if (not other.is_inline() and alloc_ == other.alloc_)
+            {
+                release_heap_buffer();
+                data_ = std::exchange(other.data_, other.inline_storage_.data());
+                size_ = std::exchange(other.size_, 0);
+                capacity_ = std::exchange(other.capacity_, N);
+                return;
+            }
+
+            this->reserve(other.size_);
+            if constexpr (detail::nothrow_relocatable<T>)
+            {
+                uninitialized_relocate(other.data_, other.data_ + other.size_, data_);
+                size_ = std::exchange(other.size_, 0);
+            }
+            else
+            {
+                std::uninitialized_move(other.data_, other.data_ + other.size_, data_);
+                size_ = other.size_;
+                other.clear();
+            }
+        }
+    };
+}
@@ -0,0 +1,522 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/base_concepts.hpp"
+#include "more_concepts/columnar_containers.hpp"
+#include "more_concepts/relocation.hpp"
+
+namespace more_concepts
+{
+    /// A growable sequence of records with the fields Ts..., stored as a structure of arrays:
+    /// each field is stored in its own contiguous array (column), and column<I>() returns it
+    /// as a std::span. Loops that only touch some of the fields read only their columns,
+    /// instead of every field of every record. Models columnar_container.
+    ///
+    /// A row is read and written as a tuple of references (reference is std::tuple<Ts&...>),
+    /// so soa_vector is not a container (its reference type is not value_type&).
+    /// All columns share one size and capacity, and grow together; growing invalidates the spans.
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0) and (decayed<Ts> and ...) and (std::destructible<Ts> and ...)
+    class soa_vector
+    {
+    public:
+        using value_type = std::tuple<Ts...>;
+        using reference = std::tuple<Ts&...>;
+        using const_reference = std::tuple<Ts const&...>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        template <std::size_t I>
+        using column_value_type = std::tuple_element_t<I, value_type>;
+
+        static constexpr std::size_t column_count = sizeof...(Ts);
+
+        soa_vector() = default;
+
+        explicit soa_vector(size_type const count)
+        requires (std::default_initializable<Ts> and ...)
+        {
+            resize(count);
+        }
+
+        soa_vector(soa_vector const& other)
+        requires (std::copy_constructible<Ts> and ...)
+        {
+            if (other.size_ != 0)
+            {
+                auto new_columns = allocate_columns(other.size_);
+                copy_columns(other.columns_, new_columns, other.size_, other.size_);
+                columns_ = new_columns;
+                size_ = other.size_;
+                capacity_ = other.size_;
+            }
+        }
+
+        soa_vector(soa_vector&& other) noexcept
+            : columns_{std::exchange(other.columns_, {})}
+            , size_{std::exchange(other.size_, 0)}
+            , capacity_{std::exchange(other.capacity_, 0)}
+        {
+        }
+
+        auto operator=(soa_vector const& other) -> soa_vector&
+        requires (std::copy_constructible<Ts> and ...)
+        {
+            if (this != &other)
+            {
+                auto copy = other;
+                swap(copy);
+            }
+            return *this;
+        }
+
+        auto operator=(soa_vector&& other) noexcept -> soa_vector&
+        {
+            if (this != &other)
+            {
+                destroy_and_deallocate();
+                columns_ = std::exchange(other.columns_, {});
+                size_ = std::exchange(other.size_, 0);
+                capacity_ = std::exchange(other.capacity_, 0);
+            }
+            return *this;
+        }
+
+        ~soa_vector()
+        {
+            destroy_and_deallocate();
+        }
+
+        // Columns
+
+        /// The I-th field of all records.
+        template <std::size_t I>
+        requires (I < column_count)
+        [[nodiscard]] auto column() noexcept -> std::span<column_value_type<I>>
+        {
+            return {std::get<I>(columns_), size_};
+        }
+
+        template <std::size_t I>
+        requires (I < column_count)
+        [[nodiscard]] auto column() const noexcept -> std::span<column_value_type<I> const>
+        {
+            return {std::get<I>(columns_), size_};
+        }
+
+        /// The field of type T of all records (if there is exactly one such field).
+        template <typename T>
+        requires ((std::same_as<T, Ts> + ...) == 1)
+        [[nodiscard]] auto column() noexcept -> std::span<T>
+        {
+            return {std::get<T*>(columns_), size_};
+        }
+
+        template <typename T>
+        requires ((std::same_as<T, Ts> + ...) == 1)
+        [[nodiscard]] auto column() const noexcept -> std::span<T const>
+        {
+            return {std::get<T*>(columns_), size_};
+        }
+
+        // Element access
+
+        [[nodiscard]] auto operator[](size_type const index) noexcept -> reference
+        {
+            return std::apply([&](Ts* const... columns) { return reference{columns[index]...}; }, columns_);
+        }
+
+        [[nodiscard]] auto operator[](size_type const index) const noexcept -> const_reference
+        {
+            return std::apply([&](Ts* const... columns) { return const_reference{columns[index]...}; }, columns_);
+        }
+
+        [[nodiscard]] auto at(size_type const index) -> reference
+        {
+            check_index(index);
+            return (*this)[index];
+        }
+
+        [[nodiscard]] auto at(size_type const index) const -> const_reference
+        {
+            check_index(index);
+            return (*this)[index];
+        }
+
+        [[nodiscard]] auto front() noexcept -> reference { return (*this)[0]; }
+
+        [[nodiscard]] auto front() const noexcept -> const_reference { return (*this)[0]; }
+
+        [[nodiscard]] auto back() noexcept -> reference { return (*this)[size_ - 1]; }
+
+        [[nodiscard]] auto back() const noexcept -> const_reference { return (*this)[size_ - 1]; }
+
+        // Capacity
+
+        [[nodiscard]] auto size() const noexcept -> size_type
+        {
+            return size_;
+        }
+
+        [[nodiscard]] auto empty() const noexcept -> bool
+        {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] auto capacity() const noexcept -> size_type
+        {
+            return capacity_;
+        }
+
+        [[nodiscard]] auto max_size() const noexcept -> size_type
+        {
+            return std::numeric_limits<difference_type>::max() / (sizeof(Ts) + ...);
+        }
+
+        auto reserve(size_type const new_capacity) -> void
+        {
+            if (new_capacity > capacity_)
+            {
+                reallocate(checked_capacity(new_capacity));
+            }
+        }
+
+        auto shrink_to_fit() -> void
+        {
+            if (size_ == 0)
+            {
+                destroy_and_deallocate();
+            }
+            else if (size_ < capacity_)
+            {
+                reallocate(size_);
+            }
+        }
+
+        // Modifiers
+
+        auto clear() noexcept -> void
+        {
+            for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                std::destroy_n(std::get<I>(columns_), size_);
+            });
+            size_ = 0;
+        }
+
+        auto push_back(value_type const& value) -> void
+        requires (std::copy_constructible<Ts> and ...)
+        {
+            std::apply([&](Ts const&... fields) { emplace_back(fields...); }, value);
+        }
+
+        auto push_back(value_type&& value) -> void
+        requires (std::move_constructible<Ts> and ...)
+        {
+            std::apply([&](Ts&... fields) { emplace_back(std::move(fields)...); }, value);
+        }
+
+        /// Appends a record, constructing each field from the corresponding argument.
+        template <typename... Args>
+        requires (sizeof...(Args) == column_count) and (std::constructible_from<Ts, Args> and ...)
+        auto emplace_back(Args&& ... args) -> reference
+        {
+            if (size_ == capacity_)
+            {
+                // The arguments may refer to fields, so the record is constructed before reallocating.
+                auto record = value_type(std::forward<Args>(args)...);
+                reallocate(grown_capacity(size_ + 1));
+                std::apply([&](Ts&... fields) { construct_row(size_, std::move(fields)...); }, record);
+            }
+            else
+            {
+                construct_row(size_, std::forward<Args>(args)...);
+            }
+            ++size_;
+            return back();
+        }
+
+        auto pop_back() noexcept -> void
+        {
+            --size_;
+            for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                std::destroy_at(std::get<I>(columns_) + size_);
+            });
+        }
+
+        /// Removes the record at index, shifting the following records.
+        auto erase(size_type const index) -> void
+        requires (std::is_move_assignable_v<Ts> and ...)
+        {
+            for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                auto* const column = std::get<I>(columns_);
+                std::move(column + index + 1, column + size_, column + index);
+            });
+            pop_back();
+        }
+
+        /// Removes the record at index by moving the last record into its place,
+        /// in constant time. Does not preserve the order of the records.
+        auto swap_erase(size_type const index) -> void
+        requires (std::is_move_assignable_v<Ts> and ...)
+        {
+            if (index != size_ - 1)
+            {
+                for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                    auto* const column = std::get<I>(columns_);
+                    column[index] = std::move(column[size_ - 1]);
+                });
+            }
+            pop_back();
+        }
+
+        auto resize(size_type const new_size) -> void
+        requires (std::default_initializable<Ts> and ...)
+        {
+            if (new_size < size_)
+            {
+                for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                    std::destroy(std::get<I>(columns_) + new_size, std::get<I>(columns_) + size_);
+                });
+                size_ = new_size;
+                return;
+            }
+            if (new_size > capacity_)
+            {
+                reallocate(grown_capacity(new_size));
+            }
+            while (size_ < new_size)
+            {
+                construct_row(size_, Ts()...);
+                ++size_;
+            }
+        }
+
+        auto swap(soa_vector& other) noexcept -> void
+        {
+            std::swap(columns_, other.columns_);
+            std::swap(size_, other.size_);
+            std::swap(capacity_, other.capacity_);
+        }
+
+        friend auto swap(soa_vector& lhs, soa_vector& rhs) noexcept -> void
+        {
+            lhs.swap(rhs);
+        }
+
+        // Comparison
+
+        friend auto operator==(soa_vector const& lhs, soa_vector const& rhs) -> bool
+        requires (std::equality_comparable<Ts> and ...)
+        {
+            if (lhs.size_ != rhs.size_)
+            {
+                return false;
+            }
+            auto equal = true;
+            lhs.for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                equal = equal and std::equal(
+                    std::get<I>(lhs.columns_), std::get<I>(lhs.columns_) + lhs.size_, std::get<I>(rhs.columns_));
+            });
+            return equal;
+        }
+
+    private:
+        using columns_type = std::tuple<Ts*...>;
+
+        columns_type columns_ = {};
+        size_type size_ = 0;
+        size_type capacity_ = 0;
+
+        template <typename Fn>
+        static auto for_each_column(Fn&& fn) -> void
+        {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                (fn(std::integral_constant<std::size_t, Is>{}), ...);
+            }(std::index_sequence_for<Ts...>{});
+        }
+
+        auto check_index(size_type const index) const -> void
+        {
+            if (index >= size_)
+            {
+                throw std::out_of_range{"more_concepts::soa_vector: index out of range"};
+            }
+        }
+
+        [[nodiscard]] auto checked_capacity(size_type const required) const -> size_type
+        {
+            if (required > max_size())
+            {
+                throw std::length_error{"more_concepts::soa_vector: maximum size exceeded"};
+            }
+            return required;
+        }
+
+        /// The capacity to grow to when at least required records are needed: double the current
+        /// capacity, so that appending takes amortized constant time.
+        [[nodiscard]] auto grown_capacity(size_type const required) const -> size_type
+        {
+            auto const max_size = this->max_size();
+            auto const doubled = capacity_ == 0 ? std::min<size_type>(4, max_size) : std::min(capacity_ * 2, max_size);
+            return std::max(checked_capacity(required), doubled);
+        }
+
+        /// Allocates uninitialized columns for capacity records.
+        static auto allocate_columns(size_type const capacity) -> columns_type
+        {
+            auto columns = columns_type{};
+            try
+            {
+                for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                    std::get<I>(columns) = std::allocator<column_value_type<I>>{}.allocate(capacity);
+                });
+            }
+            catch (...)
+            {
+                deallocate_columns(columns, capacity);
+                throw;
+            }
+            return columns;
+        }
+
+        /// Deallocates the (allocated, or null) columns, whose elements are destroyed already.
+        static auto deallocate_columns(columns_type const& columns, size_type const capacity) noexcept -> void
+        {
+            for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                if (std::get<I>(columns) != nullptr)
+                {
+                    std::allocator<column_value_type<I>>{}.deallocate(std::get<I>(columns), capacity);
+                }
+            });
+        }
+
+        /// Copies count records of src to the uninitialized dest columns. If a copy throws,
+        /// the copied records are destroyed, and dest (of the given capacity) is deallocated.
+        static auto copy_columns(
+            columns_type const& src,
+            columns_type const& dest,
+            size_type const count,
+            size_type const dest_capacity) -> void
+        {
+            auto copied = std::size_t{0};
+            try
+            {
+                for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                    std::uninitialized_copy_n(std::get<I>(src), count, std::get<I>(dest));
+                    ++copied;
+                });
+            }
+            catch (...)
+            {
+                for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                    if (I < copied)
+                    {
+                        std::destroy_n(std::get<I>(dest), count);
+                    }
+                });
+                deallocate_columns(dest, dest_capacity);
+                throw;
+            }
+        }
+
+        /// Moves the records to new columns of the given capacity. Provides the strong exception
+        /// guarantee: columns whose elements may throw when moved are copied (if they are copyable)
+        /// before the other columns are relocated.
+        auto reallocate(size_type const new_capacity) -> void
+        {
+            auto const new_columns = allocate_columns(new_capacity);
+
+            // The columns that may throw are transferred first, so that nothing has been relocated
+            // (and the old columns are intact) if they throw.
+            auto transferred = std::size_t{0};
+            try
+            {
+                for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                    using T = column_value_type<I>;
+                    if constexpr (not detail::nothrow_relocatable<T>)
+                    {
+                        if constexpr (std::copy_constructible<T>)
+                        {
+                            std::uninitialized_copy_n(std::get<I>(columns_), size_, std::get<I>(new_columns));
+                        }
+                        else
+                        {
+                            std::uninitialized_move_n(std::get<I>(columns_), size_, std::get<I>(new_columns));
+                        }
+                    }
+                    ++transferred;
+                });
+            }
+            catch (...)
+            {
+                for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                    if (I < transferred and not detail::nothrow_relocatable<column_value_type<I>>)
+                    {
+                        std::destroy_n(std::get<I>(new_columns), size_);
+                    }
+                });
+                deallocate_columns(new_columns, new_capacity);
+                throw;
+            }
+
+            for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                using T = column_value_type<I>;
+                auto* const column = std::get<I>(columns_);
+                if constexpr (detail::nothrow_relocatable<T>)
+                {
+                    uninitialized_relocate(column, column + size_, std::get<I>(new_columns));
+                }
+                else
+                {
+                    std::destroy_n(column, size_);
+                }
+            });
+
+            deallocate_columns(columns_, capacity_);
+            columns_ = new_columns;
+            capacity_ = new_capacity;
+        }
+
+        /// Constructs the fields of the record at index (below the capacity) from args.
+        /// If a field constructor throws, the fields constructed so far are destroyed.
+        template <typename... Args>
+        auto construct_row(size_type const index, Args&& ... args) -> void
+        {
+            auto constructed = std::size_t{0};
+            try
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    ((std::construct_at(std::get<Is>(columns_) + index, std::forward<Args>(args)), ++constructed), ...);
+                }(std::index_sequence_for<Ts...>{});
+            }
+            catch (...)
+            {
+                for_each_column([&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+                    if (I < constructed)
+                    {
+                        std::destroy_at(std::get<I>(columns_) + index);
+                    }
+                });
+                throw;
+            }
+        }
+
+        auto destroy_and_deallocate() noexcept -> void
+        {
+            clear();
+            deallocate_columns(columns_, capacity_);
+            columns_ = {};
+            capacity_ = 0;
+        }
+    };
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <iterator>
+#include <utility>
+
+#include "more_concepts/associative_containers.hpp"
+
+namespace more_concepts
+{
+    /// Tag declaring that a sequence of values is sorted by the comparator of the container
+    /// it is inserted into, and free of equivalent keys.
+    struct sorted_unique_t
+    {
+        explicit sorted_unique_t() = default;
+    };
+
+    inline constexpr auto sorted_unique = sorted_unique_t{};
+
+    /// Tag declaring that a sequence of values is sorted by the comparator of the container
+    /// it is inserted into (it may contain equivalent keys).
+    struct sorted_equivalent_t
+    {
+        explicit sorted_equivalent_t() = default;
+    };
+
+    inline constexpr auto sorted_equivalent = sorted_equivalent_t{};
+
+    namespace detail
+    {
+        template <typename Tag>
+        concept sorted_tag = std::same_as<Tag, sorted_unique_t> or std::same_as<Tag, sorted_equivalent_t>;
+
+        /// Inserts sorted values one by one, each with a hint just past the previously inserted one.
+        /// If the values belong there (always, when the container is empty or the values are greater
+        /// than its elements), every insertion takes amortized constant time.
+        ///
+        /// In debug builds, asserts that the values are sorted (strictly, for sorted_unique_t),
+        /// if insertion does not invalidate iterators (as in node-based containers).
+        template <typename Tag, typename C, typename I, typename S>
+        auto insert_sorted_with_hints(C& cont, I first, S const last) -> void
+        {
+            auto hint = cont.cend();
+#ifndef NDEBUG
+            constexpr auto check_order = node_extractable_container<C>;
+            auto const value_comp = cont.value_comp();
+            auto previous = cont.cend();
+#endif
+            for (; first != last; ++first)
+            {
+                auto const pos = cont.emplace_hint(hint, *first);
+#ifndef NDEBUG
+                if (check_order and previous != cont.cend())
+                {
+                    if constexpr (std::same_as<Tag, sorted_unique_t>)
+                    {
+                        assert(value_comp(*previous, *pos) and "the values must be sorted and unique");
+                    }
+                    else
+                    {
+                        assert(not value_comp(*pos, *previous) and "the values must be sorted");
+                    }
+                }
+                previous = pos;
+#endif
+                hint = std::next(typename C::const_iterator{pos});
+            }
+        }
+    }
+
+    /// Inserts the values in [first, last), which are sorted by the comparator of cont, into cont.
+    /// Each value is inserted with a hint past the previous one, so building a container from
+    /// sorted values, or appending values greater than its elements, takes linear time instead of
+    /// O(n log n). Containers that support a sorted bulk insert (insert(tag, first, last),
+    /// e.g. flat_map) use it instead.
+    ///
+    /// Values out of order are still inserted correctly, only slower; in debug builds
+    /// (without NDEBUG), they fail an assertion. With the sorted_unique tag, the values must
+    /// also be free of equivalent keys.
+    template <ordered_associative_container C, typename Tag, std::input_iterator I, std::sentinel_for<I> S>
+    requires std::constructible_from<typename C::value_type, std::iter_reference_t<I>> and detail::sorted_tag<Tag>
+    auto insert_sorted(C& cont, Tag const tag, I first, S const last) -> void
+    {
+        if constexpr (requires { cont.insert(tag, std::move(first), last); })
+        {
+            cont.insert(tag, std::move(first), last);
+        }
+        else
+        {
+            detail::insert_sorted_with_hints<Tag>(cont, std::move(first), last);
+        }
+    }
+
+    template <ordered_associative_container C, std::input_iterator I, std::sentinel_for<I> S>
+    requires std::constructible_from<typename C::value_type, std::iter_reference_t<I>>
+    auto insert_sorted(C& cont, I first, S const last) -> void
+    {
+        insert_sorted(cont, sorted_equivalent, std::move(first), last);
+    }
+
+    /// Creates an ordered associative container from the sorted values in [first, last),
+    /// in linear time: with the container's own tagged constructor if it has one
+    /// (e.g. flat_map(sorted_unique, first, last)), and with insert_sorted otherwise.
+    template <ordered_associative_container C, typename Tag, std::input_iterator I, std::sentinel_for<I> S>
+    requires std::constructible_from<typename C::value_type, std::iter_reference_t<I>> and detail::sorted_tag<Tag>
+    [[nodiscard]] auto make_sorted(
+        Tag const tag,
+        I first,
+        S const last,
+        typename C::key_compare const& comp = typename C::key_compare()) -> C
+    {
+        if constexpr (std::constructible_from<C, Tag, I, S, typename C::key_compare const&>)
+        {
+            return C(tag, std::move(first), last, comp);
+        }
+        else
+        {
+            auto cont = C(comp);
+            insert_sorted(cont, tag, std::move(first), last);
+            return cont;
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace more_concepts
+{
+    /// A transparent hash for strings: std::string, std::string_view and C strings
+    /// with equal contents get the same hash, so they can all be used to look up
+    /// std::string keys without constructing a std::string.
+    struct string_hash
+    {
+        using is_transparent = void;
+
+        [[nodiscard]] auto operator()(std::string_view const str) const noexcept -> std::size_t
+        {
+            return std::hash<std::string_view>{}(str);
+        }
+
+        [[nodiscard]] auto operator()(std::string const& str) const noexcept -> std::size_t
+        {
+            return std::hash<std::string_view>{}(str);
+        }
+
+        [[nodiscard]] auto operator()(char const* const str) const noexcept -> std::size_t
+        {
+            return std::hash<std::string_view>{}(str);
+        }
+    };
+
+    /// Ordered and unordered string-keyed containers with heterogeneous lookup: find, count,
+    /// contains and equal_range (and lower_bound / upper_bound for the ordered ones) accept
+    /// std::string_view and C strings without allocating a temporary std::string.
+    /// They model transparent_lookup_container<C, std::string_view>.
+
+    template <typename T>
+    using string_map = std::map<std::string, T, std::less<>>;
+
+    template <typename T>
+    using string_multimap = std::multimap<std::string, T, std::less<>>;
+
+    using string_set = std::set<std::string, std::less<>>;
+
+    template <typename T>
+    using unordered_string_map = std::unordered_map<std::string, T, string_hash, std::equal_to<>>;
+
+    template <typename T>
+    using unordered_string_multimap = std::unordered_multimap<std::string, T, string_hash, std::equal_to<>>;
+
+    using unordered_string_set = std::unordered_set<std::string, string_hash, std::equal_to<>>;
+}
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/associative_containers.hpp"
+#include "more_concepts/base_concepts.hpp"
+#include "more_concepts/concurrent_containers.hpp"
+#include "more_concepts/detail/cache_line.hpp"
+
+namespace more_concepts
+{
+    /// A concurrent hash map made of Shards independent maps (of type Map), each guarded by its own
+    /// reader-writer lock. A key belongs to the shard picked by its hash, so threads working
+    /// with keys in different shards do not contend, and lookups in the same shard only take
+    /// the lock in shared mode.
+    ///
+    /// The shard index is taken from the high bits of the (Fibonacci-mixed) hash, so that the keys
+    /// of a shard still spread over all the buckets of its map. Each shard is on its own cache line(s).
+    /// There are no iterators or references to the elements: find returns a copy, and visit calls
+    /// a function with the mapped object while its shard is locked. The function must not access
+    /// the striped_map.
+    template <unordered_unique_map_container Map, std::size_t Shards = 16>
+    requires std::copyable<Map> and (std::has_single_bit(Shards))
+    class striped_map
+    {
+    public:
+        using map_type = Map;
+        using key_type = typename Map::key_type;
+        using mapped_type = typename Map::mapped_type;
+        using size_type = typename Map::size_type;
+        using hasher = typename Map::hasher;
+        using key_equal = typename Map::key_equal;
+
+        static constexpr auto shard_count = Shards;
+
+        striped_map() = default;
+
+        /// Creates every shard as a copy of prototype, e.g. to set its hasher or allocator.
+        /// The elements of prototype are copied to every shard, so it should be empty.
+        explicit striped_map(Map const& prototype)
+            : hash_{prototype.hash_function()}
+        {
+            for (auto& shard : shards_)
+            {
+                shard.map = prototype;
+            }
+        }
+
+        striped_map(striped_map const&) = delete;
+        auto operator=(striped_map const&) -> striped_map& = delete;
+
+        [[nodiscard]] auto hash_function() const -> hasher
+        {
+            return hash_;
+        }
+
+        /// Returns the number of elements. The shards are counted one at a time,
+        /// so the result is not a snapshot if other threads modify the map.
+        [[nodiscard]] auto size() const -> size_type
+        {
+            auto total = size_type{0};
+            for (auto const& shard : shards_)
+            {
+                auto const lock = std::shared_lock{shard.mutex};
+                total += shard.map.size();
+            }
+            return total;
+        }
+
+        [[nodiscard]] auto empty() const -> bool
+        {
+            return size() == 0;
+        }
+
+        auto clear() -> void
+        {
+            for (auto& shard : shards_)
+            {
+                auto const lock = std::unique_lock{shard.mutex};
+                shard.map.clear();
+            }
+        }
+
+        [[nodiscard]] auto contains(key_type const& key) const -> bool
+        {
+            auto const& shard = shard_for(key);
+            auto const lock = std::shared_lock{shard.mutex};
+            return shard.map.contains(key);
+        }
+
+        /// Returns a copy of the object mapped to key, if there is one.
+        [[nodiscard]] auto find(key_type const& key) const -> std::optional<mapped_type>
+        requires std::copyable<mapped_type>
+        {
+            auto const& shard = shard_for(key);
+            auto const lock = std::shared_lock{shard.mutex};
+            auto const it = shard.map.find(key);
+            if (it == shard.map.end())
+            {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+
+        /// Calls fn with the object mapped to key, if there is one, while no other thread
+        /// can access it. Returns whether the key was found.
+        template <invocable_as<void(mapped_type&)> Fn>
+        auto visit(key_type const& key, Fn&& fn) -> bool
+        {
+            auto& shard = shard_for(key);
+            auto const lock = std::unique_lock{shard.mutex};
+            auto const it = shard.map.find(key);
+            if (it == shard.map.end())
+            {
+                return false;
+            }
+            std::invoke(std::forward<Fn>(fn), it->second);
+            return true;
+        }
+
+        /// Calls fn with the object mapped to key, if there is one, while no other thread
+        /// can modify it. Returns whether the key was found.
+        template <invocable_as<void(mapped_type const&)> Fn>
+        auto visit(key_type const& key, Fn&& fn) const -> bool
+        {
+            auto const& shard = shard_for(key);
+            auto const lock = std::shared_lock{shard.mutex};
+            auto const it = shard.map.find(key);
+            if (it == shard.map.end())
+            {
+                return false;
+            }
+            std::invoke(std::forward<Fn>(fn), std::as_const(it->second));
+            return true;
+        }
+
+        /// Calls fn with every element, locking one shard at a time.
+        template <invocable_as<void(key_type const&, mapped_type&)> Fn>
+        auto visit_all(Fn&& fn) -> void
+        {
+            for (auto& shard : shards_)
+            {
+                auto const lock = std::unique_lock{shard.mutex};
+                for (auto& [key, obj] : shard.map)
+                {
+                    std::invoke(fn, key, obj);
+                }
+            }
+        }
+
+        /// Calls fn with every element, locking one shard at a time.
+        template <invocable_as<void(key_type const&, mapped_type const&)> Fn>
+        auto visit_all(Fn&& fn) const -> void
+        {
+            for (auto const& shard : shards_)
+            {
+                auto const lock = std::shared_lock{shard.mutex};
+                for (auto const& [key, obj] : shard.map)
+                {
+                    std::invoke(fn, key, obj);
+                }
+            }
+        }
+
+        /// Inserts or assigns the object mapped to key. Returns whether the key was inserted.
+        template <typename Obj>
+        requires std::assignable_from<mapped_type&, Obj> and std::constructible_from<mapped_type, Obj>
+        auto insert_or_assign(key_type const& key, Obj&& obj) -> bool
+        {
+            auto& shard = shard_for(key);
+            auto const lock = std::unique_lock{shard.mutex};
+            return shard.map.insert_or_assign(key, std::forward<Obj>(obj)).second;
+        }
+
+        /// Inserts or assigns the object mapped to key. Returns whether the key was inserted.
+        template <typename Obj>
+        requires std::assignable_from<mapped_type&, Obj> and std::constructible_from<mapped_type, Obj>
+        auto insert_or_assign(key_type&& key, Obj&& obj) -> bool
+        {
+            auto& shard = shard_for(key);
+            auto const lock = std::unique_lock{shard.mutex};
+            return shard.map.insert_or_assign(std::move(key), std::forward<Obj>(obj)).second;
+        }
+
+        /// Inserts an object constructed from args, unless key is already present.
+        /// Returns whether the key was inserted.
+        template <typename... Args>
+        requires std::constructible_from<mapped_type, Args...>
+        auto try_emplace(key_type const& key, Args&& ... args) -> bool
+        {
+            auto& shard = shard_for(key);
+            auto const lock = std::unique_lock{shard.mutex};
+            return shard.map.try_emplace(key, std::forward<Args>(args)...).second;
+        }
+
+        auto erase(key_type const& key) -> size_type
+        {
+            auto& shard = shard_for(key);
+            auto const lock = std::unique_lock{shard.mutex};
+            return shard.map.erase(key);
+        }
+
+    private:
+        struct alignas(detail::cache_line_size) shard_type
+        {
+            mutable std::shared_mutex mutex;
+            Map map;
+        };
+
+        std::array<shard_type, Shards> shards_;
+        [[no_unique_address]] hasher hash_ = {};
+
+        [[nodiscard]] auto shard_index(key_type const& key) const -> std::size_t
+        {
+            if constexpr (Shards == 1)
+            {
+                return 0;
+            }
+            else
+            {
+                auto const hash = static_cast<std::uint64_t>(hash_(key));
+                return static_cast<std::size_t>(
+                    (hash * std::uint64_t{0x9E3779B97F4A7C15}) >> (64 - std::countr_zero(Shards)));
+            }
+        }
+
+        [[nodiscard]] auto shard_for(key_type const& key) -> shard_type&
+        {
+            return shards_[shard_index(key)];
+        }
+
+        [[nodiscard]] auto shard_for(key_type const& key) const -> shard_type const&
+        {
+            return shards_[shard_index(key)];
+        }
+    };
+}
@@ -0,0 +1,32 @@
+module;
+
+// All standard headers used by the library are included in the global module fragment,
+// so that the library headers included in the module purview below do not attach them
+// to the module.
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+export module more_concepts;
+
+// The library entities stay attached to the global module, so that the headers can be used
+// alongside the module (in other translation units) without ODR violations, and users can keep
+// specializing enable_container_category.
+export extern "C++"
+{
+#include "more_concepts/more_concepts.hpp"
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Most of the tests are compile-time only (static_assert). Tests that need to run code
+// register a test case, which is then run by test_main.cpp.
+
+namespace more_concepts_tests
+{
+    struct test_case
+    {
+        char const* name;
+        void (* run)();
+    };
+
+    inline auto registered_test_cases() -> std::vector<test_case>&
+    {
+        static auto test_cases = std::vector<test_case>{};
+        return test_cases;
+    }
+
+    struct register_test_case
+    {
+        register_test_case(char const* const name, void (* const run)())
+        {
+            registered_test_cases().push_back({name, run});
+        }
+    };
+}
+
+/// Aborts the test run if the condition does not hold.
+#define MORE_CONCEPTS_CHECK(...)                                                         \
+    do                                                                                   \
+    {                                                                                    \
+        if (not (__VA_ARGS__))                                                           \
+        {                                                                                \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #__VA_ARGS__); \
+            std::abort();                                                                \
+        }                                                                                \
+    } while (false)
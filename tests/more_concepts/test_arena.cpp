@@ -0,0 +1,125 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "more_concepts/arena.hpp"
+#include "more_concepts/base_containers.hpp"
+#include "more_concepts/flat_map.hpp"
+#include "more_concepts/inplace_vector.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    static_assert(not more_concepts::allocator_aware_container<std::array<int, 4>>);
+    static_assert(not more_concepts::allocator_aware_container<more_concepts::inplace_vector<int, 4>>);
+    static_assert(not more_concepts::allocator_aware_container<more_concepts::flat_map<int, int>>);
+
+    /// Forwards to the new/delete resource, counting the allocations.
+    class counting_resource : public std::pmr::memory_resource
+    {
+    public:
+        int allocations = 0;
+        int outstanding = 0;
+
+    private:
+        auto do_allocate(std::size_t const bytes, std::size_t const alignment) -> void* override
+        {
+            ++allocations;
+            ++outstanding;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        auto do_deallocate(void* const ptr, std::size_t const bytes, std::size_t const alignment) -> void override
+        {
+            --outstanding;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]] auto do_is_equal(std::pmr::memory_resource const& other) const noexcept -> bool override
+        {
+            return this == &other;
+        }
+    };
+
+    /// Generic code building a container with the given allocator.
+    template <more_concepts::allocator_aware_container_of<std::pmr::string> C>
+    auto make_words(typename C::allocator_type const& alloc, int const count) -> C
+    {
+        auto words = C(alloc);
+        for (auto i = 0; i < count; ++i)
+        {
+            words.push_back(std::pmr::string(40, static_cast<char>('a' + i % 26)));
+        }
+        return words;
+    }
+
+    auto test_scoped_arena() -> void
+    {
+        auto upstream = counting_resource{};
+        auto arena = more_concepts::scoped_arena<1024>{&upstream};
+
+        auto const handle_request = [&] {
+            auto map = arena.make<std::pmr::unordered_map<int, std::pmr::string>>();
+            for (auto i = 0; i < 500; ++i)
+            {
+                map.emplace(i, std::pmr::string(30, 'x'));
+            }
+            MORE_CONCEPTS_CHECK(map.size() == 500 and map.at(499).size() == 30);
+            MORE_CONCEPTS_CHECK(map.get_allocator().resource() == &arena.resource());
+
+            auto const words = make_words<std::pmr::vector<std::pmr::string>>(arena.allocator(), 100);
+            MORE_CONCEPTS_CHECK(words.size() == 100 and words[99].get_allocator().resource() == &arena.resource());
+        };
+
+        handle_request();
+        auto const allocations = upstream.allocations;
+        MORE_CONCEPTS_CHECK(allocations > 0);
+
+        // Once reset, the chunks are reused.
+        for (auto i = 0; i < 3; ++i)
+        {
+            arena.reset();
+            handle_request();
+        }
+        MORE_CONCEPTS_CHECK(upstream.allocations == allocations);
+
+        arena.resource().release();
+        MORE_CONCEPTS_CHECK(upstream.outstanding == 0);
+
+        // Small containers fit in the inline buffer.
+        auto const small = arena.make<std::pmr::vector<int>>(10u, 7);
+        MORE_CONCEPTS_CHECK(small.size() == 10 and small[9] == 7 and upstream.allocations == allocations);
+    }
+
+    auto test_arena_alignment() -> void
+    {
+        auto upstream = counting_resource{};
+        {
+            auto arena = more_concepts::arena_resource{&upstream};
+            for (auto const alignment : {std::size_t{1}, std::size_t{8}, std::size_t{64}, std::size_t{4096}})
+            {
+                for (auto const bytes : {std::size_t{1}, std::size_t{100}, std::size_t{10000}})
+                {
+                    auto* const ptr = arena.allocate(bytes, alignment);
+                    MORE_CONCEPTS_CHECK(reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0);
+                    static_cast<std::byte*>(ptr)[bytes - 1] = std::byte{1};
+                }
+            }
+            MORE_CONCEPTS_CHECK(upstream.outstanding > 0);
+        }
+        MORE_CONCEPTS_CHECK(upstream.outstanding == 0);
+    }
+
+    auto const arena_tests = more_concepts_tests::register_test_case{
+        "arena",
+        [] {
+            test_scoped_arena();
+            test_arena_alignment();
+        }};
+}
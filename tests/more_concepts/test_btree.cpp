@@ -0,0 +1,324 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "more_concepts/btree_map.hpp"
+#include "more_concepts/btree_set.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    // A node size of one byte gives the smallest nodes, with three values each,
+    // so that the tree has many levels and every rebalancing case is hit.
+    using small_map = more_concepts::btree_map<int, std::string, std::less<>, std::allocator<std::pair<int, std::string>>, 1>;
+    using small_multiset = more_concepts::btree_multiset<int, std::less<>, std::allocator<int>, 1>;
+    using small_multimap = more_concepts::btree_multimap<int, int, std::less<>, std::allocator<std::pair<int, int>>, 1>;
+
+    static_assert(small_map::node_capacity == 3);
+    static_assert(more_concepts::btree_set<int>::node_capacity == 60);
+    static_assert(more_concepts::btree_set<int, std::less<>, std::allocator<int>, 32>::node_capacity == 4);
+    static_assert(std::bidirectional_iterator<small_map::iterator>);
+    static_assert(std::bidirectional_iterator<small_multiset::const_iterator>);
+    static_assert(std::same_as<small_multiset::iterator, small_multiset::const_iterator>);
+
+    /// A small linear congruential generator, so that failures are reproducible.
+    class random_numbers
+    {
+    public:
+        auto operator()(unsigned const bound) -> int
+        {
+            state_ = state_ * 1103515245u + 12345u;
+            return static_cast<int>((state_ >> 8u) % bound);
+        }
+
+    private:
+        unsigned state_ = 7;
+    };
+
+    template <typename BTree, typename Reference>
+    auto equal_contents(BTree const& tree, Reference const& reference) -> bool
+    {
+        return tree.size() == reference.size() and
+               std::equal(tree.begin(), tree.end(), reference.begin(), reference.end(),
+                          [](auto const& lhs, auto const& rhs) { return lhs == std::remove_cvref_t<decltype(lhs)>(rhs); }) and
+               std::equal(tree.rbegin(), tree.rend(), reference.rbegin(), reference.rend(),
+                          [](auto const& lhs, auto const& rhs) { return lhs == std::remove_cvref_t<decltype(lhs)>(rhs); });
+    }
+
+    more_concepts_tests::register_test_case against_map{
+        "btree_map matches map",
+        [] {
+            auto tree = small_map{};
+            auto reference = std::map<int, std::string>{};
+            auto random = random_numbers{};
+
+            for (auto i = 0; i < 20000; ++i)
+            {
+                auto const key = random(300);
+                auto const value = std::string(20, static_cast<char>('a' + i % 26));
+                switch (random(8))
+                {
+                case 0:
+                case 1:
+                {
+                    auto const [pos, inserted] = tree.emplace(key, value);
+                    auto const [expected, expected_inserted] = reference.emplace(key, value);
+                    MORE_CONCEPTS_CHECK(inserted == expected_inserted);
+                    MORE_CONCEPTS_CHECK(pos->first == key and pos->second == expected->second);
+                    break;
+                }
+                case 2:
+                {
+                    // A hint that is right about half of the time.
+                    auto const hint = random(2) == 0 ? tree.lower_bound(key) : tree.begin();
+                    auto const pos = tree.emplace_hint(hint, key, value);
+                    reference.emplace(key, value);
+                    MORE_CONCEPTS_CHECK(pos->first == key and pos->second == reference.at(key));
+                    break;
+                }
+                case 3:
+                    MORE_CONCEPTS_CHECK(tree.erase(key) == reference.erase(key));
+                    break;
+                case 4:
+                {
+                    auto const pos = tree.lower_bound(key);
+                    auto const expected = reference.lower_bound(key);
+                    MORE_CONCEPTS_CHECK((pos == tree.end()) == (expected == reference.end()));
+                    if (pos != tree.end())
+                    {
+                        auto const next = tree.erase(pos);
+                        auto const expected_next = reference.erase(expected);
+                        MORE_CONCEPTS_CHECK((next == tree.end()) == (expected_next == reference.end()));
+                        MORE_CONCEPTS_CHECK(next == tree.end() or next->first == expected_next->first);
+                    }
+                    break;
+                }
+                case 5:
+                {
+                    auto const last_key = key + random(20);
+                    auto const last = tree.erase(tree.lower_bound(key), tree.lower_bound(last_key));
+                    auto const expected_last = reference.erase(reference.lower_bound(key), reference.lower_bound(last_key));
+                    MORE_CONCEPTS_CHECK(last == tree.end() or last->first == expected_last->first);
+                    break;
+                }
+                case 6:
+                {
+                    auto const lower = tree.lower_bound(key);
+                    auto const upper = tree.upper_bound(key);
+                    MORE_CONCEPTS_CHECK(lower == tree.end() or lower->first == reference.lower_bound(key)->first);
+                    MORE_CONCEPTS_CHECK(upper == tree.end() or upper->first == reference.upper_bound(key)->first);
+                    MORE_CONCEPTS_CHECK(tree.contains(key) == reference.contains(key));
+                    MORE_CONCEPTS_CHECK(std::distance(lower, upper) == static_cast<std::ptrdiff_t>(reference.count(key)));
+                    break;
+                }
+                case 7:
+                    tree.insert_or_assign(key, value);
+                    reference.insert_or_assign(key, value);
+                    break;
+                }
+                MORE_CONCEPTS_CHECK(equal_contents(tree, reference));
+            }
+
+            tree.clear();
+            MORE_CONCEPTS_CHECK(tree.empty() and tree.begin() == tree.end());
+        },
+    };
+
+    more_concepts_tests::register_test_case against_multiset{
+        "btree_multiset and btree_multimap match multiset and multimap",
+        [] {
+            auto tree = small_multiset{};
+            auto reference = std::multiset<int>{};
+            auto random = random_numbers{};
+
+            for (auto i = 0; i < 20000; ++i)
+            {
+                auto const key = random(100);
+                switch (random(5))
+                {
+                case 0:
+                case 1:
+                    MORE_CONCEPTS_CHECK(*tree.insert(key) == key);
+                    reference.insert(key);
+                    break;
+                case 2:
+                    MORE_CONCEPTS_CHECK(*tree.insert(tree.upper_bound(key), key) == key);
+                    reference.insert(key);
+                    break;
+                case 3:
+                    MORE_CONCEPTS_CHECK(tree.erase(key) == reference.erase(key));
+                    break;
+                case 4:
+                {
+                    MORE_CONCEPTS_CHECK(tree.count(key) == reference.count(key));
+                    auto const [first, last] = tree.equal_range(key);
+                    MORE_CONCEPTS_CHECK(std::distance(first, last) == static_cast<std::ptrdiff_t>(reference.count(key)));
+                    if (std::distance(first, last) > 1)
+                    {
+                        tree.erase(std::next(first));
+                        reference.erase(std::next(reference.lower_bound(key)));
+                    }
+                    break;
+                }
+                }
+                MORE_CONCEPTS_CHECK(equal_contents(tree, reference));
+            }
+
+            // Equivalent keys keep their insertion order.
+            auto map = small_multimap{};
+            auto reference_map = std::multimap<int, int>{};
+            for (auto i = 0; i < 1000; ++i)
+            {
+                auto const key = random(10);
+                map.emplace(key, i);
+                reference_map.emplace(key, i);
+            }
+            MORE_CONCEPTS_CHECK(equal_contents(map, reference_map));
+
+            // Hinted insertion goes as close to the hint as possible, wherever the hint is.
+            for (auto i = 0; i < 2000; ++i)
+            {
+                auto const key = random(10);
+                auto const distance = random(static_cast<unsigned>(map.size()) + 1);
+                auto const pos = map.emplace_hint(std::next(map.begin(), distance), key, -i);
+                auto const expected = reference_map.emplace_hint(std::next(reference_map.begin(), distance), key, -i);
+                MORE_CONCEPTS_CHECK(std::distance(map.begin(), pos) == std::distance(reference_map.begin(), expected));
+                MORE_CONCEPTS_CHECK(pos->first == key and pos->second == -i);
+            }
+            MORE_CONCEPTS_CHECK(equal_contents(map, reference_map));
+
+            auto front_hinted = small_multimap{{1, 0}, {2, 0}, {2, 1}};
+            MORE_CONCEPTS_CHECK(std::prev(front_hinted.emplace_hint(front_hinted.begin(), 2, 2))->first == 1);
+        },
+    };
+
+    more_concepts_tests::register_test_case sequential_insertion{
+        "btree_set sequential insertion and erasure",
+        [] {
+            auto set = more_concepts::btree_set<int>{};
+            for (auto i = 0; i < 10000; ++i)
+            {
+                auto const pos = set.insert(set.end(), i);
+                MORE_CONCEPTS_CHECK(pos == std::prev(set.end()));
+            }
+            MORE_CONCEPTS_CHECK(set.size() == 10000);
+            MORE_CONCEPTS_CHECK(std::is_sorted(set.begin(), set.end()));
+            MORE_CONCEPTS_CHECK(*set.find(5000) == 5000);
+
+            for (auto pos = set.begin(); pos != set.end();)
+            {
+                pos = set.erase(pos);
+                if (pos != set.end())
+                {
+                    ++pos;
+                }
+            }
+            MORE_CONCEPTS_CHECK(set.size() == 5000);
+            MORE_CONCEPTS_CHECK(*set.begin() == 1 and *std::prev(set.end()) == 9999);
+            MORE_CONCEPTS_CHECK(*set.lower_bound(100) == 101 and *set.upper_bound(101) == 103);
+
+            for (auto i = 9999; i > 0; i -= 2)
+            {
+                MORE_CONCEPTS_CHECK(set.erase(i) == 1);
+            }
+            MORE_CONCEPTS_CHECK(set.empty() and set.begin() == set.end());
+        },
+    };
+
+    more_concepts_tests::register_test_case map_interface{
+        "btree_map element access and modifiers",
+        [] {
+            auto map = more_concepts::btree_map<std::string, int>{{"b", 2}, {"a", 1}, {"c", 3}, {"a", 4}};
+            MORE_CONCEPTS_CHECK(map.size() == 3 and map.at("a") == 1);
+            MORE_CONCEPTS_CHECK(not map.try_emplace("a", 10).second);
+            MORE_CONCEPTS_CHECK(map.try_emplace(map.end(), "d", 4)->second == 4);
+            MORE_CONCEPTS_CHECK(not map.insert_or_assign("a", 11).second);
+            MORE_CONCEPTS_CHECK(map.at("a") == 11);
+            MORE_CONCEPTS_CHECK(map.insert_or_assign(map.begin(), "0", 0)->first == "0");
+            map["e"] = 5;
+            ++map["e"];
+            MORE_CONCEPTS_CHECK(map.at("e") == 6);
+            MORE_CONCEPTS_CHECK(map.value_comp()({"a", 0}, {"b", 0}));
+
+            auto thrown = false;
+            try
+            {
+                static_cast<void>(map.at("x"));
+            }
+            catch (std::out_of_range const&)
+            {
+                thrown = true;
+            }
+            MORE_CONCEPTS_CHECK(thrown);
+
+            auto const descending = more_concepts::btree_map<int, int, std::greater<>>{{1, 1}, {3, 3}, {2, 2}};
+            MORE_CONCEPTS_CHECK(descending.begin()->first == 3);
+            MORE_CONCEPTS_CHECK(descending.lower_bound(2)->first == 2);
+            MORE_CONCEPTS_CHECK(descending.upper_bound(2)->first == 1);
+        },
+    };
+
+    more_concepts_tests::register_test_case copy_move_and_compare{
+        "btree_map copy, move and comparison",
+        [] {
+            auto map = small_map{};
+            for (auto i = 0; i < 100; ++i)
+            {
+                map.emplace(i, std::to_string(i));
+            }
+
+            auto copy = map;
+            MORE_CONCEPTS_CHECK(copy == map);
+            copy[100] = "100";
+            MORE_CONCEPTS_CHECK(map < copy);
+
+            auto const* const element = &*copy.find(50);
+            auto moved = std::move(copy);
+            MORE_CONCEPTS_CHECK(copy.empty());
+            MORE_CONCEPTS_CHECK(&*moved.find(50) == element);
+
+            copy = moved;
+            MORE_CONCEPTS_CHECK(copy == moved);
+            map = std::move(moved);
+            MORE_CONCEPTS_CHECK(map == copy);
+
+            swap(map, moved);
+            MORE_CONCEPTS_CHECK(map.empty() and moved == copy);
+
+            map = {{2, "two"}, {1, "one"}};
+            MORE_CONCEPTS_CHECK(map.size() == 2 and map.begin()->second == "one");
+        },
+    };
+
+    more_concepts_tests::register_test_case memory_resource{
+        "btree_set with a memory resource",
+        [] {
+            auto buffer = std::array<std::byte, 16384>{};
+            auto resource = std::pmr::monotonic_buffer_resource{buffer.data(), buffer.size()};
+            using set = more_concepts::btree_set<int, std::less<>, std::pmr::polymorphic_allocator<int>>;
+
+            auto values = set(&resource);
+            for (auto i = 0; i < 1000; ++i)
+            {
+                values.insert(i * 7 % 1000);
+            }
+            auto copy = set(values, &resource);
+            MORE_CONCEPTS_CHECK(copy.get_allocator().resource() == &resource);
+            MORE_CONCEPTS_CHECK(copy == values);
+
+            auto other = set(std::move(values), std::pmr::new_delete_resource());
+            MORE_CONCEPTS_CHECK(other == copy);
+            MORE_CONCEPTS_CHECK(values.empty());
+        },
+    };
+}
@@ -0,0 +1,285 @@
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <map>
+#include <ranges>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "more_concepts/bulk_algorithms.hpp"
+#include "more_concepts/flat_map.hpp"
+#include "more_concepts/inplace_vector.hpp"
+#include "more_concepts/ring_deque.hpp"
+#include "more_concepts/small_vector.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    struct padded
+    {
+        std::uint8_t a;
+        std::uint32_t b;
+
+        auto operator==(padded const&) const -> bool = default;
+    };
+
+    /// A type without padding whose equality ignores one of its members.
+    struct cached_key
+    {
+        int id;
+        int cache;
+
+        friend auto operator==(cached_key const lhs, cached_key const rhs) -> bool
+        {
+            return lhs.id == rhs.id;
+        }
+    };
+
+    static_assert(more_concepts::detail::bytewise_comparable_containers<
+        std::vector<int>, std::array<int, 4>>);
+    static_assert(more_concepts::detail::bytewise_copyable_containers<
+        std::vector<double>, std::vector<double>>);
+    static_assert(not more_concepts::detail::bytewise_comparable_containers<
+        std::vector<double>, std::vector<double>>);
+    static_assert(not more_concepts::detail::bytewise_comparable_containers<
+        std::vector<padded>, std::vector<padded>>);
+    static_assert(not more_concepts::detail::bytewise_copyable_containers<
+        std::deque<int>, std::vector<int>>);
+    static_assert(not more_concepts::detail::bytewise_copyable_containers<
+        std::vector<std::string>, std::vector<std::string>>);
+
+    // The generic fallbacks are usable in constant expressions.
+    constexpr auto constexpr_bulk_test() -> bool
+    {
+        auto src = std::array<int, 3>{1, 2, 3};
+        auto dest = std::array<int, 4>{};
+        more_concepts::bulk_copy(src, dest);
+        more_concepts::bulk_fill(src, 7);
+        return dest[2] == 3 and dest[3] == 0 and src[0] == 7 and
+               not more_concepts::bulk_equal(src, dest);
+    }
+
+    static_assert(constexpr_bulk_test());
+
+    auto test_bulk_copy() -> void
+    {
+        auto const src = std::vector<int>{1, 2, 3};
+        auto dest = std::array<int, 5>{};
+        auto const it = more_concepts::bulk_copy(src, dest);
+        MORE_CONCEPTS_CHECK(it == dest.begin() + 3);
+        MORE_CONCEPTS_CHECK((dest == std::array<int, 5>{1, 2, 3, 0, 0}));
+
+        auto list = std::list<int>(4);
+        more_concepts::bulk_copy(src, list);
+        MORE_CONCEPTS_CHECK((list == std::list<int>{1, 2, 3, 0}));
+
+        auto strings = std::vector<std::string>(2);
+        more_concepts::bulk_copy(std::deque<std::string>{"a", "b"}, strings);
+        MORE_CONCEPTS_CHECK(strings.back() == "b");
+    }
+
+    auto test_bulk_fill() -> void
+    {
+        auto bytes = std::vector<std::uint8_t>(5);
+        more_concepts::bulk_fill(bytes, 0xAB);
+        MORE_CONCEPTS_CHECK((bytes == std::vector<std::uint8_t>(5, 0xAB)));
+
+        auto ints = std::vector<int>(5, 3);
+        more_concepts::bulk_fill(ints, 0);
+        MORE_CONCEPTS_CHECK((ints == std::vector<int>(5, 0)));
+        more_concepts::bulk_fill(ints, 42);
+        MORE_CONCEPTS_CHECK((ints == std::vector<int>(5, 42)));
+
+        auto doubles = std::vector<double>(3, 1.0);
+        more_concepts::bulk_fill(doubles, -0.0);
+        MORE_CONCEPTS_CHECK(std::signbit(doubles[1]));
+
+        auto list = std::forward_list<int>{1, 2};
+        more_concepts::bulk_fill(list, 5);
+        MORE_CONCEPTS_CHECK((list == std::forward_list<int>{5, 5}));
+    }
+
+    auto test_bulk_equal() -> void
+    {
+        MORE_CONCEPTS_CHECK(more_concepts::bulk_equal(std::vector<int>{1, 2}, std::array<int, 2>{1, 2}));
+        MORE_CONCEPTS_CHECK(not more_concepts::bulk_equal(std::vector<int>{1, 2}, std::vector<int>{1, 3}));
+        MORE_CONCEPTS_CHECK(not more_concepts::bulk_equal(std::vector<int>{1, 2}, std::vector<int>{1}));
+        MORE_CONCEPTS_CHECK(more_concepts::bulk_equal(std::vector<int>{}, std::vector<int>{}));
+
+        // Not bytewise comparable: +0.0 == -0.0
+        MORE_CONCEPTS_CHECK(more_concepts::bulk_equal(std::vector<double>{0.0}, std::vector<double>{-0.0}));
+
+        // Not bytewise comparable: operator== ignores cache
+        MORE_CONCEPTS_CHECK(more_concepts::bulk_equal(
+            std::vector<cached_key>{{1, 10}}, std::vector<cached_key>{{1, 20}}));
+
+        MORE_CONCEPTS_CHECK(more_concepts::bulk_equal(std::list<int>{1, 2}, std::vector<int>{1, 2}));
+        MORE_CONCEPTS_CHECK(not more_concepts::bulk_equal(std::forward_list<int>{1}, std::deque<int>{1, 2}));
+    }
+
+    auto test_bulk_assign() -> void
+    {
+        auto dest = std::vector<int>{9, 9, 9, 9};
+        more_concepts::bulk_assign(dest, std::array<int, 2>{1, 2});
+        MORE_CONCEPTS_CHECK((dest == std::vector<int>{1, 2}));
+        more_concepts::bulk_assign(dest, std::vector<int>{3, 4, 5});
+        MORE_CONCEPTS_CHECK((dest == std::vector<int>{3, 4, 5}));
+        more_concepts::bulk_assign(dest, std::vector<int>{});
+        MORE_CONCEPTS_CHECK(dest.empty());
+
+        auto list = std::list<int>{};
+        more_concepts::bulk_assign(list, std::vector<int>{1, 2});
+        MORE_CONCEPTS_CHECK((list == std::list<int>{1, 2}));
+    }
+
+    static_assert(more_concepts::reservable_container_of<std::vector<int>, int>);
+    static_assert(more_concepts::reservable_container<std::string>);
+    static_assert(more_concepts::reservable_container<more_concepts::small_vector<int, 4>>);
+    static_assert(more_concepts::reservable_container<more_concepts::ring_deque<int>>);
+    static_assert(not more_concepts::reservable_container<std::deque<int>>);
+    static_assert(not more_concepts::reservable_container<std::list<int>>);
+    static_assert(not more_concepts::reservable_container<std::array<int, 4>>);
+    static_assert(not more_concepts::reservable_container<more_concepts::inplace_vector<int, 4>>);
+    static_assert(not more_concepts::reservable_container<std::unordered_set<int>>);
+
+    /// A sized range with move-only input iterators, which cannot be passed to the standard
+    /// container range operations.
+    struct move_only_input_range
+    {
+        int count;
+
+        class iterator
+        {
+        public:
+            using value_type = int;
+            using difference_type = std::ptrdiff_t;
+
+            explicit iterator(int const value)
+                : value_{value}
+            {
+            }
+
+            iterator(iterator&&) = default;
+            auto operator=(iterator&&) -> iterator& = default;
+
+            auto operator*() const -> int { return value_; }
+
+            auto operator++() -> iterator&
+            {
+                ++value_;
+                return *this;
+            }
+
+            auto operator++(int) -> void { ++value_; }
+
+            friend auto operator==(iterator const& it, int const end) -> bool { return it.value_ == end; }
+
+        private:
+            int value_;
+        };
+
+        [[nodiscard]] auto begin() const -> iterator { return iterator{0}; }
+        [[nodiscard]] auto end() const -> int { return count; }
+        [[nodiscard]] auto size() const -> std::size_t { return static_cast<std::size_t>(count); }
+    };
+
+    static_assert(std::ranges::sized_range<move_only_input_range>);
+    static_assert(not std::ranges::forward_range<move_only_input_range>);
+
+    auto test_append_range() -> void
+    {
+        auto vector = std::vector<int>{};
+        more_concepts::append_range(vector, std::views::iota(0, 1000));
+        MORE_CONCEPTS_CHECK(vector.size() == 1000 and vector.capacity() == 1000 and vector.back() == 999);
+
+        // A sized range without a common end is still reserved for.
+        auto const list = std::list<int>{1, 2, 3, 4};
+        auto small = more_concepts::small_vector<int, 2>{0};
+        more_concepts::append_range(small, std::views::counted(list.begin(), 3));
+        MORE_CONCEPTS_CHECK((small == more_concepts::small_vector<int, 2>{0, 1, 2, 3}) and small.capacity() == 4);
+
+        more_concepts::append_range(small, move_only_input_range{2});
+        MORE_CONCEPTS_CHECK((small == more_concepts::small_vector<int, 2>{0, 1, 2, 3, 0, 1}));
+
+        // Appending small batches still grows the capacity geometrically.
+        auto batched = std::vector<int>{};
+        auto reallocations = 0;
+        for (auto batch = 0; batch < 1000; ++batch)
+        {
+            auto const capacity = batched.capacity();
+            more_concepts::append_range(batched, std::array{batch, batch});
+            reallocations += batched.capacity() != capacity ? 1 : 0;
+        }
+        MORE_CONCEPTS_CHECK(batched.size() == 2000 and reallocations <= 12);
+
+        auto hashed = std::unordered_set<int>{};
+        auto rehashes = 0;
+        for (auto batch = 0; batch < 100; ++batch)
+        {
+            auto const bucket_count = hashed.bucket_count();
+            more_concepts::append_range(hashed, std::views::iota(batch * 10, batch * 10 + 10));
+            rehashes += hashed.bucket_count() != bucket_count ? 1 : 0;
+        }
+        MORE_CONCEPTS_CHECK(hashed.size() == 1000 and rehashes <= 12);
+
+        auto ring = more_concepts::ring_deque<int>{};
+        more_concepts::append_range(ring, std::views::iota(0, 5));
+        MORE_CONCEPTS_CHECK(ring.size() == 5 and ring.capacity() == 8);
+
+        auto deque = std::deque<std::string>{"a"};
+        more_concepts::append_range(deque, std::array{"b", "c"});
+        MORE_CONCEPTS_CHECK((deque == std::deque<std::string>{"a", "b", "c"}));
+
+        auto const pairs = std::vector<std::pair<std::string, int>>{{"b", 2}, {"a", 1}, {"b", 3}};
+        auto map = std::map<std::string, int>{};
+        more_concepts::append_range(map, pairs);
+        MORE_CONCEPTS_CHECK(map.size() == 2 and map.at("b") == 2);
+
+        auto flat = more_concepts::flat_map<std::string, int>{};
+        more_concepts::append_range(flat, pairs);
+        MORE_CONCEPTS_CHECK(flat.size() == 2 and flat.at("a") == 1);
+    }
+
+    auto test_insert_range() -> void
+    {
+        auto vector = std::vector<int>{0, 5};
+        auto it = more_concepts::insert_range(vector, vector.cbegin() + 1, std::views::iota(1, 5));
+        MORE_CONCEPTS_CHECK((vector == std::vector<int>{0, 1, 2, 3, 4, 5}) and it == vector.begin() + 1);
+
+        auto const list = std::list<int>{7, 8};
+        it = more_concepts::insert_range(vector, vector.cend(), std::views::counted(list.begin(), 2));
+        MORE_CONCEPTS_CHECK(vector.size() == 8 and *it == 7);
+
+        it = more_concepts::insert_range(vector, vector.cbegin(), move_only_input_range{3});
+        MORE_CONCEPTS_CHECK((vector == std::vector<int>{0, 1, 2, 0, 1, 2, 3, 4, 5, 7, 8}) and it == vector.begin());
+
+        it = more_concepts::insert_range(vector, vector.cbegin() + 2, std::vector<int>{});
+        MORE_CONCEPTS_CHECK(vector.size() == 11 and it == vector.begin() + 2);
+
+        auto deque = std::deque<int>{1, 4};
+        auto const deque_it = more_concepts::insert_range(deque, deque.cbegin() + 1, std::array{2, 3});
+        MORE_CONCEPTS_CHECK((deque == std::deque<int>{1, 2, 3, 4}) and *deque_it == 2);
+
+        auto linked = std::list<int>{1, 4};
+        auto const list_it = more_concepts::insert_range(linked, std::next(linked.cbegin()), move_only_input_range{2});
+        MORE_CONCEPTS_CHECK((linked == std::list<int>{1, 0, 1, 4}) and *list_it == 0);
+    }
+
+    auto const bulk_algorithm_tests = more_concepts_tests::register_test_case{
+        "bulk_algorithms",
+        [] {
+            test_bulk_copy();
+            test_bulk_fill();
+            test_bulk_equal();
+            test_bulk_assign();
+            test_append_range();
+            test_insert_range();
+        }};
+}
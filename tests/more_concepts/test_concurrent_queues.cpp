@@ -0,0 +1,154 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "more_concepts/concurrent_containers.hpp"
+#include "more_concepts/concurrent_queues.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    static_assert(more_concepts::concurrent_queue_of<more_concepts::spsc_queue<int>, int>);
+    static_assert(more_concepts::concurrent_queue<more_concepts::spsc_queue<std::string, std::array<std::string, 16>>>);
+    static_assert(more_concepts::concurrent_queue<more_concepts::spsc_queue<std::unique_ptr<int>>>);
+    static_assert(more_concepts::concurrent_queue_of<more_concepts::mpmc_queue<int>, int>);
+    static_assert(more_concepts::concurrent_queue<
+        more_concepts::mpmc_queue<int, std::array<more_concepts::mpmc_queue_cell<int>, 16>>>);
+    static_assert(more_concepts::concurrent_queue<more_concepts::mpmc_queue<std::unique_ptr<int>>>);
+    static_assert(not more_concepts::concurrent_queue<std::deque<int>>);
+
+    template <typename Queue>
+    auto check_single_threaded(Queue& queue) -> void
+    {
+        auto value = 0;
+        MORE_CONCEPTS_CHECK(not queue.try_pop(value));
+        for (auto lap = 0; lap < 3; ++lap)
+        {
+            for (auto i = 0; i < static_cast<int>(queue.capacity()); ++i)
+            {
+                MORE_CONCEPTS_CHECK(queue.try_push(i));
+            }
+            MORE_CONCEPTS_CHECK(not queue.try_push(-1));
+            for (auto i = 0; i < static_cast<int>(queue.capacity()); ++i)
+            {
+                MORE_CONCEPTS_CHECK(queue.try_pop(value) and value == i);
+            }
+            MORE_CONCEPTS_CHECK(not queue.try_pop(value));
+            // Shift the positions, so that the next lap wraps around the storage.
+            MORE_CONCEPTS_CHECK(queue.try_push(lap) and queue.try_pop(value) and value == lap);
+        }
+    }
+
+    auto test_spsc_queue() -> void
+    {
+        auto fixed = more_concepts::spsc_queue<int, std::array<int, 5>>{};
+        MORE_CONCEPTS_CHECK(fixed.capacity() == 5);
+        check_single_threaded(fixed);
+
+        auto arena = std::pmr::monotonic_buffer_resource{};
+        auto adopted = more_concepts::spsc_queue<int, std::pmr::vector<int>>{std::pmr::vector<int>(3, &arena)};
+        MORE_CONCEPTS_CHECK(adopted.capacity() == 3);
+        check_single_threaded(adopted);
+
+        constexpr auto count = 100'000;
+        auto queue = more_concepts::spsc_queue<std::unique_ptr<int>>{64};
+        auto producer = std::thread{[&] {
+            for (auto i = 0; i < count; ++i)
+            {
+                auto value = std::make_unique<int>(i);
+                while (not queue.try_push(std::move(value)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }};
+
+        auto in_order = true;
+        for (auto i = 0; i < count; ++i)
+        {
+            auto value = std::unique_ptr<int>{};
+            while (not queue.try_pop(value))
+            {
+                std::this_thread::yield();
+            }
+            in_order = in_order and *value == i;
+        }
+        producer.join();
+        MORE_CONCEPTS_CHECK(in_order);
+    }
+
+    auto test_mpmc_queue() -> void
+    {
+        auto fixed = more_concepts::mpmc_queue<int, std::array<more_concepts::mpmc_queue_cell<int>, 8>>{};
+        MORE_CONCEPTS_CHECK(fixed.capacity() == 8);
+        check_single_threaded(fixed);
+
+        auto thrown = false;
+        try
+        {
+            static_cast<void>(more_concepts::mpmc_queue<int>{6});
+        }
+        catch (std::invalid_argument const&)
+        {
+            thrown = true;
+        }
+        MORE_CONCEPTS_CHECK(thrown);
+
+        constexpr auto threads = 4;
+        constexpr auto count_per_producer = 25'000;
+        auto queue = more_concepts::mpmc_queue<int>{32};
+        auto sum = std::atomic<long long>{0};
+        auto popped = std::atomic<int>{0};
+
+        auto workers = std::vector<std::thread>{};
+        for (auto t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t] {
+                for (auto i = 0; i < count_per_producer; ++i)
+                {
+                    while (not queue.try_push(t * count_per_producer + i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+            workers.emplace_back([&] {
+                auto value = 0;
+                while (popped.load() < threads * count_per_producer)
+                {
+                    if (queue.try_pop(value))
+                    {
+                        sum += value;
+                        ++popped;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        constexpr auto total = static_cast<long long>(threads) * count_per_producer;
+        MORE_CONCEPTS_CHECK(popped.load() == total and sum.load() == total * (total - 1) / 2);
+    }
+
+    auto const concurrent_queue_tests = more_concepts_tests::register_test_case{
+        "concurrent_queues",
+        [] {
+            test_spsc_queue();
+            test_mpmc_queue();
+        }};
+}
@@ -0,0 +1,91 @@
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "more_concepts/associative_containers.hpp"
+#include "more_concepts/base_containers.hpp"
+#include "more_concepts/container_category.hpp"
+#include "more_concepts/sequence_containers.hpp"
+
+namespace
+{
+    using test_value_type = int;
+    using test_key_type = std::string;
+
+    using test_vector = std::vector<test_value_type>;
+    using test_map = std::map<test_key_type, test_value_type>;
+
+    /// Does not provide any of the container requirements besides the ones checked by
+    /// the lite concepts; satisfies the full concepts only through its declaration.
+    struct declared_vector
+    {
+        using value_type = test_value_type;
+        using reference = value_type&;
+        using const_reference = value_type const&;
+        using size_type = std::size_t;
+        using iterator = value_type*;
+        using const_iterator = value_type const*;
+
+        auto begin() -> iterator;
+        auto end() -> iterator;
+        auto begin() const -> const_iterator;
+        auto end() const -> const_iterator;
+        auto size() const -> size_type;
+        auto front() -> reference;
+        auto back() -> reference;
+        auto operator[](size_type) -> reference;
+        auto data() -> value_type*;
+        auto pop_back() -> void;
+        auto push_back(value_type&&) -> void;
+    };
+
+    struct undeclared_vector : declared_vector
+    {
+    };
+}
+
+template <>
+inline constexpr auto more_concepts::enable_container_category<declared_vector>
+    = more_concepts::container_category::contiguous_container |
+      more_concepts::container_category::back_growable_container |
+      more_concepts::container_category::reservable_container;
+
+template <>
+inline constexpr auto more_concepts::enable_container_category<test_vector>
+    = more_concepts::container_category::contiguous_container |
+      more_concepts::container_category::inplace_constructing_sequence_container |
+      more_concepts::container_category::inplace_back_constructing_container;
+
+template <>
+inline constexpr auto more_concepts::enable_container_category<test_map>
+    = more_concepts::container_category::ordered_unique_map_container |
+      more_concepts::container_category::ordered_unique_associative_container;
+
+// Declared concepts, and all the concepts they refine, are satisfied.
+static_assert(more_concepts::container<declared_vector>);
+static_assert(more_concepts::sequence_container<declared_vector>);
+static_assert(more_concepts::double_ended_container<declared_vector>);
+static_assert(more_concepts::random_access_container<declared_vector>);
+static_assert(more_concepts::contiguous_container_of<declared_vector, test_value_type>);
+static_assert(more_concepts::back_growable_container<declared_vector>);
+static_assert(more_concepts::reservable_container<declared_vector>);
+
+// Concepts that were not declared are still checked.
+static_assert(not more_concepts::clearable_container<declared_vector>);
+static_assert(not more_concepts::resizable_sequence_container<declared_vector>);
+static_assert(not more_concepts::front_growable_container<declared_vector>);
+
+// Declarations are not inherited.
+static_assert(not more_concepts::container<undeclared_vector>);
+static_assert(not more_concepts::contiguous_container<undeclared_vector>);
+
+// Declared standard containers.
+static_assert(more_concepts::contiguous_container<test_vector>);
+static_assert(more_concepts::inplace_constructing_sequence_container<test_vector>);
+static_assert(more_concepts::inplace_back_constructing_container<test_vector>);
+static_assert(not more_concepts::front_growable_container<test_vector>);
+
+static_assert(more_concepts::ordered_unique_map_container_of<test_map, test_key_type, test_value_type>);
+static_assert(more_concepts::ordered_unique_associative_container<test_map>);
+static_assert(not more_concepts::unordered_associative_container<test_map>);
@@ -0,0 +1,52 @@
+// Correct declarations must be accepted in verification mode.
+// Built as a separate target (see tests/CMakeLists.txt), which defines MORE_CONCEPTS_VERIFY_CONTAINER_CATEGORY.
+#ifndef MORE_CONCEPTS_VERIFY_CONTAINER_CATEGORY
+#error "MORE_CONCEPTS_VERIFY_CONTAINER_CATEGORY must be defined for the whole target"
+#endif
+
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "more_concepts/associative_containers.hpp"
+#include "more_concepts/container_category.hpp"
+#include "more_concepts/sequence_containers.hpp"
+
+namespace
+{
+    using test_value_type = int;
+
+    using test_deque = std::deque<test_value_type>;
+    using test_vector = std::vector<test_value_type>;
+    using test_unordered_map = std::unordered_map<test_value_type, test_value_type>;
+}
+
+template <>
+inline constexpr auto more_concepts::enable_container_category<test_deque>
+    = more_concepts::container_category::random_access_container |
+      more_concepts::container_category::inplace_constructing_sequence_container |
+      more_concepts::container_category::inplace_front_constructing_container |
+      more_concepts::container_category::inplace_back_constructing_container;
+
+template <>
+inline constexpr auto more_concepts::enable_container_category<test_vector>
+    = more_concepts::container_category::contiguous_container |
+      more_concepts::container_category::reservable_container;
+
+template <>
+inline constexpr auto more_concepts::enable_container_category<test_unordered_map>
+    = more_concepts::container_category::unordered_unique_map_container;
+
+static_assert(more_concepts::random_access_container<test_deque>);
+static_assert(more_concepts::inplace_constructing_sequence_container<test_deque>);
+static_assert(more_concepts::inplace_front_constructing_container<test_deque>);
+static_assert(more_concepts::inplace_back_constructing_container<test_deque>);
+static_assert(not more_concepts::contiguous_container<test_deque>);
+static_assert(not more_concepts::reservable_container<test_deque>);
+
+static_assert(more_concepts::contiguous_container<test_vector>);
+static_assert(more_concepts::reservable_container<test_vector>);
+
+static_assert(more_concepts::read_only_associative_container<test_unordered_map>);
+static_assert(more_concepts::unordered_unique_map_container<test_unordered_map>);
+static_assert(not more_concepts::ordered_associative_container<test_unordered_map>);
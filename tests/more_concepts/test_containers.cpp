@@ -1,17 +1,31 @@
 #include <array>
+#include <cstddef>
 #include <deque>
 #include <forward_list>
+#include <functional>
 #include <list>
 #include <map>
+#include <memory_resource>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "more_concepts/associative_containers.hpp"
 #include "more_concepts/base_containers.hpp"
+#include "more_concepts/flat_hash_map.hpp"
+#include "more_concepts/btree_map.hpp"
+#include "more_concepts/btree_set.hpp"
+#include "more_concepts/flat_map.hpp"
+#include "more_concepts/flat_set.hpp"
+#include "more_concepts/inplace_vector.hpp"
+#include "more_concepts/lite_containers.hpp"
+#include "more_concepts/ring_deque.hpp"
 #include "more_concepts/sequence_containers.hpp"
+#include "more_concepts/small_vector.hpp"
 
 namespace
 {
@@ -19,6 +33,7 @@ namespace
     struct require_containers
     {
         static_assert((more_concepts::container<Ts> and ...));
+        static_assert((more_concepts::lite::container<Ts> and ...));
         static_assert((more_concepts::container_of<Ts, ValueType> and ...));
     };
 
@@ -33,6 +48,7 @@ namespace
     struct require_sized_containers : require_containers<ValueType, Ts...>
     {
         static_assert((more_concepts::sized_container<Ts> and ...));
+        static_assert((more_concepts::lite::sized_container<Ts> and ...));
         static_assert((more_concepts::sized_container_of<Ts, ValueType> and ...));
     };
 
@@ -50,10 +66,18 @@ namespace
         static_assert((more_concepts::reversible_container_of<Ts, ValueType> and ...));
     };
 
+    template <typename ValueType, typename... Ts>
+    struct require_allocator_aware_containers : require_containers<ValueType, Ts...>
+    {
+        static_assert((more_concepts::allocator_aware_container<Ts> and ...));
+        static_assert((more_concepts::allocator_aware_container_of<Ts, ValueType> and ...));
+    };
+
     template <typename ValueType, typename... Ts>
     struct require_mutable_sequence_containers : require_mutable_containers<ValueType, Ts...>
     {
         static_assert((more_concepts::sequence_container<Ts> and ...));
+        static_assert((more_concepts::lite::sequence_container<Ts> and ...));
         static_assert((more_concepts::sequence_container_of<Ts, ValueType> and ...));
     };
 
@@ -71,8 +95,10 @@ namespace
     struct require_contiguous_random_access_containers : require_double_ended_containers<ValueType, Ts...>
     {
         static_assert((more_concepts::contiguous_container<Ts> and ...));
+        static_assert((more_concepts::lite::contiguous_container<Ts> and ...));
         static_assert((more_concepts::contiguous_container_of<Ts, ValueType> and ...));
         static_assert((more_concepts::random_access_container<Ts> and ...));
+        static_assert((more_concepts::lite::random_access_container<Ts> and ...));
         static_assert((more_concepts::random_access_container_of<Ts, ValueType> and ...));
     };
 
@@ -111,6 +137,7 @@ namespace
     struct require_back_growable_containers : require_double_ended_containers<ValueType, Ts...>
     {
         static_assert((more_concepts::back_growable_container<Ts> and ...));
+        static_assert((more_concepts::lite::back_growable_container<Ts> and ...));
         static_assert((more_concepts::back_growable_container_of<Ts, ValueType> and ...));
     };
 
@@ -127,18 +154,26 @@ namespace
           require_clearable_containers<ValueType, Ts...>
     {
         static_assert((more_concepts::associative_container<Ts> and ...));
+        static_assert((more_concepts::lite::associative_container<Ts> and ...));
         static_assert((more_concepts::associative_container_of<Ts, ValueType, KeyType> and ...));
     };
 
     template <typename ValueType, typename KeyType, typename... Ts>
-    struct require_unique_associative_containers : require_associative_containers<ValueType, Ts...>
+    struct require_node_extractable_containers : require_associative_containers<ValueType, KeyType, Ts...>
+    {
+        static_assert((more_concepts::node_extractable_container<Ts> and ...));
+        static_assert((more_concepts::node_extractable_container_of<Ts, ValueType, KeyType> and ...));
+    };
+
+    template <typename ValueType, typename KeyType, typename... Ts>
+    struct require_unique_associative_containers : require_associative_containers<ValueType, KeyType, Ts...>
     {
         static_assert((more_concepts::unique_associative_container<Ts> and ...));
         static_assert((more_concepts::unique_associative_container_of<Ts, ValueType, KeyType> and ...));
     };
 
     template <typename ValueType, typename KeyType, typename... Ts>
-    struct require_multiple_associative_containers : require_associative_containers<ValueType, Ts...>
+    struct require_multiple_associative_containers : require_associative_containers<ValueType, KeyType, Ts...>
     {
         static_assert((more_concepts::multiple_associative_container<Ts> and ...));
         static_assert((more_concepts::multiple_associative_container_of<Ts, ValueType, KeyType> and ...));
@@ -148,18 +183,19 @@ namespace
     struct require_ordered_associative_containers : require_associative_containers<ValueType, KeyType, Ts...>
     {
         static_assert((more_concepts::ordered_associative_container<Ts> and ...));
+        static_assert((more_concepts::lite::ordered_associative_container<Ts> and ...));
         static_assert((more_concepts::ordered_associative_container_of<Ts, ValueType, KeyType> and ...));
     };
 
     template <typename ValueType, typename KeyType, typename... Ts>
-    struct require_ordered_unique_associative_containers : require_ordered_associative_containers<ValueType, Ts...>
+    struct require_ordered_unique_associative_containers : require_ordered_associative_containers<ValueType, KeyType, Ts...>
     {
         static_assert((more_concepts::ordered_unique_associative_container<Ts> and ...));
         static_assert((more_concepts::ordered_unique_associative_container_of<Ts, ValueType, KeyType> and ...));
     };
 
     template <typename ValueType, typename KeyType, typename... Ts>
-    struct require_ordered_multiple_associative_containers : require_ordered_associative_containers<ValueType, Ts...>
+    struct require_ordered_multiple_associative_containers : require_ordered_associative_containers<ValueType, KeyType, Ts...>
     {
         static_assert((more_concepts::ordered_multiple_associative_container<Ts> and ...));
         static_assert((more_concepts::ordered_multiple_associative_container_of<Ts, ValueType, KeyType> and ...));
@@ -169,11 +205,12 @@ namespace
     struct require_unordered_associative_containers : require_associative_containers<ValueType, KeyType, Ts...>
     {
         static_assert((more_concepts::unordered_associative_container<Ts> and ...));
+        static_assert((more_concepts::lite::unordered_associative_container<Ts> and ...));
         static_assert((more_concepts::unordered_associative_container_of<Ts, ValueType, KeyType> and ...));
     };
 
     template <typename ValueType, typename KeyType, typename... Ts>
-    struct require_unordered_unique_associative_containers : require_unordered_associative_containers<ValueType, Ts...>
+    struct require_unordered_unique_associative_containers : require_unordered_associative_containers<ValueType, KeyType, Ts...>
     {
         static_assert((more_concepts::unordered_unique_associative_container<Ts> and ...));
         static_assert((more_concepts::unordered_unique_associative_container_of<Ts, ValueType, KeyType> and ...));
@@ -181,7 +218,7 @@ namespace
 
     template <typename ValueType, typename KeyType, typename... Ts>
     struct require_unordered_multiple_associative_containers
-        : require_unordered_associative_containers<ValueType, Ts...>
+        : require_unordered_associative_containers<ValueType, KeyType, Ts...>
     {
         static_assert((more_concepts::unordered_multiple_associative_container<Ts> and ...));
         static_assert((more_concepts::unordered_multiple_associative_container_of<Ts, ValueType, KeyType> and ...));
@@ -191,6 +228,7 @@ namespace
     struct require_map_containers : require_associative_containers<ValueType, KeyType, Ts...>
     {
         static_assert((more_concepts::map_container<Ts> and ...));
+        static_assert((more_concepts::lite::map_container<Ts> and ...));
         static_assert((more_concepts::map_container_of<Ts, KeyType, MappedType> and ...));
     };
 
@@ -200,6 +238,7 @@ namespace
           require_unique_associative_containers<ValueType, KeyType, Ts...>
     {
         static_assert((more_concepts::unique_map_container<Ts> and ...));
+        static_assert((more_concepts::lite::unique_map_container<Ts> and ...));
         static_assert((more_concepts::unique_map_container_of<Ts, KeyType, MappedType> and ...));
     };
 
@@ -277,13 +316,18 @@ namespace
     using test_deque = std::deque<test_value_type>;
     using test_list = std::list<test_value_type>;
     using test_forward_list = std::forward_list<test_value_type>;
+    using test_small_vector = more_concepts::small_vector<test_value_type, 4>;
+    using test_inplace_vector = more_concepts::inplace_vector<test_value_type, 4>;
+    using test_ring_deque = more_concepts::ring_deque<test_value_type>;
 
     constexpr auto contiguous_random_access = require_contiguous_random_access_containers<
         test_value_type,
 
         test_array,
         test_vector,
-        test_string>{};
+        test_string,
+        test_small_vector,
+        test_inplace_vector>{};
 
     constexpr auto clearable = require_clearable_containers<
         test_value_type,
@@ -291,8 +335,11 @@ namespace
         test_vector,
         test_string,
         test_deque,
+        test_ring_deque,
         test_list,
-        test_forward_list>{};
+        test_forward_list,
+        test_small_vector,
+        test_inplace_vector>{};
 
     constexpr auto double_ended = require_double_ended_containers<
         test_value_type,
@@ -301,7 +348,10 @@ namespace
         test_vector,
         test_string,
         test_deque,
-        test_list>{};
+        test_ring_deque,
+        test_list,
+        test_small_vector,
+        test_inplace_vector>{};
 
     constexpr auto resizable = require_resizable_containers<
         test_value_type,
@@ -309,19 +359,26 @@ namespace
         test_vector,
         test_string,
         test_deque,
-        test_list>{};
+        test_ring_deque,
+        test_list,
+        test_small_vector,
+        test_inplace_vector>{};
 
     constexpr auto inplace_constructing = require_inplace_constructing_resizable_containers<
         test_value_type,
 
         test_vector,
         test_deque,
-        test_list>{};
+        test_ring_deque,
+        test_list,
+        test_small_vector,
+        test_inplace_vector>{};
 
     constexpr auto front_growable = require_front_growable_containers<
         test_value_type,
 
         test_deque,
+        test_ring_deque,
         test_list,
         test_forward_list>{};
 
@@ -329,6 +386,7 @@ namespace
         test_value_type,
 
         test_deque,
+        test_ring_deque,
         test_list,
         test_forward_list>{};
 
@@ -338,14 +396,33 @@ namespace
         test_vector,
         test_string,
         test_deque,
-        test_list>{};
+        test_ring_deque,
+        test_list,
+        test_small_vector,
+        test_inplace_vector>{};
 
     constexpr auto inplace_back_constructing = require_inplace_back_constructing_containers<
         test_value_type,
 
         test_vector,
         test_deque,
-        test_list>{};
+        test_ring_deque,
+        test_list,
+        test_small_vector,
+        test_inplace_vector>{};
+
+    constexpr auto allocator_aware_sequences = require_allocator_aware_containers<
+        test_value_type,
+
+        test_vector,
+        test_string,
+        test_deque,
+        test_ring_deque,
+        test_list,
+        test_forward_list,
+        test_small_vector,
+        std::pmr::vector<test_value_type>,
+        std::pmr::deque<test_value_type>>{};
 
 
     // Associative containers
@@ -361,18 +438,33 @@ namespace
     using test_multimap = std::multimap<test_key_type, test_value_type>;
     using test_unordered_map = std::unordered_map<test_key_type, test_value_type>;
     using test_unordered_multimap = std::unordered_multimap<test_key_type, test_value_type>;
+    using test_flat_set = more_concepts::flat_set<test_key_type>;
+    using test_deque_flat_set = more_concepts::flat_set<test_key_type, std::greater<>, std::deque<test_key_type>>;
+    using test_pair_kv_type = std::pair<test_key_type, test_value_type>;
+    using test_flat_map = more_concepts::flat_map<test_key_type, test_value_type>;
+    using test_deque_flat_map = more_concepts::flat_map<
+        test_key_type, test_value_type, std::greater<>, std::deque<test_pair_kv_type>>;
+    using test_flat_hash_map = more_concepts::flat_hash_map<test_key_type, test_value_type>;
+    using test_btree_set = more_concepts::btree_set<test_key_type>;
+    using test_btree_multiset = more_concepts::btree_multiset<test_key_type>;
+    using test_btree_map = more_concepts::btree_map<test_key_type, test_value_type>;
+    using test_btree_multimap = more_concepts::btree_multimap<test_key_type, test_value_type>;
 
     constexpr auto ordered_unique_sets = require_ordered_unique_associative_containers<
         test_key_type,
         test_key_type,
 
-        test_set>{};
+        test_set,
+        test_flat_set,
+        test_deque_flat_set,
+        test_btree_set>{};
     
     constexpr auto ordered_multiple_sets = require_ordered_multiple_associative_containers<
         test_key_type,
         test_key_type,
 
-        test_multiset>{};
+        test_multiset,
+        test_btree_multiset>{};
 
     constexpr auto unordered_unique_sets = require_unordered_unique_associative_containers<
         test_key_type,
@@ -393,6 +485,29 @@ namespace
 
         test_map>{};
 
+    // Flat maps and B-tree maps store pair<Key, T>, as their elements are moved around on insertion
+    // and erasure (within the flat storage, or between the nodes of the B-tree).
+    constexpr auto ordered_unique_pair_maps = require_ordered_unique_map_containers<
+        test_pair_kv_type,
+        test_key_type,
+        test_value_type,
+
+        test_flat_map,
+        test_deque_flat_map,
+        test_btree_map>{};
+
+    constexpr auto ordered_multiple_pair_maps = require_ordered_multiple_map_containers<
+        test_pair_kv_type,
+        test_key_type,
+        test_value_type,
+
+        test_btree_multimap>{};
+
+    static_assert(more_concepts::mutable_container<test_flat_map>);
+    static_assert(not more_concepts::mutable_container<test_flat_set>);
+    static_assert(more_concepts::mutable_container<test_btree_map>);
+    static_assert(not more_concepts::mutable_container<test_btree_set>);
+
     constexpr auto ordered_multiple_maps = require_ordered_multiple_map_containers<
         test_kv_type,
         test_key_type,
@@ -405,7 +520,8 @@ namespace
         test_key_type,
         test_value_type,
 
-        test_unordered_map>{};
+        test_unordered_map,
+        test_flat_hash_map>{};
 
     constexpr auto unordered_multiple_maps = require_unordered_multiple_map_containers<
         test_kv_type,
@@ -413,4 +529,98 @@ namespace
         test_value_type,
 
         test_unordered_multimap>{};
+
+    constexpr auto allocator_aware_maps = require_allocator_aware_containers<
+        test_kv_type,
+
+        test_map,
+        test_multimap,
+        test_unordered_map,
+        test_unordered_multimap,
+        test_flat_hash_map,
+        std::pmr::map<test_key_type, test_value_type>,
+        std::pmr::unordered_map<test_key_type, test_value_type>>{};
+
+    constexpr auto allocator_aware_flat_maps = require_allocator_aware_containers<
+        test_pair_kv_type,
+
+        test_btree_map,
+        test_btree_multimap>{};
+
+    constexpr auto allocator_aware_sets = require_allocator_aware_containers<
+        test_key_type,
+
+        test_btree_set,
+        test_btree_multiset>{};
+
+    constexpr auto node_extractable_sets = require_node_extractable_containers<
+        test_key_type,
+        test_key_type,
+
+        test_set,
+        test_multiset,
+        test_unordered_set,
+        test_unordered_multiset>{};
+
+    constexpr auto node_extractable_maps = require_node_extractable_containers<
+        test_kv_type,
+        test_key_type,
+
+        test_map,
+        test_multimap,
+        test_unordered_map,
+        test_unordered_multimap>{};
+
+    static_assert(not more_concepts::node_extractable_container<test_flat_set>);
+    static_assert(not more_concepts::node_extractable_container<test_flat_map>);
+    static_assert(not more_concepts::node_extractable_container<test_flat_hash_map>);
+    static_assert(not more_concepts::node_extractable_container<test_btree_map>);
+
+    // Lite concepts
+
+    // The full concepts must subsume the lite ones, so that overloads order correctly.
+    template <int overload>
+    using lite_overload_result = std::integral_constant<int, overload>;
+
+    auto lite_overload(more_concepts::lite::container auto const&) -> lite_overload_result<0>;
+    auto lite_overload(more_concepts::container auto const&) -> lite_overload_result<1>;
+    auto lite_overload(more_concepts::lite::unique_map_container auto const&) -> lite_overload_result<2>;
+    auto lite_overload(more_concepts::unique_map_container auto const&) -> lite_overload_result<3>;
+
+    template <typename C>
+    constexpr auto selected_lite_overload = decltype(lite_overload(std::declval<C const&>()))::value;
+
+    static_assert(selected_lite_overload<test_vector> == 1);
+    static_assert(selected_lite_overload<test_map> == 3);
+
+    // Lite concepts do not check the full requirement sets.
+    struct lite_only_map
+    {
+        using value_type = test_kv_type;
+        using reference = value_type&;
+        using const_reference = value_type const&;
+        using size_type = std::size_t;
+        using iterator = value_type*;
+        using const_iterator = value_type const*;
+        using key_type = test_key_type;
+        using mapped_type = test_value_type;
+
+        auto begin() -> iterator;
+        auto end() -> iterator;
+        auto begin() const -> const_iterator;
+        auto end() const -> const_iterator;
+        auto size() const -> size_type;
+        auto contains(key_type const&) const -> bool;
+        auto find(key_type const&) -> iterator;
+        auto find(key_type const&) const -> const_iterator;
+        auto erase(key_type const&) -> size_type;
+        auto at(key_type const&) -> mapped_type&;
+        auto at(key_type const&) const -> mapped_type const&;
+        auto operator[](key_type const&) -> mapped_type&;
+        auto insert_or_assign(key_type const&, mapped_type const&) -> std::pair<iterator, bool>;
+    };
+
+    static_assert(more_concepts::lite::unique_map_container<lite_only_map>);
+    static_assert(not more_concepts::unique_map_container<lite_only_map>);
+    static_assert(selected_lite_overload<lite_only_map> == 2);
 }
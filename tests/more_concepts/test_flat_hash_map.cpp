@@ -0,0 +1,226 @@
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include "more_concepts/flat_hash_map.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    using string_map = more_concepts::flat_hash_map<std::string, int>;
+
+    /// Sends every key to the same few buckets, to exercise long probe sequences.
+    struct colliding_hash
+    {
+        auto operator()(int const key) const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(key % 4);
+        }
+    };
+
+    auto test_flat_hash_map_lookup() -> void
+    {
+        auto const map = string_map{{"a", 1}, {"b", 2}, {"c", 3}, {"a", 4}};
+        MORE_CONCEPTS_CHECK(map.size() == 3);
+        MORE_CONCEPTS_CHECK(map.at("a") == 1);
+        MORE_CONCEPTS_CHECK(map.find("c")->second == 3);
+        MORE_CONCEPTS_CHECK(map.find("d") == map.end());
+        MORE_CONCEPTS_CHECK(map.contains("b") and not map.contains("d"));
+        MORE_CONCEPTS_CHECK(map.count("a") == 1 and map.count("x") == 0);
+
+        auto const [first, last] = map.equal_range("b");
+        MORE_CONCEPTS_CHECK(first->first == "b" and std::next(first) == last);
+        auto const [empty_first, empty_last] = map.equal_range("d");
+        MORE_CONCEPTS_CHECK(empty_first == map.end() and empty_last == map.end());
+
+        auto thrown = false;
+        try
+        {
+            static_cast<void>(map.at("x"));
+        }
+        catch (std::out_of_range const&)
+        {
+            thrown = true;
+        }
+        MORE_CONCEPTS_CHECK(thrown);
+
+        auto const empty = string_map{};
+        MORE_CONCEPTS_CHECK(empty.begin() == empty.end() and empty.find("a") == empty.end());
+        MORE_CONCEPTS_CHECK(empty.bucket_count() == 0 and empty.load_factor() == 0.0f);
+    }
+
+    auto test_flat_hash_map_insertion() -> void
+    {
+        auto map = string_map{};
+        MORE_CONCEPTS_CHECK(map.insert({"b", 2}).second);
+        MORE_CONCEPTS_CHECK(not map.insert({"b", 3}).second);
+        MORE_CONCEPTS_CHECK(map.emplace("a", 1).second);
+        MORE_CONCEPTS_CHECK(not map.emplace(std::string{"a"}, 5).second);
+        MORE_CONCEPTS_CHECK(
+            map.emplace(std::piecewise_construct, std::forward_as_tuple("c"), std::forward_as_tuple(3)).second);
+        MORE_CONCEPTS_CHECK(map.emplace_hint(map.end(), "d", 4)->second == 4);
+        MORE_CONCEPTS_CHECK(map.at("b") == 2 and map.at("a") == 1);
+
+        MORE_CONCEPTS_CHECK(not map.try_emplace("a", 10).second);
+        MORE_CONCEPTS_CHECK(map.try_emplace(map.end(), "e", 5)->second == 5);
+        MORE_CONCEPTS_CHECK(not map.insert_or_assign("a", 11).second);
+        MORE_CONCEPTS_CHECK(map.at("a") == 11);
+        MORE_CONCEPTS_CHECK(map.insert_or_assign("f", 6).second);
+
+        map["g"] = 7;
+        ++map["g"];
+        MORE_CONCEPTS_CHECK(map.at("g") == 8);
+        MORE_CONCEPTS_CHECK(map.size() == 7);
+
+        // try_emplace does not move from the key if it is already present.
+        auto key = std::string{"a"};
+        map.try_emplace(std::move(key), 0);
+        MORE_CONCEPTS_CHECK(key == "a");
+
+        auto sum = 0;
+        for (auto const& [element_key, value] : map)
+        {
+            sum += value;
+        }
+        MORE_CONCEPTS_CHECK(sum == 11 + 2 + 3 + 4 + 5 + 6 + 8);
+    }
+
+    auto test_flat_hash_map_erasure() -> void
+    {
+        auto map = string_map{{"a", 1}, {"b", 2}, {"c", 3}, {"d", 4}};
+        MORE_CONCEPTS_CHECK(map.erase("b") == 1);
+        MORE_CONCEPTS_CHECK(map.erase("b") == 0);
+        MORE_CONCEPTS_CHECK(map.size() == 3 and not map.contains("b"));
+
+        // Erasing while iterating visits every other element once.
+        auto visited = 0;
+        for (auto it = map.begin(); it != map.end();)
+        {
+            ++visited;
+            it = it->second % 2 == 1 ? map.erase(it) : std::next(it);
+        }
+        MORE_CONCEPTS_CHECK(visited == 3 and map.size() == 1 and map.at("d") == 4);
+
+        map.erase(map.cbegin(), map.cend());
+        MORE_CONCEPTS_CHECK(map.empty());
+
+        map = {{"x", 1}};
+        auto const buckets = map.bucket_count();
+        map.clear();
+        MORE_CONCEPTS_CHECK(map.empty() and map.bucket_count() == buckets);
+    }
+
+    auto test_flat_hash_map_hash_policy() -> void
+    {
+        auto map = more_concepts::flat_hash_map<int, int>{};
+        map.reserve(100);
+        auto const buckets = map.bucket_count();
+        MORE_CONCEPTS_CHECK(buckets >= 100);
+        for (auto i = 0; i < 100; ++i)
+        {
+            map.emplace(i, i);
+        }
+        MORE_CONCEPTS_CHECK(map.bucket_count() == buckets);
+        MORE_CONCEPTS_CHECK(map.load_factor() <= map.max_load_factor());
+
+        map.max_load_factor(0.5f);
+        MORE_CONCEPTS_CHECK(map.max_load_factor() == 0.5f and map.load_factor() <= 0.5f);
+        map.max_load_factor(2.0f);
+        MORE_CONCEPTS_CHECK(map.max_load_factor() == 0.875f);
+
+        map.rehash(1000);
+        MORE_CONCEPTS_CHECK(map.bucket_count() >= 1000);
+        map.rehash(0);
+        MORE_CONCEPTS_CHECK(map.bucket_count() < 1000 and map.size() == 100);
+        for (auto i = 0; i < 100; ++i)
+        {
+            MORE_CONCEPTS_CHECK(map.at(i) == i);
+        }
+
+        map.clear();
+        map.rehash(0);
+        MORE_CONCEPTS_CHECK(map.bucket_count() == 0);
+    }
+
+    auto test_flat_hash_map_against_std() -> void
+    {
+        // Interleaved insertion and erasure, so that tables fill up with deleted slots,
+        // with good and with colliding hashes.
+        auto map = more_concepts::flat_hash_map<int, int>{};
+        auto colliding = more_concepts::flat_hash_map<int, int, colliding_hash>{};
+        auto reference = std::unordered_map<int, int>{};
+
+        auto state = 12345u;
+        for (auto i = 0; i < 20000; ++i)
+        {
+            state = state * 1103515245u + 12345u;
+            auto const key = static_cast<int>((state >> 8u) % 1000u);
+            if (state % 3u == 0)
+            {
+                auto const erased = reference.erase(key);
+                MORE_CONCEPTS_CHECK(map.erase(key) == erased);
+                MORE_CONCEPTS_CHECK(colliding.erase(key) == erased);
+            }
+            else
+            {
+                auto const inserted = reference.emplace(key, i).second;
+                MORE_CONCEPTS_CHECK(map.emplace(key, i).second == inserted);
+                MORE_CONCEPTS_CHECK(colliding.emplace(key, i).second == inserted);
+            }
+        }
+
+        MORE_CONCEPTS_CHECK(map.size() == reference.size() and colliding.size() == reference.size());
+        auto iterated = std::size_t{0};
+        for (auto const& [key, value] : map)
+        {
+            ++iterated;
+            MORE_CONCEPTS_CHECK(reference.at(key) == value);
+            MORE_CONCEPTS_CHECK(colliding.at(key) == value);
+        }
+        MORE_CONCEPTS_CHECK(iterated == reference.size());
+        MORE_CONCEPTS_CHECK(static_cast<std::size_t>(std::distance(colliding.begin(), colliding.end())) == iterated);
+    }
+
+    auto test_flat_hash_map_copy_and_move() -> void
+    {
+        auto map = more_concepts::flat_hash_map<int, std::unique_ptr<int>>{};
+        for (auto i = 0; i < 50; ++i)
+        {
+            map.emplace(i, std::make_unique<int>(i));
+        }
+
+        auto moved = std::move(map);
+        MORE_CONCEPTS_CHECK(map.empty() and moved.size() == 50 and *moved.at(7) == 7);
+        map = std::move(moved);
+        MORE_CONCEPTS_CHECK(map.size() == 50 and *map.at(49) == 49);
+
+        auto const lhs = string_map{{"a", 1}, {"b", 2}};
+        auto copy = lhs;
+        MORE_CONCEPTS_CHECK(copy == lhs);
+        copy["c"] = 3;
+        MORE_CONCEPTS_CHECK(copy != lhs);
+        copy = lhs;
+        MORE_CONCEPTS_CHECK(copy == (string_map{{"b", 2}, {"a", 1}}));
+        MORE_CONCEPTS_CHECK(copy != (string_map{{"b", 2}, {"a", 0}}));
+
+        auto other = string_map{};
+        swap(copy, other);
+        MORE_CONCEPTS_CHECK(copy.empty() and other.size() == 2);
+    }
+
+    auto const flat_hash_map_tests = more_concepts_tests::register_test_case{
+        "flat_hash_map",
+        [] {
+            test_flat_hash_map_lookup();
+            test_flat_hash_map_insertion();
+            test_flat_hash_map_erasure();
+            test_flat_hash_map_hash_policy();
+            test_flat_hash_map_against_std();
+            test_flat_hash_map_copy_and_move();
+        }};
+}
@@ -0,0 +1,160 @@
+#include <deque>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "more_concepts/flat_map.hpp"
+#include "more_concepts/flat_set.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    using string_map = more_concepts::flat_map<std::string, int>;
+
+    auto test_flat_map_construction() -> void
+    {
+        // Unsorted input is sorted, and the first of multiple equivalent keys is kept.
+        auto const map = string_map{{"b", 2}, {"a", 1}, {"c", 3}, {"a", 4}};
+        MORE_CONCEPTS_CHECK(map.size() == 3);
+        MORE_CONCEPTS_CHECK(map.begin()->first == "a");
+        MORE_CONCEPTS_CHECK(map.at("a") == 1);
+        MORE_CONCEPTS_CHECK(std::prev(map.end())->first == "c");
+
+        auto storage = std::vector<std::pair<std::string, int>>{{"y", 1}, {"x", 2}, {"y", 3}};
+        auto const adopted = string_map(std::move(storage));
+        MORE_CONCEPTS_CHECK((adopted.sequence() == std::vector<std::pair<std::string, int>>{{"x", 2}, {"y", 1}}));
+
+        auto const descending = more_concepts::flat_map<int, int, std::greater<>>{{1, 1}, {3, 3}, {2, 2}};
+        MORE_CONCEPTS_CHECK(descending.begin()->first == 3);
+        MORE_CONCEPTS_CHECK(descending.lower_bound(2)->first == 2);
+        MORE_CONCEPTS_CHECK(descending.upper_bound(2)->first == 1);
+    }
+
+    auto test_flat_map_lookup() -> void
+    {
+        auto map = string_map{{"a", 1}, {"c", 3}, {"e", 5}};
+        MORE_CONCEPTS_CHECK(map.find("c")->second == 3);
+        MORE_CONCEPTS_CHECK(map.find("d") == map.end());
+        MORE_CONCEPTS_CHECK(map.contains("e"));
+        MORE_CONCEPTS_CHECK(map.count("b") == 0);
+        MORE_CONCEPTS_CHECK(map.lower_bound("b")->first == "c");
+        MORE_CONCEPTS_CHECK(map.upper_bound("c")->first == "e");
+
+        auto const [first, last] = map.equal_range("c");
+        MORE_CONCEPTS_CHECK(first->first == "c" and last->first == "e");
+        auto const [empty_first, empty_last] = map.equal_range("d");
+        MORE_CONCEPTS_CHECK(empty_first == empty_last);
+
+        auto thrown = false;
+        try
+        {
+            static_cast<void>(map.at("x"));
+        }
+        catch (std::out_of_range const&)
+        {
+            thrown = true;
+        }
+        MORE_CONCEPTS_CHECK(thrown);
+    }
+
+    auto test_flat_map_insertion() -> void
+    {
+        auto map = string_map{};
+        MORE_CONCEPTS_CHECK(map.insert({"b", 2}).second);
+        MORE_CONCEPTS_CHECK(not map.insert({"b", 3}).second);
+        MORE_CONCEPTS_CHECK(map.emplace("a", 1).second);
+        MORE_CONCEPTS_CHECK(map.at("b") == 2);
+
+        // Correct and incorrect hints
+        auto const d = map.emplace_hint(map.end(), "d", 4);
+        MORE_CONCEPTS_CHECK(d->first == "d");
+        auto const c = map.emplace_hint(map.begin(), "c", 3);
+        MORE_CONCEPTS_CHECK(c->first == "c" and std::next(c)->first == "d");
+        MORE_CONCEPTS_CHECK(map.insert(map.begin(), {"a", 9})->second == 1);
+
+        MORE_CONCEPTS_CHECK(not map.try_emplace("a", 10).second);
+        MORE_CONCEPTS_CHECK(map.try_emplace(map.end(), "e", 5)->second == 5);
+        MORE_CONCEPTS_CHECK(not map.insert_or_assign("a", 11).second);
+        MORE_CONCEPTS_CHECK(map.at("a") == 11);
+        MORE_CONCEPTS_CHECK(map.insert_or_assign(map.begin(), "0", 0)->first == "0");
+
+        map["f"] = 6;
+        ++map["f"];
+        MORE_CONCEPTS_CHECK(map.at("f") == 7);
+
+        // Range insertion merges, keeping the existing elements.
+        map.insert({{"g", 8}, {"a", 12}, {"bb", 13}});
+        auto keys = std::string{};
+        for (auto const& [key, value] : map)
+        {
+            keys += key;
+        }
+        MORE_CONCEPTS_CHECK(keys == "0abbbcdefg");
+        MORE_CONCEPTS_CHECK(map.at("a") == 11);
+    }
+
+    auto test_flat_map_erasure() -> void
+    {
+        auto map = string_map{{"a", 1}, {"b", 2}, {"c", 3}, {"d", 4}};
+        MORE_CONCEPTS_CHECK(map.erase("b") == 1);
+        MORE_CONCEPTS_CHECK(map.erase("b") == 0);
+        MORE_CONCEPTS_CHECK(map.erase(map.begin())->first == "c");
+        map.erase(map.cbegin(), std::next(map.cbegin()));
+        MORE_CONCEPTS_CHECK(map.size() == 1 and map.begin()->first == "d");
+
+        auto storage = std::move(map).extract();
+        MORE_CONCEPTS_CHECK(map.empty() and storage.size() == 1);
+        storage.emplace_back("e", 5);
+        map.replace(std::move(storage));
+        MORE_CONCEPTS_CHECK(map.at("e") == 5);
+
+        map.clear();
+        MORE_CONCEPTS_CHECK(map.empty());
+    }
+
+    auto test_flat_map_comparison() -> void
+    {
+        auto const lhs = string_map{{"a", 1}, {"b", 2}};
+        auto const rhs = string_map{{"b", 2}, {"a", 1}};
+        MORE_CONCEPTS_CHECK(lhs == rhs);
+        MORE_CONCEPTS_CHECK(lhs < string_map{{"a", 1}, {"b", 3}});
+        MORE_CONCEPTS_CHECK(string_map{{"b", 0}} > lhs);
+
+        auto copy = lhs;
+        copy["c"] = 3;
+        MORE_CONCEPTS_CHECK(copy != lhs);
+
+        auto other = string_map{};
+        swap(copy, other);
+        MORE_CONCEPTS_CHECK(copy.empty() and other.size() == 3);
+    }
+
+    auto test_flat_set() -> void
+    {
+        auto set = more_concepts::flat_set<int, std::less<>, std::deque<int>>{5, 1, 3, 1};
+        MORE_CONCEPTS_CHECK(set.size() == 3 and *set.begin() == 1);
+        MORE_CONCEPTS_CHECK(set.insert(2).second);
+        MORE_CONCEPTS_CHECK(not set.emplace(3).second);
+        MORE_CONCEPTS_CHECK(*set.insert(set.end(), 6) == 6);
+        MORE_CONCEPTS_CHECK(set.erase(5) == 1);
+        MORE_CONCEPTS_CHECK((set == more_concepts::flat_set<int, std::less<>, std::deque<int>>{1, 2, 3, 6}));
+        MORE_CONCEPTS_CHECK(*set.lower_bound(4) == 6);
+
+        set = {9, 8};
+        MORE_CONCEPTS_CHECK(*set.begin() == 8 and set.size() == 2);
+    }
+
+    auto const flat_map_tests = more_concepts_tests::register_test_case{
+        "flat_map",
+        [] {
+            test_flat_map_construction();
+            test_flat_map_lookup();
+            test_flat_map_insertion();
+            test_flat_map_erasure();
+            test_flat_map_comparison();
+            test_flat_set();
+        }};
+}
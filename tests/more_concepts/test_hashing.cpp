@@ -0,0 +1,83 @@
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+#include "more_concepts/base_concepts.hpp"
+#include "more_concepts/flat_hash_map.hpp"
+#include "more_concepts/hashing.hpp"
+#include "more_concepts/string_map.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    /// A strong hash declaring itself avalanching.
+    struct avalanching_int_hash
+    {
+        using is_avalanching = void;
+
+        auto operator()(int const value) const noexcept -> std::size_t
+        {
+            return more_concepts::mix_hash(static_cast<std::size_t>(value) + 1);
+        }
+    };
+
+    static_assert(not more_concepts::avalanching_hash_function<std::hash<int>, int>);
+    static_assert(more_concepts::avalanching_hash_function<avalanching_int_hash, int>);
+    static_assert(more_concepts::avalanching_hash_function<more_concepts::mixed_hash<std::hash<int>>, int>);
+    static_assert(more_concepts::avalanching_hash_function<
+        more_concepts::mixed_hash<more_concepts::string_hash>, std::string_view>);
+    static_assert(more_concepts::transparent_function<more_concepts::mixed_hash<more_concepts::string_hash>>);
+    static_assert(not more_concepts::transparent_function<more_concepts::mixed_hash<std::hash<int>>>);
+    static_assert(sizeof(more_concepts::mixed_hash<std::hash<int>>) == 1);
+
+    more_concepts_tests::register_test_case mixing{
+        "mixed_hash mixes only hashes that are not avalanching",
+        [] {
+            auto const identity = more_concepts::mixed_hash<std::hash<int>>{};
+            MORE_CONCEPTS_CHECK(identity(42) == more_concepts::mix_hash(std::hash<int>{}(42)));
+            MORE_CONCEPTS_CHECK(identity(42) != identity(43));
+
+            // Consecutive keys must differ in the low bits used by power-of-two tables,
+            // and populate the high bits too.
+            auto low_bits = std::unordered_set<std::size_t>{};
+            auto high_bits = std::unordered_set<std::size_t>{};
+            for (auto i = 0; i < 1024; ++i)
+            {
+                low_bits.insert(identity(i * 1024) & 1023u);
+                high_bits.insert(identity(i) >> (8 * sizeof(std::size_t) - 10));
+            }
+            MORE_CONCEPTS_CHECK(low_bits.size() > 512 and high_bits.size() > 512);
+
+            // Strong hashes are not mixed twice.
+            auto const strong = more_concepts::mixed_hash<avalanching_int_hash>{};
+            MORE_CONCEPTS_CHECK(strong(42) == avalanching_int_hash{}(42));
+            auto const twice = more_concepts::mixed_hash<more_concepts::mixed_hash<std::hash<int>>>{};
+            MORE_CONCEPTS_CHECK(twice(42) == identity(42));
+
+            auto const strings = more_concepts::mixed_hash<more_concepts::string_hash>{};
+            MORE_CONCEPTS_CHECK(strings(std::string_view{"key"}) == strings(std::string{"key"}));
+            MORE_CONCEPTS_CHECK(strings.base()("key") == more_concepts::string_hash{}("key"));
+        },
+    };
+
+    more_concepts_tests::register_test_case hash_map_with_mixed_hash{
+        "flat_hash_map with avalanching hash functions",
+        [] {
+            auto map = more_concepts::flat_hash_map<int, int, more_concepts::mixed_hash<std::hash<int>>>{};
+            auto strong_map = more_concepts::flat_hash_map<int, int, avalanching_int_hash>{};
+            for (auto i = 0; i < 10000; ++i)
+            {
+                map.emplace(i * 4096, i);
+                strong_map.emplace(i * 4096, i);
+            }
+            for (auto i = 0; i < 10000; ++i)
+            {
+                MORE_CONCEPTS_CHECK(map.at(i * 4096) == i and strong_map.at(i * 4096) == i);
+            }
+            MORE_CONCEPTS_CHECK(not map.contains(1) and not strong_map.contains(1));
+        },
+    };
+}
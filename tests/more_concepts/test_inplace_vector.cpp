@@ -0,0 +1,126 @@
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "more_concepts/base_containers.hpp"
+#include "more_concepts/inplace_vector.hpp"
+#include "more_concepts/small_vector.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    template <typename C>
+    concept has_allocator = requires { typename C::allocator_type; };
+
+    static_assert(more_concepts::fixed_capacity_container<std::array<int, 3>>);
+    static_assert(more_concepts::fixed_capacity_container_of<more_concepts::inplace_vector<int, 3>, int>);
+    static_assert(more_concepts::fixed_capacity_container<more_concepts::inplace_vector<std::string, 3>>);
+    static_assert(not more_concepts::fixed_capacity_container<std::vector<int>>);
+    static_assert(not more_concepts::fixed_capacity_container<std::string>);
+    static_assert(not more_concepts::fixed_capacity_container<more_concepts::small_vector<int, 3>>);
+    static_assert(more_concepts::fixed_capacity_v<std::array<int, 3>> == 3);
+    static_assert(more_concepts::fixed_capacity_v<more_concepts::inplace_vector<int, 5>> == 5);
+
+    // The elements are stored inline, and there is no allocator to reach.
+    static_assert(std::is_trivially_copyable_v<more_concepts::inplace_vector<int, 8>>);
+    static_assert(sizeof(more_concepts::inplace_vector<int, 8>) == sizeof(int[8]) + sizeof(std::size_t));
+    static_assert(not std::is_trivially_copyable_v<more_concepts::inplace_vector<std::string, 8>>);
+    static_assert(not has_allocator<more_concepts::inplace_vector<int, 8>>);
+
+    constexpr auto make_squares()
+    {
+        auto vec = more_concepts::inplace_vector<int, 8>{};
+        for (auto i = 1; vec.try_push_back(i * i) != nullptr; ++i)
+        {
+        }
+        return vec;
+    }
+
+    static_assert(make_squares().size() == 8 and make_squares().back() == 64);
+
+    constexpr auto edit_in_constant_evaluation() -> bool
+    {
+        auto vec = more_concepts::inplace_vector<int, 6>{3, 1, 4};
+        vec.insert(vec.begin() + 1, 2, 9);
+        vec.erase(vec.begin());
+        vec.emplace_back(5);
+        vec.resize(6, 7);
+
+        auto copy = vec;
+        copy.pop_back();
+        return vec == more_concepts::inplace_vector<int, 6>{9, 9, 1, 4, 5, 7} and copy < vec;
+    }
+
+    static_assert(edit_in_constant_evaluation());
+
+    template <typename T, typename MakeValue>
+    auto test_inplace_vector_capacity(MakeValue make_value) -> void
+    {
+        using vector = more_concepts::inplace_vector<T, 4>;
+        auto vec = vector(3, make_value(1));
+        vec.push_back(make_value(2));
+        MORE_CONCEPTS_CHECK(vec.size() == 4 and vec.capacity() == 4);
+        MORE_CONCEPTS_CHECK(vec.try_push_back(make_value(3)) == nullptr and vec.size() == 4);
+
+        auto const check_throws = [&](auto&& f) {
+            auto thrown = false;
+            try
+            {
+                f();
+            }
+            catch (std::bad_alloc const&)
+            {
+                thrown = true;
+            }
+            MORE_CONCEPTS_CHECK(thrown and vec.size() == 4 and vec.back() == make_value(2));
+        };
+        check_throws([&] { vec.push_back(make_value(3)); });
+        check_throws([&] { vec.insert(vec.begin(), make_value(3)); });
+        check_throws([&] { vec.resize(5); });
+        check_throws([&] { vec.reserve(5); });
+        check_throws([&] { vec.assign(5, make_value(3)); });
+
+        vec.erase(vec.begin(), vec.begin() + 2);
+        MORE_CONCEPTS_CHECK(*vec.try_emplace_back(make_value(4)) == make_value(4));
+        MORE_CONCEPTS_CHECK((vec == vector{make_value(1), make_value(2), make_value(4)}));
+
+        auto other = vector{make_value(5)};
+        swap(vec, other);
+        MORE_CONCEPTS_CHECK(vec.size() == 1 and other.size() == 3 and vec.front() == make_value(5));
+
+        auto copy = other;
+        MORE_CONCEPTS_CHECK(copy == other);
+        copy = vec;
+        MORE_CONCEPTS_CHECK(copy == vec);
+        auto moved = std::move(other);
+        MORE_CONCEPTS_CHECK(moved.size() == 3 and moved.back() == make_value(4));
+        moved = std::move(copy);
+        MORE_CONCEPTS_CHECK(moved.size() == 1 and moved.front() == make_value(5));
+    }
+
+    auto const inplace_vector_tests = more_concepts_tests::register_test_case{
+        "inplace_vector",
+        [] {
+            test_inplace_vector_capacity<int>([](int const i) { return i; });
+            test_inplace_vector_capacity<std::string>([](int const i) { return std::string(20, static_cast<char>('a' + i)); });
+            test_inplace_vector_capacity<std::shared_ptr<int>>([](int const i) {
+                static auto values = std::array{
+                    std::make_shared<int>(0),
+                    std::make_shared<int>(1),
+                    std::make_shared<int>(2),
+                    std::make_shared<int>(3),
+                    std::make_shared<int>(4),
+                    std::make_shared<int>(5)};
+                return values[static_cast<std::size_t>(i)];
+            });
+
+            auto const empty = more_concepts::inplace_vector<std::string, 0>{};
+            MORE_CONCEPTS_CHECK(empty.empty() and empty.max_size() == 0);
+        }};
+}
@@ -1,6 +1,15 @@
+#include <cstdio>
 #include <cstdlib>
 
+#include "runtime_test.hpp"
+
 auto main() -> int
 {
+    for (auto const& test_case : more_concepts_tests::registered_test_cases())
+    {
+        std::printf("Running %s\n", test_case.name);
+        test_case.run();
+    }
+
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,211 @@
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <ios>
+#include <map>
+#include <stdexcept>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "more_concepts/associative_containers.hpp"
+#include "more_concepts/flat_map.hpp"
+#include "more_concepts/mapped_flat_map.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    /// A fixed-size record, as stored in reference tables.
+    struct record
+    {
+        std::uint32_t id;
+        std::array<char, 12> code;
+
+        friend auto operator==(record const&, record const&) -> bool = default;
+    };
+
+    using table = more_concepts::mapped_flat_map<std::uint64_t, record>;
+
+    /// A key aligned beyond the size of the file header, so that the values start after padding.
+    struct alignas(16) wide_key
+    {
+        std::uint64_t low;
+        std::uint64_t high;
+
+        friend auto operator<=>(wide_key const&, wide_key const&) = default;
+    };
+
+    static_assert(more_concepts::detail::mapped_flat_map_data_offset<std::pair<wide_key, int>>
+                  > sizeof(more_concepts::detail::mapped_flat_map_header));
+
+    static_assert(more_concepts::read_only_associative_container<table>);
+    static_assert(not more_concepts::associative_container<table>);
+    static_assert(std::contiguous_iterator<table::iterator>);
+    static_assert(more_concepts::read_only_associative_container<std::map<int, int>>);
+    static_assert(more_concepts::read_only_associative_container<std::unordered_map<int, int>>);
+    static_assert(more_concepts::read_only_associative_container<more_concepts::flat_map<int, int>>);
+
+    /// A file in the temporary directory, removed when it goes out of scope.
+    class temporary_file
+    {
+    public:
+        explicit temporary_file(char const* const name)
+            : path_{std::filesystem::temp_directory_path() / name}
+        {
+        }
+
+        temporary_file(temporary_file const&) = delete;
+        auto operator=(temporary_file const&) -> temporary_file& = delete;
+
+        ~temporary_file()
+        {
+            auto error = std::error_code{};
+            std::filesystem::remove(path_, error);
+        }
+
+        [[nodiscard]] auto path() const -> std::filesystem::path const& { return path_; }
+
+    private:
+        std::filesystem::path path_;
+    };
+
+    more_concepts_tests::register_test_case lookup{
+        "mapped_flat_map lookup",
+        [] {
+            auto values = std::vector<std::pair<std::uint64_t, record>>{};
+            for (auto i = std::uint32_t{0}; i < 10000; ++i)
+            {
+                values.emplace_back(std::uint64_t{i} * 3 % 10007, record{i, {'r', static_cast<char>('a' + i % 26)}});
+            }
+            auto const source = more_concepts::flat_map<std::uint64_t, record>(std::move(values));
+
+            auto const file = temporary_file{"more_concepts_test_mapped_flat_map"};
+            more_concepts::write_mapped_flat_map(file.path(), source);
+
+            auto const map = table(file.path());
+            MORE_CONCEPTS_CHECK(map.size() == source.size());
+            MORE_CONCEPTS_CHECK(std::equal(map.begin(), map.end(), source.begin(), source.end()));
+            MORE_CONCEPTS_CHECK(map.at(3).id == 1 and map.at(3).code[1] == 'b');
+            MORE_CONCEPTS_CHECK(map.find(10007) == map.end());
+            MORE_CONCEPTS_CHECK(map.contains(0) and map.count(6) == 1 and map.count(10008) == 0);
+            MORE_CONCEPTS_CHECK(map.lower_bound(10006)->first == 10006);
+            MORE_CONCEPTS_CHECK(map.upper_bound(10006) == map.end());
+            MORE_CONCEPTS_CHECK(map.rbegin()->first == 10006);
+
+            auto const [first, last] = map.equal_range(42);
+            MORE_CONCEPTS_CHECK(last - first == 1 and first->second == source.at(42));
+
+            auto thrown = false;
+            try
+            {
+                static_cast<void>(map.at(20000));
+            }
+            catch (std::out_of_range const&)
+            {
+                thrown = true;
+            }
+            MORE_CONCEPTS_CHECK(thrown);
+
+            // Copies share the mapping, which outlives the original.
+            auto copy = map;
+            MORE_CONCEPTS_CHECK(copy == map);
+            auto moved = std::move(copy);
+            MORE_CONCEPTS_CHECK(copy.empty() and copy.begin() == copy.end());
+            MORE_CONCEPTS_CHECK(moved.find(42)->second == source.at(42));
+            MORE_CONCEPTS_CHECK(moved != table{});
+        },
+    };
+
+    more_concepts_tests::register_test_case empty_and_transparent{
+        "mapped_flat_map without elements and with a transparent comparator",
+        [] {
+            auto const file = temporary_file{"more_concepts_test_mapped_flat_map_empty"};
+            more_concepts::write_mapped_flat_map(file.path(), more_concepts::flat_map<int, double, std::greater<>>{});
+            auto const empty = more_concepts::mapped_flat_map<int, double, std::greater<>>(file.path());
+            MORE_CONCEPTS_CHECK(empty.empty() and empty.find(1) == empty.end());
+
+            // Rewriting the file replaces it, while the existing mapping keeps the old contents.
+            more_concepts::write_mapped_flat_map(
+                file.path(), more_concepts::flat_map<int, double, std::greater<>>{{1, 0.5}, {3, 1.5}, {2, 1.0}});
+            auto const map = more_concepts::mapped_flat_map<int, double, std::greater<>>(file.path());
+            MORE_CONCEPTS_CHECK(empty.empty());
+            MORE_CONCEPTS_CHECK(map.size() == 3 and map.begin()->first == 3);
+            MORE_CONCEPTS_CHECK(map.lower_bound(2L)->second == 1.0);
+            MORE_CONCEPTS_CHECK(map.upper_bound(2L)->first == 1);
+            MORE_CONCEPTS_CHECK(map.count(3L) == 1 and map.contains(1L));
+        },
+    };
+
+    more_concepts_tests::register_test_case invalid_files{
+        "mapped_flat_map rejects invalid files",
+        [] {
+            auto const throws_runtime_error = [](std::filesystem::path const& path) {
+                try
+                {
+                    static_cast<void>(table(path));
+                }
+                catch (std::runtime_error const&)
+                {
+                    return true;
+                }
+                return false;
+            };
+
+            auto const missing = temporary_file{"more_concepts_test_mapped_flat_map_missing"};
+            auto thrown = false;
+            try
+            {
+                static_cast<void>(table(missing.path()));
+            }
+            catch (std::system_error const& error)
+            {
+                thrown = error.code() == std::errc::no_such_file_or_directory;
+            }
+            MORE_CONCEPTS_CHECK(thrown);
+
+            // Different mapped type
+            auto const other_type = temporary_file{"more_concepts_test_mapped_flat_map_other_type"};
+            more_concepts::write_mapped_flat_map(other_type.path(), more_concepts::flat_map<std::uint64_t, int>{{1, 1}});
+            MORE_CONCEPTS_CHECK(throws_runtime_error(other_type.path()));
+
+            // Not written by write_mapped_flat_map
+            auto const garbage = temporary_file{"more_concepts_test_mapped_flat_map_garbage"};
+            std::ofstream{garbage.path()} << "not a table";
+            MORE_CONCEPTS_CHECK(throws_runtime_error(garbage.path()));
+
+            // Truncated
+            auto const truncated = temporary_file{"more_concepts_test_mapped_flat_map_truncated"};
+            more_concepts::write_mapped_flat_map(
+                truncated.path(), more_concepts::flat_map<std::uint64_t, record>{{1, {}}, {2, {}}});
+            std::filesystem::resize_file(truncated.path(), std::filesystem::file_size(truncated.path()) - 1);
+            MORE_CONCEPTS_CHECK(throws_runtime_error(truncated.path()));
+
+            // Truncated within the padding after the header, which claims many values
+            auto const truncated_header = temporary_file{"more_concepts_test_mapped_flat_map_truncated_header"};
+            more_concepts::write_mapped_flat_map(truncated_header.path(), more_concepts::flat_map<wide_key, int>{});
+            {
+                auto file = std::fstream{truncated_header.path(), std::ios::in | std::ios::out | std::ios::binary};
+                auto const size = std::uint64_t{1000000};
+                file.seekp(offsetof(more_concepts::detail::mapped_flat_map_header, size));
+                file.write(reinterpret_cast<char const*>(&size), sizeof(size));
+            }
+            std::filesystem::resize_file(truncated_header.path(), sizeof(more_concepts::detail::mapped_flat_map_header));
+            auto threw = false;
+            try
+            {
+                static_cast<void>(more_concepts::mapped_flat_map<wide_key, int>(truncated_header.path()));
+            }
+            catch (std::runtime_error const&)
+            {
+                threw = true;
+            }
+            MORE_CONCEPTS_CHECK(threw);
+        },
+    };
+}
@@ -0,0 +1,27 @@
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+import more_concepts;
+
+namespace
+{
+    using test_vector = std::vector<int>;
+    using test_map = std::map<std::string, int>;
+
+    using declared_vector = std::vector<long>;
+}
+
+template <>
+inline constexpr auto more_concepts::enable_container_category<declared_vector>
+    = more_concepts::container_category::contiguous_container;
+
+static_assert(more_concepts::contiguous_container_of<test_vector, int>);
+static_assert(more_concepts::inplace_back_constructing_container<test_vector>);
+static_assert(more_concepts::ordered_unique_map_container<test_map>);
+static_assert(more_concepts::lite::unique_map_container<test_map>);
+static_assert(more_concepts::contiguous_container<declared_vector>);
+
+static_assert(std::random_access_iterator<
+    more_concepts::mock_const_iterator<int, std::random_access_iterator_tag>>);
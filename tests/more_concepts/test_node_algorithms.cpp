@@ -0,0 +1,120 @@
+#include <array>
+#include <cstddef>
+#include <map>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "more_concepts/node_algorithms.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    static_assert(more_concepts::detail::node_compatible_containers<std::map<int, int>, std::multimap<int, int>>);
+    static_assert(more_concepts::detail::node_compatible_containers<
+        std::map<int, int>, std::map<int, int, std::greater<>>>);
+    static_assert(not more_concepts::detail::node_compatible_containers<std::map<int, int>, std::unordered_map<int, int>>);
+    static_assert(not more_concepts::detail::node_compatible_containers<std::map<int, int>, std::map<int, long>>);
+
+    /// Forwards to the new/delete resource, counting the allocations.
+    class counting_resource : public std::pmr::memory_resource
+    {
+    public:
+        int allocations = 0;
+
+    private:
+        auto do_allocate(std::size_t const bytes, std::size_t const alignment) -> void* override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        auto do_deallocate(void* const ptr, std::size_t const bytes, std::size_t const alignment) -> void override
+        {
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]] auto do_is_equal(std::pmr::memory_resource const& other) const noexcept -> bool override
+        {
+            return this == &other;
+        }
+    };
+
+    auto test_move_matching() -> void
+    {
+        auto resource = counting_resource{};
+        auto src = std::pmr::map<int, std::pmr::string>{&resource};
+        auto dst = std::pmr::map<int, std::pmr::string>{&resource};
+        for (auto i = 0; i < 10; ++i)
+        {
+            src.emplace(i, std::pmr::string(40, static_cast<char>('a' + i)));
+        }
+        dst.emplace(4, "taken");
+        auto const* const moved_value = &src.at(2);
+        auto const allocations = resource.allocations;
+
+        auto const is_even = [](auto const& value) { return value.first % 2 == 0; };
+        MORE_CONCEPTS_CHECK(more_concepts::move_matching(src, dst, is_even) == 4);
+        MORE_CONCEPTS_CHECK(resource.allocations == allocations);
+
+        // The elements are relinked, not copied; the duplicate key stays in the source.
+        MORE_CONCEPTS_CHECK(&dst.at(2) == moved_value);
+        MORE_CONCEPTS_CHECK(src.size() == 6 and dst.size() == 5);
+        MORE_CONCEPTS_CHECK(src.contains(4) and dst.at(4) == "taken");
+        MORE_CONCEPTS_CHECK(dst.at(8) == std::pmr::string(40, 'i'));
+
+        // Multiple key destinations accept every element.
+        auto multi = std::pmr::multimap<int, std::pmr::string>{&resource};
+        multi.emplace(1, "first");
+        auto const multi_allocations = resource.allocations;
+        MORE_CONCEPTS_CHECK(more_concepts::move_matching(src, multi, [](auto const&) { return true; }) == 6);
+        MORE_CONCEPTS_CHECK(src.empty() and multi.size() == 7 and multi.count(1) == 2);
+        MORE_CONCEPTS_CHECK(resource.allocations == multi_allocations);
+
+        auto hashed_src = std::pmr::unordered_map<std::pmr::string, int>{&resource};
+        auto hashed_dst = std::pmr::unordered_map<std::pmr::string, int>{&resource};
+        for (auto i = 0; i < 100; ++i)
+        {
+            hashed_src.emplace(std::pmr::string(30, 'x') + std::to_string(i).c_str(), i);
+        }
+        hashed_dst.reserve(100);
+        auto const hashed_allocations = resource.allocations;
+        auto const below_30 = [](auto const& value) { return value.second < 30; };
+        MORE_CONCEPTS_CHECK(more_concepts::move_matching(hashed_src, hashed_dst, below_30) == 30);
+        MORE_CONCEPTS_CHECK(resource.allocations == hashed_allocations);
+        MORE_CONCEPTS_CHECK(hashed_src.size() == 70 and hashed_dst.size() == 30);
+        MORE_CONCEPTS_CHECK(hashed_dst.at(std::pmr::string(30, 'x') + "29") == 29);
+    }
+
+    auto test_rebucket() -> void
+    {
+        auto src = std::set<int>{};
+        for (auto i = 0; i < 20; ++i)
+        {
+            src.insert(i);
+        }
+
+        auto tiers = std::array<std::multiset<int>, 3>{};
+        tiers[1].insert(1);
+        MORE_CONCEPTS_CHECK(more_concepts::rebucket(src, tiers, [](int const value) { return value % 4; }) == 15);
+        MORE_CONCEPTS_CHECK(src == std::set<int>({3, 7, 11, 15, 19}));
+        MORE_CONCEPTS_CHECK(tiers[0] == std::multiset<int>({0, 4, 8, 12, 16}));
+        MORE_CONCEPTS_CHECK(tiers[1] == std::multiset<int>({1, 1, 5, 9, 13, 17}));
+        MORE_CONCEPTS_CHECK(tiers[2].size() == 5);
+
+        auto shards = std::vector<std::set<int>>(2);
+        shards[0].insert(3);
+        MORE_CONCEPTS_CHECK(more_concepts::rebucket(src, shards, [](int const value) { return value < 10 ? 0 : 1; }) == 4);
+        MORE_CONCEPTS_CHECK(src == std::set<int>({3}) and shards[0].size() == 2 and shards[1].size() == 3);
+    }
+
+    auto const node_algorithm_tests = more_concepts_tests::register_test_case{
+        "node_algorithms",
+        [] {
+            test_move_matching();
+            test_rebucket();
+        }};
+}
@@ -0,0 +1,153 @@
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <vector>
+
+#include "more_concepts/priority_queue.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    template <std::size_t Arity, typename Seq, typename Compare>
+    auto check_against_std() -> void
+    {
+        auto queue = more_concepts::priority_queue<int, Seq, Compare, Arity>{};
+        auto reference = std::priority_queue<int, std::vector<int>, Compare>{};
+
+        auto state = 42u;
+        auto const next = [&] {
+            state = state * 1103515245u + 12345u;
+            return static_cast<int>((state >> 8u) % 1000u);
+        };
+
+        for (auto i = 0; i < 5000; ++i)
+        {
+            auto const value = next();
+            switch (value % 4)
+            {
+            case 0:
+            case 1:
+                queue.push(value);
+                reference.push(value);
+                break;
+            case 2:
+                if (not reference.empty())
+                {
+                    queue.pop();
+                    reference.pop();
+                }
+                break;
+            default:
+                if (not reference.empty())
+                {
+                    queue.pop_push(value);
+                    reference.pop();
+                    reference.push(value);
+                }
+                break;
+            }
+
+            MORE_CONCEPTS_CHECK(queue.size() == reference.size());
+            MORE_CONCEPTS_CHECK(queue.empty() or queue.top() == reference.top());
+        }
+
+        // Small ranges are sifted up, large ones heapified.
+        for (auto const count : {3, 300, 20000})
+        {
+            auto values = std::vector<int>{};
+            for (auto i = 0; i < count; ++i)
+            {
+                values.push_back(next());
+            }
+            queue.push_range(values);
+            for (auto const value : values)
+            {
+                reference.push(value);
+            }
+            MORE_CONCEPTS_CHECK(queue.size() == reference.size());
+        }
+
+        while (not reference.empty())
+        {
+            MORE_CONCEPTS_CHECK(queue.top() == reference.top());
+            queue.pop();
+            reference.pop();
+        }
+        MORE_CONCEPTS_CHECK(queue.empty());
+    }
+
+    auto test_priority_queue_construction() -> void
+    {
+        auto const values = std::vector<int>{3, 1, 4, 1, 5, 9, 2, 6};
+        auto from_range = more_concepts::priority_queue<int>(values.begin(), values.end());
+        MORE_CONCEPTS_CHECK(from_range.size() == 8 and from_range.top() == 9);
+
+        auto adopted = more_concepts::priority_queue<int, std::vector<int>, std::greater<>, 2>(std::greater<>{}, values);
+        MORE_CONCEPTS_CHECK(adopted.top() == 1);
+        adopted.pop();
+        adopted.pop();
+        MORE_CONCEPTS_CHECK(adopted.top() == 2);
+
+        auto other = more_concepts::priority_queue<int>{};
+        other.reserve(100);
+        swap(from_range, other);
+        MORE_CONCEPTS_CHECK(from_range.empty() and other.size() == 8);
+
+        auto empty = more_concepts::priority_queue<int>{};
+        empty.pop_push(7);
+        MORE_CONCEPTS_CHECK(empty.size() == 1 and empty.top() == 7);
+
+        // Replacing the top element with itself, while sifting overwrites it.
+        auto aliased = more_concepts::priority_queue<int>{};
+        for (auto const value : {50, 40, 30, 20, 10})
+        {
+            aliased.push(value);
+        }
+        aliased.pop_push(aliased.top());
+        MORE_CONCEPTS_CHECK(aliased.size() == 5 and aliased.top() == 50);
+        aliased.pop();
+        MORE_CONCEPTS_CHECK(aliased.top() == 40);
+    }
+
+    auto test_priority_queue_move_only() -> void
+    {
+        struct deref_less
+        {
+            auto operator()(std::unique_ptr<int> const& lhs, std::unique_ptr<int> const& rhs) const -> bool
+            {
+                return *lhs < *rhs;
+            }
+        };
+
+        auto queue = more_concepts::priority_queue<std::unique_ptr<int>, std::deque<std::unique_ptr<int>>, deref_less, 8>{};
+        for (auto i = 0; i < 100; ++i)
+        {
+            queue.emplace(std::make_unique<int>((i * 37) % 100));
+        }
+        queue.pop_push(std::make_unique<int>(-1));
+        MORE_CONCEPTS_CHECK(*queue.top() == 98);
+
+        auto previous = *queue.top();
+        while (not queue.empty())
+        {
+            MORE_CONCEPTS_CHECK(*queue.top() <= previous);
+            previous = *queue.top();
+            queue.pop();
+        }
+        MORE_CONCEPTS_CHECK(previous == -1);
+    }
+
+    auto const priority_queue_tests = more_concepts_tests::register_test_case{
+        "priority_queue",
+        [] {
+            check_against_std<2, std::vector<int>, std::less<int>>();
+            check_against_std<4, std::vector<int>, std::less<int>>();
+            check_against_std<8, std::deque<int>, std::greater<int>>();
+            check_against_std<3, std::vector<int>, std::less<int>>();
+            test_priority_queue_construction();
+            test_priority_queue_move_only();
+        }};
+}
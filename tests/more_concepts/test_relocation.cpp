@@ -0,0 +1,169 @@
+#include <array>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "more_concepts/base_concepts.hpp"
+#include "more_concepts/relocation.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    /// A unique_ptr-like handle, opted into trivial relocation.
+    struct handle
+    {
+        std::unique_ptr<int> ptr;
+    };
+
+    /// Not trivially relocatable; counts live objects.
+    struct counted
+    {
+        static inline auto live = 0;
+
+        int value;
+
+        explicit counted(int const v) : value{v} { ++live; }
+        counted(counted&& other) noexcept : value{other.value} { ++live; }
+        ~counted() { --live; }
+    };
+}
+
+template <>
+inline constexpr bool more_concepts::enable_trivially_relocatable<handle> = true;
+
+static_assert(more_concepts::trivially_relocatable<int>);
+static_assert(more_concepts::trivially_relocatable<int const>);
+static_assert(more_concepts::trivially_relocatable<std::array<int, 4>>);
+static_assert(more_concepts::trivially_relocatable<handle>);
+static_assert(not more_concepts::trivially_relocatable<int&>);
+static_assert(not more_concepts::trivially_relocatable<void>);
+static_assert(not more_concepts::trivially_relocatable<counted>);
+static_assert(not more_concepts::trivially_relocatable<std::unique_ptr<int>>);
+
+namespace
+{
+    // Relocation is usable in constant expressions, where the bytewise path is not taken.
+    constexpr auto constexpr_relocate_test() -> bool
+    {
+        auto* const storage = std::allocator<int>{}.allocate(6);
+        for (auto i = 0; i < 4; ++i)
+        {
+            std::construct_at(storage + i, i);
+        }
+
+        // Shift right by two, then back
+        more_concepts::relocate(storage, storage + 4, storage + 2);
+        auto ok = storage[2] == 0 and storage[5] == 3;
+        more_concepts::relocate_n(storage + 2, 4, storage);
+        ok = ok and storage[0] == 0 and storage[3] == 3;
+
+        std::destroy(storage, storage + 4);
+        std::allocator<int>{}.deallocate(storage, 6);
+        return ok;
+    }
+
+    static_assert(constexpr_relocate_test());
+
+    template <typename T>
+    struct raw_buffer
+    {
+        explicit raw_buffer(std::size_t const size)
+            : data{std::allocator<T>{}.allocate(size)}, size{size}
+        {
+        }
+
+        ~raw_buffer()
+        {
+            std::allocator<T>{}.deallocate(data, size);
+        }
+
+        T* data;
+        std::size_t size;
+    };
+
+    auto test_trivial_relocation() -> void
+    {
+        auto src = raw_buffer<handle>{4};
+        auto dest = raw_buffer<handle>{4};
+        for (auto i = 0; i < 4; ++i)
+        {
+            std::construct_at(src.data + i, handle{std::make_unique<int>(i)});
+        }
+
+        auto const d_last = more_concepts::uninitialized_relocate(src.data, src.data + 4, dest.data);
+        MORE_CONCEPTS_CHECK(d_last == dest.data + 4);
+        for (auto i = 0; i < 4; ++i)
+        {
+            MORE_CONCEPTS_CHECK(*dest.data[i].ptr == i);
+        }
+
+        // Erase the first element by shifting the rest left
+        std::destroy_at(dest.data);
+        more_concepts::relocate(dest.data + 1, dest.data + 4, dest.data);
+        MORE_CONCEPTS_CHECK(*dest.data[0].ptr == 1);
+        MORE_CONCEPTS_CHECK(*dest.data[2].ptr == 3);
+
+        // Insert at the front by shifting right
+        more_concepts::relocate_n(dest.data, 3, dest.data + 1);
+        std::construct_at(dest.data, handle{std::make_unique<int>(0)});
+        for (auto i = 0; i < 4; ++i)
+        {
+            MORE_CONCEPTS_CHECK(*dest.data[i].ptr == i);
+        }
+
+        std::destroy(dest.data, dest.data + 4);
+    }
+
+    auto test_nontrivial_relocation() -> void
+    {
+        auto src = raw_buffer<counted>{4};
+        auto dest = raw_buffer<counted>{5};
+        for (auto i = 0; i < 4; ++i)
+        {
+            std::construct_at(src.data + i, i);
+        }
+
+        auto const [src_last, d_last]
+            = more_concepts::uninitialized_relocate_n(src.data, 4, dest.data);
+        MORE_CONCEPTS_CHECK(src_last == src.data + 4);
+        MORE_CONCEPTS_CHECK(d_last == dest.data + 4);
+        MORE_CONCEPTS_CHECK(counted::live == 4);
+
+        more_concepts::relocate(dest.data, dest.data + 4, dest.data + 1);
+        MORE_CONCEPTS_CHECK(counted::live == 4);
+        for (auto i = 0; i < 4; ++i)
+        {
+            MORE_CONCEPTS_CHECK(dest.data[i + 1].value == i);
+        }
+
+        std::destroy(dest.data + 1, dest.data + 5);
+        MORE_CONCEPTS_CHECK(counted::live == 0);
+    }
+
+    auto test_nontrivial_relocation_of_strings() -> void
+    {
+        auto src = std::vector<std::string>{"a", "b", "c"};
+        auto dest = raw_buffer<std::string>{3};
+
+        // std::string is not trivially relocatable, so this goes through the move constructor.
+        more_concepts::uninitialized_relocate(src.begin(), src.end(), dest.data);
+        MORE_CONCEPTS_CHECK(dest.data[0] == "a" and dest.data[2] == "c");
+        std::destroy(dest.data, dest.data + 3);
+
+        // The source elements have been destroyed; give the vector live objects back.
+        for (auto& str : src)
+        {
+            std::construct_at(&str);
+        }
+    }
+
+    auto const relocation_tests = more_concepts_tests::register_test_case{
+        "relocation",
+        [] {
+            test_trivial_relocation();
+            test_nontrivial_relocation();
+            test_nontrivial_relocation_of_strings();
+        }};
+}
@@ -0,0 +1,224 @@
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "more_concepts/ring_deque.hpp"
+#include "more_concepts/sequence_containers.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    static_assert(more_concepts::random_access_container<more_concepts::ring_deque<int>>);
+    static_assert(not more_concepts::contiguous_container<more_concepts::ring_deque<int>>);
+    static_assert(std::random_access_iterator<more_concepts::ring_deque<std::string>::iterator>);
+    static_assert(std::random_access_iterator<more_concepts::ring_deque<std::string>::const_iterator>);
+
+    /// A type whose move constructor may throw, so that reallocation copies it.
+    struct throwing_move
+    {
+        std::string value;
+
+        explicit throwing_move(std::string value)
+            : value{std::move(value)}
+        {
+        }
+
+        throwing_move(throwing_move const&) = default;
+
+        throwing_move(throwing_move&& other) noexcept(false)
+            : value{std::move(other.value)}
+        {
+        }
+
+        auto operator=(throwing_move const&) -> throwing_move& = default;
+        auto operator=(throwing_move&&) -> throwing_move& = default;
+
+        friend auto operator==(throwing_move const&, throwing_move const&) -> bool = default;
+    };
+
+    template <typename T, typename MakeValue>
+    auto check_against_deque(MakeValue make_value) -> void
+    {
+        auto deque = more_concepts::ring_deque<T>{};
+        auto reference = std::deque<T>{};
+        auto const check = [&] {
+            MORE_CONCEPTS_CHECK(deque.size() == reference.size());
+            MORE_CONCEPTS_CHECK(std::equal(deque.begin(), deque.end(), reference.begin(), reference.end()));
+            MORE_CONCEPTS_CHECK(std::equal(deque.rbegin(), deque.rend(), reference.rbegin(), reference.rend()));
+
+            auto const [first, second] = deque.segments();
+            MORE_CONCEPTS_CHECK(first.size() + second.size() == deque.size());
+            MORE_CONCEPTS_CHECK(std::equal(first.begin(), first.end(), reference.begin()));
+            MORE_CONCEPTS_CHECK(std::equal(second.begin(), second.end(), reference.begin() + static_cast<std::ptrdiff_t>(first.size())));
+        };
+
+        auto state = 11u;
+        for (auto i = 0; i < 3000; ++i)
+        {
+            state = state * 1103515245u + 12345u;
+            auto const roll = (state >> 8u) % 14u;
+            auto const pos = reference.empty() ? 0 : (state >> 16u) % reference.size();
+            auto const value = make_value(i);
+
+            switch (roll)
+            {
+            case 0:
+            case 1:
+                deque.push_back(value);
+                reference.push_back(value);
+                break;
+            case 2:
+            case 3:
+                deque.push_front(value);
+                reference.push_front(value);
+                break;
+            case 4:
+                if (not reference.empty())
+                {
+                    deque.pop_front();
+                    reference.pop_front();
+                }
+                break;
+            case 5:
+                if (not reference.empty())
+                {
+                    deque.pop_back();
+                    reference.pop_back();
+                }
+                break;
+            case 6:
+                deque.insert(deque.begin() + pos, value);
+                reference.insert(reference.begin() + pos, value);
+                break;
+            case 7:
+                // Empty insertions are avoided, as std::deque mishandles some of them.
+                deque.insert(deque.begin() + pos, pos % 4 + 1, value);
+                reference.insert(reference.begin() + pos, pos % 4 + 1, value);
+                break;
+            case 8:
+            {
+                auto const values = std::vector<T>(pos % 7 + 1, value);
+                deque.insert(deque.begin() + pos, values.begin(), values.end());
+                reference.insert(reference.begin() + pos, values.begin(), values.end());
+                break;
+            }
+            case 9:
+                if (not reference.empty())
+                {
+                    deque.erase(deque.begin() + pos);
+                    reference.erase(reference.begin() + pos);
+                }
+                break;
+            case 10:
+            {
+                auto const last = std::min(pos + 5, reference.size());
+                deque.erase(deque.begin() + pos, deque.begin() + last);
+                reference.erase(reference.begin() + pos, reference.begin() + last);
+                break;
+            }
+            case 11:
+                if (not reference.empty())
+                {
+                    // Aliasing an element, possibly while reallocating.
+                    deque.push_front(deque[pos]);
+                    reference.push_front(reference[pos]);
+                    deque.emplace(deque.begin() + pos, deque.back());
+                    reference.emplace(reference.begin() + pos, reference.back());
+                }
+                break;
+            case 12:
+                deque.resize(pos + 3, value);
+                reference.resize(pos + 3, value);
+                break;
+            default:
+                deque.shrink_to_fit();
+                if (reference.size() > 200)
+                {
+                    deque.assign(5, value);
+                    reference.assign(5, value);
+                }
+                break;
+            }
+            check();
+        }
+
+        auto copy = deque;
+        MORE_CONCEPTS_CHECK(copy == deque);
+        auto moved = std::move(copy);
+        MORE_CONCEPTS_CHECK(copy.empty() and moved == deque);
+        copy = moved;
+        MORE_CONCEPTS_CHECK(copy == deque);
+    }
+
+    auto test_ring_deque_wraparound() -> void
+    {
+        auto deque = more_concepts::ring_deque<int>{};
+        deque.reserve(5);
+        MORE_CONCEPTS_CHECK(deque.capacity() == 8);
+
+        // Used as a queue, the elements wrap around without reallocating.
+        for (auto i = 0; i < 100; ++i)
+        {
+            deque.push_back(i);
+            if (deque.size() > 6)
+            {
+                deque.pop_front();
+            }
+        }
+        MORE_CONCEPTS_CHECK(deque.capacity() == 8 and deque.size() == 6 and deque.front() == 94);
+
+        auto sum = 0;
+        for (auto const segment : deque.segments())
+        {
+            sum = std::accumulate(segment.begin(), segment.end(), sum);
+        }
+        MORE_CONCEPTS_CHECK(sum == 94 + 95 + 96 + 97 + 98 + 99);
+        MORE_CONCEPTS_CHECK(not deque.segments()[1].empty());
+
+        MORE_CONCEPTS_CHECK(deque.end() - deque.begin() == 6 and deque.begin()[5] == 99 and deque.at(5) == 99);
+        MORE_CONCEPTS_CHECK(deque.begin() < deque.end() and deque.cbegin() + 6 == deque.cend());
+
+        MORE_CONCEPTS_CHECK(deque.insert(deque.begin() + 3, 0, 5) == deque.begin() + 3 and deque.size() == 6);
+
+        deque.emplace_front(93);
+        deque.emplace_back(100);
+        MORE_CONCEPTS_CHECK(deque.capacity() == 8 and deque.front() == 93 and deque.back() == 100);
+        deque.push_back(101);
+        MORE_CONCEPTS_CHECK(deque.capacity() == 16 and deque.segments()[1].empty() and deque[8] == 101);
+
+        auto thrown = false;
+        try
+        {
+            static_cast<void>(deque.at(9));
+        }
+        catch (std::out_of_range const&)
+        {
+            thrown = true;
+        }
+        MORE_CONCEPTS_CHECK(thrown);
+
+        auto other = more_concepts::ring_deque<int>{1, 2};
+        swap(deque, other);
+        MORE_CONCEPTS_CHECK(deque.size() == 2 and other.size() == 9 and deque < other);
+
+        deque.clear();
+        deque.shrink_to_fit();
+        MORE_CONCEPTS_CHECK(deque.empty() and deque.capacity() == 0);
+    }
+
+    auto const ring_deque_tests = more_concepts_tests::register_test_case{
+        "ring_deque",
+        [] {
+            check_against_deque<int>([](int const i) { return i; });
+            check_against_deque<std::string>([](int const i) { return std::string(20, static_cast<char>('a' + i % 26)); });
+            check_against_deque<throwing_move>([](int const i) { return throwing_move{std::to_string(i)}; });
+            check_against_deque<std::shared_ptr<int>>([](int const i) { return std::make_shared<int>(i); });
+            test_ring_deque_wraparound();
+        }};
+}
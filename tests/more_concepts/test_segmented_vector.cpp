@@ -0,0 +1,249 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "more_concepts/base_containers.hpp"
+#include "more_concepts/bulk_algorithms.hpp"
+#include "more_concepts/segmented_vector.hpp"
+#include "more_concepts/sequence_containers.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    static_assert(more_concepts::random_access_container<more_concepts::segmented_vector<int>>);
+    static_assert(more_concepts::back_growable_container<more_concepts::segmented_vector<std::string>>);
+    static_assert(more_concepts::inplace_back_constructing_container<more_concepts::segmented_vector<std::string>>);
+    static_assert(more_concepts::allocator_aware_container<more_concepts::segmented_vector<std::string>>);
+    static_assert(more_concepts::reservable_container<more_concepts::segmented_vector<int>>);
+    static_assert(not more_concepts::contiguous_container<more_concepts::segmented_vector<int>>);
+    static_assert(std::random_access_iterator<more_concepts::segmented_vector<std::string>::iterator>);
+    static_assert(std::random_access_iterator<more_concepts::segmented_vector<std::string>::const_iterator>);
+    static_assert(more_concepts::segmented_vector<int>::chunk_size == 1024);
+
+    /// Counts the copies and moves made of it.
+    struct counted
+    {
+        static inline auto transfers = 0;
+
+        int value;
+
+        explicit counted(int const value)
+            : value{value}
+        {
+        }
+
+        counted(counted const& other)
+            : value{other.value}
+        {
+            ++transfers;
+        }
+
+        counted(counted&& other) noexcept
+            : value{other.value}
+        {
+            ++transfers;
+        }
+
+        auto operator=(counted const&) -> counted& = default;
+        auto operator=(counted&&) -> counted& = default;
+
+        friend auto operator==(counted const&, counted const&) -> bool = default;
+    };
+
+    more_concepts_tests::register_test_case stable_references{
+        "segmented_vector growth does not move elements",
+        [] {
+            auto vec = more_concepts::segmented_vector<counted, 8>{};
+            vec.emplace_back(0);
+            auto* const first = &vec.front();
+
+            counted::transfers = 0;
+            auto addresses = std::vector<counted const*>{};
+            for (auto i = 1; i < 1000; ++i)
+            {
+                addresses.push_back(&vec.emplace_back(i));
+            }
+            MORE_CONCEPTS_CHECK(counted::transfers == 0);
+            MORE_CONCEPTS_CHECK(&vec.front() == first);
+            MORE_CONCEPTS_CHECK(vec.capacity() == 1000);
+            for (auto i = 1; i < 1000; ++i)
+            {
+                MORE_CONCEPTS_CHECK(&vec[static_cast<std::size_t>(i)] == addresses[static_cast<std::size_t>(i - 1)]);
+                MORE_CONCEPTS_CHECK(addresses[static_cast<std::size_t>(i - 1)]->value == i);
+            }
+
+            // Appending a copy of an element, which does not move.
+            vec.push_back(vec[3]);
+            MORE_CONCEPTS_CHECK(vec.back().value == 3);
+        },
+    };
+
+    more_concepts_tests::register_test_case against_vector{
+        "segmented_vector matches vector",
+        [] {
+            auto vec = more_concepts::segmented_vector<std::string, 3>{};
+            auto reference = std::vector<std::string>{};
+            auto const check = [&] {
+                MORE_CONCEPTS_CHECK(vec.size() == reference.size());
+                MORE_CONCEPTS_CHECK(std::equal(vec.begin(), vec.end(), reference.begin(), reference.end()));
+                MORE_CONCEPTS_CHECK(std::equal(vec.rbegin(), vec.rend(), reference.rbegin(), reference.rend()));
+                MORE_CONCEPTS_CHECK(vec.capacity() % 3 == 0 and vec.capacity() >= vec.size());
+            };
+
+            auto state = 5u;
+            for (auto i = 0; i < 2000; ++i)
+            {
+                state = state * 1103515245u + 12345u;
+                auto const roll = (state >> 8u) % 8u;
+                auto const pos = (state >> 16u) % 20u;
+                auto const value = std::string(20, static_cast<char>('a' + i % 26));
+
+                switch (roll)
+                {
+                case 0:
+                case 1:
+                case 2:
+                    vec.push_back(value);
+                    reference.push_back(value);
+                    break;
+                case 3:
+                    if (not reference.empty())
+                    {
+                        vec.pop_back();
+                        reference.pop_back();
+                    }
+                    break;
+                case 4:
+                    vec.resize(reference.size() + pos / 2, value);
+                    reference.resize(reference.size() + pos / 2, value);
+                    break;
+                case 5:
+                    vec.resize(reference.size() - std::min<std::size_t>(pos, reference.size()));
+                    reference.resize(reference.size() - std::min<std::size_t>(pos, reference.size()));
+                    break;
+                case 6:
+                    vec.shrink_to_fit();
+                    MORE_CONCEPTS_CHECK(vec.capacity() - vec.size() < 3);
+                    break;
+                case 7:
+                    if (not reference.empty())
+                    {
+                        MORE_CONCEPTS_CHECK(vec.at(pos % reference.size()) == reference.at(pos % reference.size()));
+                        MORE_CONCEPTS_CHECK(vec.back() == reference.back());
+                    }
+                    break;
+                }
+                check();
+            }
+
+            vec.clear();
+            reference.clear();
+            check();
+        },
+    };
+
+    more_concepts_tests::register_test_case segments{
+        "segmented_vector for_each_segment",
+        [] {
+            auto vec = more_concepts::segmented_vector<int, 4>(10);
+            std::iota(vec.begin(), vec.end(), 0);
+
+            auto sizes = std::vector<std::size_t>{};
+            auto sum = 0;
+            std::as_const(vec).for_each_segment([&](std::span<int const> const segment) {
+                sizes.push_back(segment.size());
+                sum = std::accumulate(segment.begin(), segment.end(), sum);
+            });
+            MORE_CONCEPTS_CHECK((sizes == std::vector<std::size_t>{4, 4, 2}));
+            MORE_CONCEPTS_CHECK(sum == 45);
+
+            vec.for_each_segment([](std::span<int> const segment) {
+                for (auto& value : segment)
+                {
+                    value *= 2;
+                }
+            });
+            MORE_CONCEPTS_CHECK(vec[9] == 18);
+            MORE_CONCEPTS_CHECK(vec.end() - vec.begin() == 10);
+            MORE_CONCEPTS_CHECK(vec.begin()[5] == 10);
+
+            auto empty = more_concepts::segmented_vector<int, 4>{};
+            auto calls = 0;
+            empty.for_each_segment([&](std::span<int>) { ++calls; });
+            MORE_CONCEPTS_CHECK(calls == 0);
+        },
+    };
+
+    more_concepts_tests::register_test_case append_range{
+        "segmented_vector append_range",
+        [] {
+            auto vec = more_concepts::segmented_vector<int, 4>(16);
+            MORE_CONCEPTS_CHECK(vec.capacity() == 16);
+
+            // Only the chunks for the new elements are allocated, not double the capacity.
+            more_concepts::append_range(vec, std::vector<int>{1, 2, 3, 4, 5});
+            MORE_CONCEPTS_CHECK(vec.size() == 21 and vec.capacity() == 24);
+            MORE_CONCEPTS_CHECK(vec[16] == 1 and vec[20] == 5);
+
+            more_concepts::append_range(vec, std::vector<int>{6, 7, 8});
+            MORE_CONCEPTS_CHECK(vec.size() == 24 and vec.capacity() == 24);
+        },
+    };
+
+    more_concepts_tests::register_test_case copy_move_and_compare{
+        "segmented_vector copy, move and comparison",
+        [] {
+            auto vec = more_concepts::segmented_vector<std::string, 2>{"a", "b", "c"};
+            auto copy = vec;
+            MORE_CONCEPTS_CHECK(copy == vec);
+            copy.push_back("d");
+            MORE_CONCEPTS_CHECK(vec < copy);
+
+            auto* const element = &copy[1];
+            auto moved = std::move(copy);
+            MORE_CONCEPTS_CHECK(copy.empty());
+            MORE_CONCEPTS_CHECK(&moved[1] == element);
+
+            copy = moved;
+            MORE_CONCEPTS_CHECK(copy == moved);
+            vec = std::move(moved);
+            MORE_CONCEPTS_CHECK(vec == copy);
+
+            swap(vec, moved);
+            MORE_CONCEPTS_CHECK(vec.empty() and moved == copy);
+
+            vec.assign(3, "x");
+            MORE_CONCEPTS_CHECK((vec == more_concepts::segmented_vector<std::string, 2>{"x", "x", "x"}));
+        },
+    };
+
+    more_concepts_tests::register_test_case memory_resource{
+        "segmented_vector with a memory resource",
+        [] {
+            auto buffer = std::array<std::byte, 4096>{};
+            auto resource = std::pmr::monotonic_buffer_resource{buffer.data(), buffer.size()};
+            using vector = more_concepts::segmented_vector<int, 16, std::pmr::polymorphic_allocator<int>>;
+
+            auto vec = vector(&resource);
+            for (auto i = 0; i < 100; ++i)
+            {
+                vec.push_back(i);
+            }
+            auto copy = vector(vec, &resource);
+            MORE_CONCEPTS_CHECK(copy.get_allocator().resource() == &resource);
+            MORE_CONCEPTS_CHECK(copy == vec);
+
+            auto other = vector(std::move(vec), std::pmr::new_delete_resource());
+            MORE_CONCEPTS_CHECK(other == copy);
+            MORE_CONCEPTS_CHECK(vec.empty());
+        },
+    };
+}
@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <set>
+#include <vector>
+
+#include "more_concepts/simd_algorithms.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    static_assert(more_concepts::detail::simd_scannable_container<std::vector<std::uint32_t>>);
+    static_assert(more_concepts::detail::simd_scannable_container<std::array<double, 4>>);
+    static_assert(not more_concepts::detail::simd_scannable_container<std::vector<bool>>);
+    static_assert(not more_concepts::detail::simd_scannable_container<std::vector<long double>>);
+    static_assert(not more_concepts::detail::simd_scannable_container<std::deque<int>>);
+    static_assert(not more_concepts::detail::simd_scannable_container<std::vector<int*>>);
+
+    // The generic fallbacks are usable in constant expressions.
+    constexpr auto constexpr_simd_test() -> bool
+    {
+        auto const values = std::array<int, 5>{3, 1, 4, 1, 5};
+        return more_concepts::find(values, 4) == values.begin() + 2 and
+               more_concepts::count(values, 1) == 2 and
+               more_concepts::contains(values, 5) and
+               more_concepts::min_element(values) == values.begin() + 1 and
+               more_concepts::max_element(values) == values.begin() + 4 and
+               more_concepts::accumulate(values, 0) == 14;
+    }
+
+    static_assert(constexpr_simd_test());
+
+    /// Checks all algorithms against the standard ones, for every size up to a few vectors,
+    /// so that both the vectorized loop and the scalar tail are covered.
+    template <typename T>
+    auto check_against_std(std::vector<T> const& pattern) -> void
+    {
+        for (auto size = std::size_t{0}; size <= pattern.size(); ++size)
+        {
+            auto values = std::vector<T>(pattern.begin(), pattern.begin() + static_cast<std::ptrdiff_t>(size));
+
+            for (auto const& value : pattern)
+            {
+                MORE_CONCEPTS_CHECK(more_concepts::find(values, value) == std::find(values.begin(), values.end(), value));
+                MORE_CONCEPTS_CHECK(more_concepts::count(values, value) ==
+                                    static_cast<std::size_t>(std::count(values.begin(), values.end(), value)));
+            }
+
+            MORE_CONCEPTS_CHECK(more_concepts::min_element(values) == std::min_element(values.begin(), values.end()));
+            MORE_CONCEPTS_CHECK(more_concepts::max_element(values) == std::max_element(values.begin(), values.end()));
+
+            // Signed overflow would be undefined behavior in std::accumulate.
+            if constexpr (std::unsigned_integral<T>)
+            {
+                MORE_CONCEPTS_CHECK(more_concepts::accumulate(values, T{1}) ==
+                                    std::accumulate(values.begin(), values.end(), T{1}));
+            }
+
+#ifdef MORE_CONCEPTS_DETAIL_SIMD_X86
+            // The baseline kernels, in case the AVX2 ones are selected at runtime.
+            if (size > 0)
+            {
+                auto const* const first = values.data();
+                auto const* const last = first + size;
+                MORE_CONCEPTS_CHECK(more_concepts::detail::simd::find_kernel<16>(first, last, pattern.back()) ==
+                                    std::find(first, last, pattern.back()));
+                MORE_CONCEPTS_CHECK(more_concepts::detail::simd::count_kernel<16>(first, last, pattern.back()) ==
+                                    static_cast<std::size_t>(std::count(first, last, pattern.back())));
+                auto const min = more_concepts::detail::simd::extremum_kernel<16, false>(first, last);
+                auto const max = more_concepts::detail::simd::extremum_kernel<16, true>(first, last);
+                MORE_CONCEPTS_CHECK(std::find(first, last, min) == std::min_element(first, last) or min != min);
+                MORE_CONCEPTS_CHECK(std::find(first, last, max) == std::max_element(first, last) or max != max);
+            }
+#endif
+        }
+    }
+
+    template <typename T>
+    auto integral_pattern() -> std::vector<T>
+    {
+        auto pattern = std::vector<T>(80);
+        for (auto i = std::size_t{0}; i < pattern.size(); ++i)
+        {
+            pattern[i] = static_cast<T>((i * 37u + 11u) % 23u);
+        }
+        pattern[50] = std::numeric_limits<T>::max();
+        pattern[61] = std::numeric_limits<T>::min();
+        return pattern;
+    }
+
+    auto test_simd_integral() -> void
+    {
+        check_against_std(integral_pattern<std::int8_t>());
+        check_against_std(integral_pattern<std::uint8_t>());
+        check_against_std(integral_pattern<std::int16_t>());
+        check_against_std(integral_pattern<std::uint32_t>());
+        check_against_std(integral_pattern<std::int64_t>());
+        check_against_std(integral_pattern<std::uint64_t>());
+        check_against_std(integral_pattern<char>());
+    }
+
+    auto test_simd_floating_point() -> void
+    {
+        auto const nan = std::numeric_limits<double>::quiet_NaN();
+        auto pattern = std::vector<double>(40);
+        for (auto i = std::size_t{0}; i < pattern.size(); ++i)
+        {
+            pattern[i] = static_cast<double>((i * 7u) % 13u) - 6.0;
+        }
+        pattern[9] = nan;
+        pattern[20] = -0.0;
+        check_against_std(pattern);
+
+        // A leading NaN is returned by both min_element and max_element, like the standard algorithms.
+        pattern[0] = nan;
+        check_against_std(pattern);
+        MORE_CONCEPTS_CHECK(more_concepts::min_element(pattern) == pattern.begin());
+
+        auto floats = std::vector<float>(pattern.begin(), pattern.end());
+        floats[0] = 0.0f;
+        check_against_std(floats);
+        MORE_CONCEPTS_CHECK(not more_concepts::contains(floats, static_cast<float>(nan)));
+
+        // Floating point sums are not reassociated.
+        auto const sums = std::vector<double>{1e100, 1.0, -1e100, 1.0};
+        MORE_CONCEPTS_CHECK(more_concepts::accumulate(sums, 0.0) == 1.0);
+    }
+
+    auto test_simd_wraparound() -> void
+    {
+        auto const bytes = std::vector<std::uint8_t>(1000, 255);
+        MORE_CONCEPTS_CHECK(more_concepts::accumulate(bytes, std::uint8_t{0}) ==
+                            std::accumulate(bytes.begin(), bytes.end(), std::uint8_t{0}));
+        auto const ints = std::vector<int>{-5, 3, 8, -2, 7, 1, 1, -9, 4, 6, 0};
+        MORE_CONCEPTS_CHECK(more_concepts::accumulate(ints, 10) == 24);
+
+        // Accumulating into a different type does not wrap around.
+        MORE_CONCEPTS_CHECK(more_concepts::accumulate(bytes, 0) == 255'000);
+    }
+
+    auto test_simd_fallback() -> void
+    {
+        auto deque = std::deque<int>{4, 2, 7, 2};
+        MORE_CONCEPTS_CHECK(more_concepts::find(deque, 7) == deque.begin() + 2);
+        MORE_CONCEPTS_CHECK(more_concepts::count(deque, 2) == 2);
+        MORE_CONCEPTS_CHECK(more_concepts::min_element(deque) == deque.begin() + 1);
+        MORE_CONCEPTS_CHECK(more_concepts::max_element(deque) == deque.begin() + 2);
+        MORE_CONCEPTS_CHECK(more_concepts::accumulate(deque, 0) == 15);
+
+        auto const list = std::list<int>{1, 2, 3};
+        MORE_CONCEPTS_CHECK(more_concepts::contains(list, 3));
+        MORE_CONCEPTS_CHECK(not more_concepts::contains(std::set<int>{1, 2}, 3));
+
+        auto empty = std::vector<int>{};
+        MORE_CONCEPTS_CHECK(more_concepts::min_element(empty) == empty.end());
+        MORE_CONCEPTS_CHECK(more_concepts::find(empty, 0) == empty.end());
+
+        // Mutable access through the returned iterator.
+        auto values = std::vector<int>{1, 2, 3};
+        *more_concepts::find(values, 2) = 5;
+        *more_concepts::max_element(values) = 0;
+        MORE_CONCEPTS_CHECK((values == std::vector<int>{1, 0, 3}));
+    }
+
+    auto const simd_algorithm_tests = more_concepts_tests::register_test_case{
+        "simd_algorithms",
+        [] {
+            test_simd_integral();
+            test_simd_floating_point();
+            test_simd_wraparound();
+            test_simd_fallback();
+        }};
+}
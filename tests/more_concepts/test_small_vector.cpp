@@ -0,0 +1,290 @@
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "more_concepts/small_vector.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    /// Counts the allocations made through it.
+    template <typename T>
+    struct counting_allocator
+    {
+        using value_type = T;
+
+        int* allocations;
+
+        explicit counting_allocator(int* const allocations) noexcept
+            : allocations{allocations}
+        {
+        }
+
+        template <typename U>
+        explicit counting_allocator(counting_allocator<U> const& other) noexcept
+            : allocations{other.allocations}
+        {
+        }
+
+        auto allocate(std::size_t const n) -> T*
+        {
+            ++*allocations;
+            return std::allocator<T>{}.allocate(n);
+        }
+
+        auto deallocate(T* const ptr, std::size_t const n) noexcept -> void
+        {
+            std::allocator<T>{}.deallocate(ptr, n);
+        }
+
+        friend auto operator==(counting_allocator const&, counting_allocator const&) -> bool = default;
+    };
+
+    /// A stateful allocator that is propagated on swap, and only equal to its own copies.
+    template <typename T>
+    struct swapped_allocator : counting_allocator<T>
+    {
+        using propagate_on_container_swap = std::true_type;
+
+        int id;
+
+        swapped_allocator(int* const allocations, int const id) noexcept
+            : counting_allocator<T>{allocations}, id{id}
+        {
+        }
+
+        template <typename U>
+        explicit swapped_allocator(swapped_allocator<U> const& other) noexcept
+            : counting_allocator<T>{other}, id{other.id}
+        {
+        }
+
+        friend auto operator==(swapped_allocator const&, swapped_allocator const&) -> bool = default;
+    };
+
+    /// A type whose move constructor may throw, so that reallocation copies it.
+    struct throwing_move
+    {
+        std::string value;
+
+        explicit throwing_move(std::string value)
+            : value{std::move(value)}
+        {
+        }
+
+        throwing_move(throwing_move const&) = default;
+
+        throwing_move(throwing_move&& other) noexcept(false)
+            : value{std::move(other.value)}
+        {
+        }
+
+        auto operator=(throwing_move const&) -> throwing_move& = default;
+        auto operator=(throwing_move&&) -> throwing_move& = default;
+
+        friend auto operator==(throwing_move const&, throwing_move const&) -> bool = default;
+    };
+
+    template <typename T, std::size_t N, typename MakeValue>
+    auto check_against_vector(MakeValue make_value) -> void
+    {
+        auto vec = more_concepts::small_vector<T, N>{};
+        auto reference = std::vector<T>{};
+        auto const check = [&] {
+            MORE_CONCEPTS_CHECK(vec.size() == reference.size());
+            MORE_CONCEPTS_CHECK(std::equal(vec.begin(), vec.end(), reference.begin(), reference.end()));
+            MORE_CONCEPTS_CHECK(vec.is_inline() == (vec.capacity() == N));
+        };
+
+        auto state = 7u;
+        for (auto i = 0; i < 2000; ++i)
+        {
+            state = state * 1103515245u + 12345u;
+            auto const roll = (state >> 8u) % 12u;
+            auto const pos = reference.empty() ? 0 : (state >> 16u) % reference.size();
+            auto const value = make_value(static_cast<int>(i));
+
+            switch (roll)
+            {
+            case 0:
+            case 1:
+            case 2:
+                vec.push_back(value);
+                reference.push_back(value);
+                break;
+            case 3:
+                vec.insert(vec.begin() + pos, value);
+                reference.insert(reference.begin() + pos, value);
+                break;
+            case 4:
+                vec.insert(vec.begin() + pos, 3, value);
+                reference.insert(reference.begin() + pos, 3, value);
+                break;
+            case 5:
+            {
+                auto const values = std::vector<T>(pos % 5, value);
+                vec.insert(vec.begin() + pos, values.begin(), values.end());
+                reference.insert(reference.begin() + pos, values.begin(), values.end());
+                break;
+            }
+            case 6:
+                if (not reference.empty())
+                {
+                    vec.erase(vec.begin() + pos);
+                    reference.erase(reference.begin() + pos);
+                }
+                break;
+            case 7:
+            {
+                auto const last = std::min(pos + 4, reference.size());
+                vec.erase(vec.begin() + pos, vec.begin() + last);
+                reference.erase(reference.begin() + pos, reference.begin() + last);
+                break;
+            }
+            case 8:
+                if (not reference.empty())
+                {
+                    // Aliasing an element, possibly while reallocating.
+                    vec.push_back(vec[pos]);
+                    reference.push_back(reference[pos]);
+                    vec.insert(vec.begin(), vec.back());
+                    reference.insert(reference.begin(), reference.back());
+                }
+                break;
+            case 9:
+                vec.resize(pos + 2, value);
+                reference.resize(pos + 2, value);
+                break;
+            case 10:
+                vec.shrink_to_fit();
+                break;
+            default:
+                if (reference.size() > 3 * N)
+                {
+                    vec.assign(N - 1, value);
+                    reference.assign(N - 1, value);
+                }
+                break;
+            }
+            check();
+        }
+
+        auto copy = vec;
+        MORE_CONCEPTS_CHECK(copy == vec);
+        auto moved = std::move(copy);
+        MORE_CONCEPTS_CHECK(copy.empty() and moved == vec);
+    }
+
+    auto test_small_vector_inline_storage() -> void
+    {
+        auto allocations = 0;
+        using vector = more_concepts::small_vector<int, 4, counting_allocator<int>>;
+        auto vec = vector(counting_allocator<int>{&allocations});
+
+        for (auto i = 0; i < 4; ++i)
+        {
+            vec.emplace_back(i);
+        }
+        MORE_CONCEPTS_CHECK(allocations == 0 and vec.is_inline() and vec.capacity() == 4);
+
+        vec.push_back(4);
+        MORE_CONCEPTS_CHECK(allocations == 1 and not vec.is_inline() and vec.capacity() >= 5);
+        MORE_CONCEPTS_CHECK((vec == vector({0, 1, 2, 3, 4}, counting_allocator<int>{&allocations})));
+
+        // Moving a heap-allocated vector takes its buffer.
+        auto const* const buffer = vec.data();
+        auto moved = std::move(vec);
+        MORE_CONCEPTS_CHECK(moved.data() == buffer and vec.empty() and vec.is_inline());
+
+        moved.erase(moved.begin() + 1, moved.end());
+        moved.shrink_to_fit();
+        MORE_CONCEPTS_CHECK(moved.is_inline() and moved.size() == 1 and moved.front() == 0);
+
+        moved.reserve(100);
+        MORE_CONCEPTS_CHECK(moved.capacity() == 100 and moved.front() == 0);
+    }
+
+    auto test_small_vector_swap_propagating_allocator() -> void
+    {
+        auto allocations = 0;
+        using vector = more_concepts::small_vector<int, 2, swapped_allocator<int>>;
+        static_assert(noexcept(std::declval<vector&>().swap(std::declval<vector&>())));
+
+        auto inline_vec = vector({1}, swapped_allocator<int>{&allocations, 1});
+        auto heap_vec = vector({2, 3, 4}, swapped_allocator<int>{&allocations, 2});
+        auto const* const buffer = heap_vec.data();
+        allocations = 0;
+
+        // The heap buffer moves with its allocator, and nothing is allocated.
+        inline_vec.swap(heap_vec);
+        MORE_CONCEPTS_CHECK(allocations == 0);
+        MORE_CONCEPTS_CHECK(inline_vec.get_allocator().id == 2 and heap_vec.get_allocator().id == 1);
+        MORE_CONCEPTS_CHECK(inline_vec.data() == buffer and inline_vec.size() == 3 and inline_vec.back() == 4);
+        MORE_CONCEPTS_CHECK(heap_vec.is_inline() and heap_vec.size() == 1 and heap_vec.front() == 1);
+
+        swap(inline_vec, heap_vec);
+        MORE_CONCEPTS_CHECK(allocations == 0);
+        MORE_CONCEPTS_CHECK(inline_vec.get_allocator().id == 1 and inline_vec.is_inline() and inline_vec.front() == 1);
+        MORE_CONCEPTS_CHECK(heap_vec.get_allocator().id == 2 and heap_vec.data() == buffer and heap_vec.size() == 3);
+
+        auto other_heap_vec = vector({5, 6, 7}, swapped_allocator<int>{&allocations, 3});
+        allocations = 0;
+        heap_vec.swap(other_heap_vec);
+        MORE_CONCEPTS_CHECK(allocations == 0);
+        MORE_CONCEPTS_CHECK(heap_vec.get_allocator().id == 3 and heap_vec.front() == 5);
+        MORE_CONCEPTS_CHECK(other_heap_vec.get_allocator().id == 2 and other_heap_vec.data() == buffer);
+    }
+
+    auto test_small_vector_interface() -> void
+    {
+        using vector = more_concepts::small_vector<std::string, 2>;
+        auto vec = vector{"a", "b", "c"};
+        MORE_CONCEPTS_CHECK(vec.at(2) == "c" and vec.back() == "c" and *vec.rbegin() == "c");
+
+        auto thrown = false;
+        try
+        {
+            static_cast<void>(vec.at(3));
+        }
+        catch (std::out_of_range const&)
+        {
+            thrown = true;
+        }
+        MORE_CONCEPTS_CHECK(thrown);
+
+        MORE_CONCEPTS_CHECK(*vec.emplace(vec.begin() + 1, 3, 'x') == "xxx");
+        MORE_CONCEPTS_CHECK((vec == vector{"a", "xxx", "b", "c"}));
+        MORE_CONCEPTS_CHECK(vec < vector{"b"} and vector{"a", "y"} > vec);
+
+        auto inline_vec = vector{"d"};
+        swap(vec, inline_vec);
+        MORE_CONCEPTS_CHECK(vec.size() == 1 and inline_vec.size() == 4);
+        vec.swap(inline_vec);
+        MORE_CONCEPTS_CHECK(vec.size() == 4 and inline_vec.front() == "d");
+
+        vec = {"e"};
+        MORE_CONCEPTS_CHECK(vec.size() == 1 and vec.front() == "e");
+        vec.pop_back();
+        MORE_CONCEPTS_CHECK(vec.empty());
+
+        auto const sized = more_concepts::small_vector<int, 0>(5);
+        MORE_CONCEPTS_CHECK(sized.size() == 5 and sized[4] == 0);
+    }
+
+    auto const small_vector_tests = more_concepts_tests::register_test_case{
+        "small_vector",
+        [] {
+            check_against_vector<int, 4>([](int const i) { return i; });
+            check_against_vector<std::string, 3>([](int const i) { return std::string(20, static_cast<char>('a' + i % 26)); });
+            check_against_vector<throwing_move, 2>([](int const i) { return throwing_move{std::to_string(i)}; });
+            check_against_vector<std::shared_ptr<int>, 8>([](int const i) { return std::make_shared<int>(i); });
+            test_small_vector_inline_storage();
+            test_small_vector_swap_propagating_allocator();
+            test_small_vector_interface();
+        }};
+}
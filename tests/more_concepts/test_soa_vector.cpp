@@ -0,0 +1,223 @@
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "more_concepts/base_containers.hpp"
+#include "more_concepts/columnar_containers.hpp"
+#include "more_concepts/soa_vector.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    using particles = more_concepts::soa_vector<float, float, std::string>;
+
+    static_assert(more_concepts::columnar_container<particles>);
+    static_assert(more_concepts::columnar_container_of<particles, float, float, std::string>);
+    static_assert(not more_concepts::columnar_container_of<particles, float, std::string>);
+    static_assert(not more_concepts::columnar_container_of<particles, float, float, int>);
+    static_assert(std::same_as<more_concepts::column_t<particles, 2>, std::span<std::string>>);
+    static_assert(std::same_as<more_concepts::column_t<particles const, 2>, std::span<std::string const>>);
+    static_assert(not more_concepts::container<particles>);
+
+    /// A type whose copies throw once copies_left reaches zero, and whose move constructor
+    /// may throw, so that reallocation copies it.
+    struct fragile
+    {
+        static inline auto copies_left = -1;
+
+        int value;
+
+        explicit fragile(int const value)
+            : value{value}
+        {
+        }
+
+        fragile(fragile const& other)
+            : value{other.value}
+        {
+            if (copies_left == 0)
+            {
+                throw std::runtime_error{"copy failed"};
+            }
+            --copies_left;
+        }
+
+        fragile(fragile&& other) noexcept(false)
+            : value{other.value}
+        {
+        }
+
+        auto operator=(fragile const&) -> fragile& = default;
+        auto operator=(fragile&&) -> fragile& = default;
+
+        friend auto operator==(fragile const&, fragile const&) -> bool = default;
+    };
+
+    more_concepts_tests::register_test_case push_back_and_columns{
+        "soa_vector push_back and columns",
+        [] {
+            auto vec = particles{};
+            MORE_CONCEPTS_CHECK(vec.empty());
+
+            for (auto i = 0; i < 100; ++i)
+            {
+                vec.emplace_back(static_cast<float>(i), static_cast<float>(2 * i), std::to_string(i));
+            }
+            MORE_CONCEPTS_CHECK(vec.size() == 100);
+            MORE_CONCEPTS_CHECK(vec.capacity() >= 100);
+
+            auto const xs = vec.column<0>();
+            auto const ys = vec.column<1>();
+            MORE_CONCEPTS_CHECK(xs.size() == 100 and ys.size() == 100);
+            MORE_CONCEPTS_CHECK(std::accumulate(xs.begin(), xs.end(), 0.0f) == 4950.0f);
+            MORE_CONCEPTS_CHECK(std::accumulate(ys.begin(), ys.end(), 0.0f) == 9900.0f);
+            MORE_CONCEPTS_CHECK(vec.column<std::string>()[42] == "42");
+
+            auto [x, y, name] = vec[7];
+            x = -1.0f;
+            name = "seven";
+            MORE_CONCEPTS_CHECK(vec.column<0>()[7] == -1.0f);
+            MORE_CONCEPTS_CHECK(std::get<2>(std::as_const(vec)[7]) == "seven");
+            MORE_CONCEPTS_CHECK(std::get<1>(vec.front()) == 0.0f);
+            MORE_CONCEPTS_CHECK(std::get<2>(vec.back()) == "99");
+
+            vec.push_back({1.0f, 2.0f, "pushed"});
+            MORE_CONCEPTS_CHECK(vec.size() == 101);
+            MORE_CONCEPTS_CHECK(std::get<2>(vec.at(100)) == "pushed");
+
+            auto threw = false;
+            try
+            {
+                std::ignore = vec.at(101);
+            }
+            catch (std::out_of_range const&)
+            {
+                threw = true;
+            }
+            MORE_CONCEPTS_CHECK(threw);
+        },
+    };
+
+    more_concepts_tests::register_test_case aliasing{
+        "soa_vector emplace_back of its own element",
+        [] {
+            auto vec = more_concepts::soa_vector<int, std::string>{};
+            vec.emplace_back(1, std::string(100, 'a'));
+            vec.shrink_to_fit();
+            MORE_CONCEPTS_CHECK(vec.capacity() == 1);
+
+            // Reallocates, while the arguments refer to the old columns.
+            auto const [number, text] = vec.front();
+            vec.emplace_back(number, text);
+            MORE_CONCEPTS_CHECK(vec.size() == 2);
+            MORE_CONCEPTS_CHECK(std::get<1>(vec[1]) == std::string(100, 'a'));
+            MORE_CONCEPTS_CHECK(std::get<0>(vec[1]) == 1);
+        },
+    };
+
+    more_concepts_tests::register_test_case erase_and_resize{
+        "soa_vector erase, swap_erase and resize",
+        [] {
+            auto vec = more_concepts::soa_vector<int, std::string>{};
+            for (auto i = 0; i < 10; ++i)
+            {
+                vec.emplace_back(i, std::to_string(i));
+            }
+
+            vec.erase(2);
+            MORE_CONCEPTS_CHECK(vec.size() == 9);
+            MORE_CONCEPTS_CHECK(vec.column<0>()[2] == 3);
+            MORE_CONCEPTS_CHECK(vec.column<1>()[2] == "3");
+
+            vec.swap_erase(0);
+            MORE_CONCEPTS_CHECK(vec.size() == 8);
+            MORE_CONCEPTS_CHECK(vec.column<0>()[0] == 9);
+            MORE_CONCEPTS_CHECK(vec.column<1>()[0] == "9");
+
+            vec.pop_back();
+            MORE_CONCEPTS_CHECK(vec.size() == 7);
+            MORE_CONCEPTS_CHECK(std::get<1>(vec.back()) == "7");
+
+            vec.resize(20);
+            MORE_CONCEPTS_CHECK(vec.size() == 20);
+            MORE_CONCEPTS_CHECK(vec.column<0>()[19] == 0 and vec.column<1>()[19].empty());
+            vec.resize(3);
+            MORE_CONCEPTS_CHECK(vec.size() == 3);
+            MORE_CONCEPTS_CHECK(vec.column<1>()[2] == "3");
+
+            vec.clear();
+            MORE_CONCEPTS_CHECK(vec.empty() and vec.column<0>().empty());
+        },
+    };
+
+    more_concepts_tests::register_test_case copy_and_move{
+        "soa_vector copy and move",
+        [] {
+            auto vec = more_concepts::soa_vector<int, std::string>(5);
+            for (auto i = 0; i < 5; ++i)
+            {
+                vec.column<0>()[static_cast<std::size_t>(i)] = i;
+                vec.column<1>()[static_cast<std::size_t>(i)] = std::string(50, static_cast<char>('a' + i));
+            }
+
+            auto copy = vec;
+            MORE_CONCEPTS_CHECK(copy == vec);
+            copy.column<0>()[0] = 42;
+            MORE_CONCEPTS_CHECK(copy != vec);
+
+            auto moved = std::move(copy);
+            MORE_CONCEPTS_CHECK(copy.empty());
+            MORE_CONCEPTS_CHECK(moved.column<0>()[0] == 42);
+
+            copy = vec;
+            MORE_CONCEPTS_CHECK(copy == vec);
+            moved = std::move(copy);
+            MORE_CONCEPTS_CHECK(moved == vec);
+
+            swap(moved, copy);
+            MORE_CONCEPTS_CHECK(moved.empty() and copy == vec);
+        },
+    };
+
+    more_concepts_tests::register_test_case strong_guarantee{
+        "soa_vector reallocation provides the strong exception guarantee",
+        [] {
+            auto vec = more_concepts::soa_vector<std::string, fragile>{};
+            for (auto i = 0; i < 8; ++i)
+            {
+                vec.emplace_back(std::to_string(i), fragile{i});
+            }
+            vec.shrink_to_fit();
+
+            fragile::copies_left = 3;
+            auto threw = false;
+            try
+            {
+                vec.reserve(64);
+            }
+            catch (std::runtime_error const&)
+            {
+                threw = true;
+            }
+            fragile::copies_left = -1;
+
+            MORE_CONCEPTS_CHECK(threw);
+            MORE_CONCEPTS_CHECK(vec.size() == 8 and vec.capacity() == 8);
+            for (auto i = 0; i < 8; ++i)
+            {
+                auto const index = static_cast<std::size_t>(i);
+                MORE_CONCEPTS_CHECK(vec.column<0>()[index] == std::to_string(i));
+                MORE_CONCEPTS_CHECK(vec.column<1>()[index].value == i);
+            }
+
+            vec.reserve(64);
+            MORE_CONCEPTS_CHECK(vec.capacity() == 64);
+            MORE_CONCEPTS_CHECK(vec.column<1>()[7].value == 7);
+        },
+    };
+}
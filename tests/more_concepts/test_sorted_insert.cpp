@@ -0,0 +1,96 @@
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "more_concepts/flat_map.hpp"
+#include "more_concepts/flat_set.hpp"
+#include "more_concepts/sorted_insert.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    /// Counts the comparisons made by a container.
+    struct counting_less
+    {
+        std::size_t* comparisons = nullptr;
+
+        auto operator()(int const lhs, int const rhs) const -> bool
+        {
+            ++*comparisons;
+            return lhs < rhs;
+        }
+    };
+
+    auto test_node_containers() -> void
+    {
+        constexpr auto count = 10'000;
+        auto sorted = std::vector<std::pair<int, std::string>>{};
+        for (auto i = 0; i < count; ++i)
+        {
+            sorted.emplace_back(i * 2, std::to_string(i));
+        }
+
+        auto comparisons = std::size_t{0};
+        auto const map = more_concepts::make_sorted<std::map<int, std::string, counting_less>>(
+            more_concepts::sorted_unique, sorted.begin(), sorted.end(), counting_less{&comparisons});
+        MORE_CONCEPTS_CHECK(map.size() == count and map.at(200) == "100");
+        // Hinted insertion compares with the neighbors only, instead of O(log n) times.
+        MORE_CONCEPTS_CHECK(comparisons <= 4 * count);
+
+        // Values interleaved with the elements are inserted correctly.
+        auto interleaved = std::map<int, std::string>(sorted.begin(), sorted.begin() + 10);
+        auto const odd = std::vector<std::pair<int, std::string>>{{-1, "a"}, {3, "b"}, {4, "c"}, {7, "d"}, {100, "e"}};
+        more_concepts::insert_sorted(interleaved, odd.begin(), odd.end());
+        MORE_CONCEPTS_CHECK(interleaved.size() == 14 and interleaved.at(4) == "2");
+        MORE_CONCEPTS_CHECK(interleaved.begin()->second == "a" and interleaved.rbegin()->second == "e");
+
+        // Equivalent values keep their order.
+        auto const duplicates = std::vector<std::pair<int, std::string>>{{1, "a"}, {1, "b"}, {2, "c"}, {2, "d"}};
+        auto multimap = more_concepts::make_sorted<std::multimap<int, std::string>>(
+            more_concepts::sorted_equivalent, duplicates.begin(), duplicates.end());
+        MORE_CONCEPTS_CHECK(multimap.size() == 4 and multimap.find(1)->second == "a");
+        MORE_CONCEPTS_CHECK(std::next(multimap.find(2))->second == "d");
+
+        auto set = std::set<std::string>{"b"};
+        auto const words = std::vector<std::string>{"a", "b", "c"};
+        more_concepts::insert_sorted(set, more_concepts::sorted_unique, words.begin(), words.end());
+        MORE_CONCEPTS_CHECK((set == std::set<std::string>{"a", "b", "c"}));
+    }
+
+    auto test_flat_containers() -> void
+    {
+        auto const sorted = std::vector<std::pair<int, int>>{{1, 10}, {3, 30}, {5, 50}};
+
+        auto comparisons = std::size_t{0};
+        auto map = more_concepts::make_sorted<more_concepts::flat_map<int, int, counting_less>>(
+            more_concepts::sorted_unique, sorted.begin(), sorted.end(), counting_less{&comparisons});
+        MORE_CONCEPTS_CHECK(map.size() == 3 and map.at(3) == 30);
+
+        auto const more = std::vector<std::pair<int, int>>{{0, 0}, {3, 31}, {4, 40}, {9, 90}};
+        more_concepts::insert_sorted(map, more_concepts::sorted_unique, more.begin(), more.end());
+        MORE_CONCEPTS_CHECK(map.size() == 6 and map.at(3) == 30 and map.at(4) == 40);
+        MORE_CONCEPTS_CHECK(std::is_sorted(map.begin(), map.end()));
+
+        auto adopted = more_concepts::flat_map<int, int>(more_concepts::sorted_unique, sorted);
+        MORE_CONCEPTS_CHECK(adopted.size() == 3 and adopted.sequence() == sorted);
+
+        auto set = more_concepts::flat_set<int, std::greater<>>(
+            more_concepts::sorted_unique, std::vector<int>{5, 3, 1});
+        auto const values = std::vector<int>{6, 5, 2};
+        more_concepts::insert_sorted(set, values.begin(), values.end());
+        MORE_CONCEPTS_CHECK((set.sequence() == std::vector<int>{6, 5, 3, 2, 1}));
+    }
+
+    auto const sorted_insert_tests = more_concepts_tests::register_test_case{
+        "sorted_insert",
+        [] {
+            test_node_containers();
+            test_flat_containers();
+        }};
+}
@@ -0,0 +1,112 @@
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "more_concepts/associative_containers.hpp"
+#include "more_concepts/flat_hash_map.hpp"
+#include "more_concepts/flat_map.hpp"
+#include "more_concepts/flat_set.hpp"
+#include "more_concepts/string_map.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    using namespace std::string_view_literals;
+
+    static_assert(more_concepts::transparent_function<std::less<>>);
+    static_assert(more_concepts::transparent_function<more_concepts::string_hash>);
+    static_assert(not more_concepts::transparent_function<std::less<std::string>>);
+
+    static_assert(more_concepts::transparent_lookup_container<more_concepts::string_map<int>, std::string_view>);
+    static_assert(more_concepts::transparent_lookup_container<more_concepts::string_map<int>, char const*>);
+    static_assert(more_concepts::transparent_lookup_container<more_concepts::string_multimap<int>, std::string_view>);
+    static_assert(more_concepts::transparent_lookup_container<more_concepts::string_set, std::string_view>);
+    static_assert(more_concepts::transparent_lookup_container<more_concepts::unordered_string_map<int>, std::string_view>);
+    static_assert(more_concepts::transparent_lookup_container<
+        more_concepts::unordered_string_multimap<int>, std::string_view>);
+    static_assert(more_concepts::transparent_lookup_container<more_concepts::unordered_string_set, std::string_view>);
+    static_assert(more_concepts::transparent_lookup_container<
+        more_concepts::flat_map<std::string, int, std::less<>>, std::string_view>);
+    static_assert(more_concepts::transparent_lookup_container<
+        more_concepts::flat_set<std::string, std::less<>>, std::string_view>);
+    static_assert(more_concepts::transparent_lookup_container<
+        more_concepts::flat_hash_map<std::string, int, more_concepts::string_hash, std::equal_to<>>, std::string_view>);
+
+    // Without transparent functions, the keys would be converted to std::string.
+    static_assert(not more_concepts::transparent_lookup_container<std::map<std::string, int>, std::string_view>);
+    static_assert(not more_concepts::transparent_lookup_container<std::map<std::string, int>, char const*>);
+    static_assert(not more_concepts::transparent_lookup_container<std::unordered_map<std::string, int>, std::string_view>);
+    static_assert(not more_concepts::transparent_lookup_container<
+        std::unordered_map<std::string, int, more_concepts::string_hash>, std::string_view>);
+    static_assert(not more_concepts::transparent_lookup_container<more_concepts::flat_map<std::string, int>, std::string_view>);
+    static_assert(not more_concepts::transparent_lookup_container<
+        more_concepts::flat_hash_map<std::string, int>, std::string_view>);
+
+    /// Looks up string_view tokens, the way a parser would.
+    template <more_concepts::transparent_lookup_container<std::string_view> Map>
+    auto check_lookup(Map& map) -> void
+    {
+        auto const text = "let value = other"sv;
+        auto const token = text.substr(4, 5);
+        MORE_CONCEPTS_CHECK(map.contains(token) and map.count(token) == 1);
+        MORE_CONCEPTS_CHECK(map.find(token) != map.end() and map.find(token)->second == 2);
+        MORE_CONCEPTS_CHECK(std::as_const(map).find(text.substr(12)) == map.end());
+        MORE_CONCEPTS_CHECK(not map.contains(text.substr(4, 4)));
+
+        auto const [first, last] = map.equal_range(text.substr(0, 3));
+        MORE_CONCEPTS_CHECK(first != last and first->second == 1 and std::next(first) == last);
+        MORE_CONCEPTS_CHECK(map.equal_range(text.substr(12)).first == map.equal_range(text.substr(12)).second);
+        MORE_CONCEPTS_CHECK(map.contains("let"));
+    }
+
+    auto test_transparent_lookup() -> void
+    {
+        auto ordered = more_concepts::string_map<int>{{"let", 1}, {"value", 2}, {"zeta", 3}};
+        check_lookup(ordered);
+        MORE_CONCEPTS_CHECK(ordered.lower_bound("w"sv)->first == "zeta");
+
+        auto unordered = more_concepts::unordered_string_map<int>{{"let", 1}, {"value", 2}, {"zeta", 3}};
+        check_lookup(unordered);
+
+        auto flat = more_concepts::flat_map<std::string, int, std::less<>>{{"let", 1}, {"value", 2}, {"zeta", 3}};
+        check_lookup(flat);
+        MORE_CONCEPTS_CHECK(flat.lower_bound("w"sv)->first == "zeta" and flat.upper_bound("let"sv)->first == "value");
+
+        auto hashed = more_concepts::flat_hash_map<std::string, int, more_concepts::string_hash, std::equal_to<>>{
+            {"let", 1},
+            {"value", 2},
+            {"zeta", 3}};
+        check_lookup(hashed);
+
+        MORE_CONCEPTS_CHECK(more_concepts::string_hash{}("abc"sv) == more_concepts::string_hash{}(std::string{"abc"}));
+        MORE_CONCEPTS_CHECK(more_concepts::string_hash{}("abc") == more_concepts::string_hash{}("abc"sv));
+    }
+
+    /// Compares only the first character, so that several keys are equivalent to a probe.
+    struct first_char_less
+    {
+        using is_transparent = void;
+
+        auto operator()(std::string const& lhs, std::string const& rhs) const -> bool { return lhs < rhs; }
+        auto operator()(char const lhs, std::string const& rhs) const -> bool { return lhs < rhs.front(); }
+        auto operator()(std::string const& lhs, char const rhs) const -> bool { return lhs.front() < rhs; }
+    };
+
+    auto test_equivalent_keys() -> void
+    {
+        auto set = more_concepts::flat_set<std::string, first_char_less>{"apple", "banana", "blueberry", "cherry"};
+        MORE_CONCEPTS_CHECK(set.count('b') == 2 and set.count('d') == 0 and set.contains('c'));
+        auto const [first, last] = set.equal_range('b');
+        MORE_CONCEPTS_CHECK(*first == "banana" and std::distance(first, last) == 2 and *last == "cherry");
+    }
+
+    auto const string_map_tests = more_concepts_tests::register_test_case{
+        "string_map",
+        [] {
+            test_transparent_lookup();
+            test_equivalent_keys();
+        }};
+}
@@ -0,0 +1,119 @@
+#include <atomic>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "more_concepts/concurrent_containers.hpp"
+#include "more_concepts/flat_hash_map.hpp"
+#include "more_concepts/striped_map.hpp"
+
+#include "runtime_test.hpp"
+
+namespace
+{
+    static_assert(more_concepts::concurrent_unique_map_container_of<
+        more_concepts::striped_map<std::unordered_map<int, std::string>>, int, std::string>);
+    static_assert(more_concepts::concurrent_unique_map_container<
+        more_concepts::striped_map<more_concepts::flat_hash_map<std::string, int>, 4>>);
+    static_assert(more_concepts::concurrent_unique_map_container<
+        more_concepts::striped_map<std::unordered_map<int, std::shared_ptr<int>>, 1>>);
+    static_assert(not more_concepts::concurrent_unique_map_container<std::unordered_map<int, int>>);
+    static_assert(not more_concepts::concurrent_unique_map_container<std::map<int, int>>);
+
+    template <typename Map>
+    auto test_single_threaded() -> void
+    {
+        auto map = Map{};
+        MORE_CONCEPTS_CHECK(map.empty() and not map.find("a"));
+
+        MORE_CONCEPTS_CHECK(map.insert_or_assign("a", 1));
+        MORE_CONCEPTS_CHECK(map.insert_or_assign(std::string{"b"}, 2));
+        MORE_CONCEPTS_CHECK(not map.insert_or_assign("a", 3));
+        MORE_CONCEPTS_CHECK(not map.try_emplace("b", 4));
+        MORE_CONCEPTS_CHECK(map.size() == 2 and map.find("a") == 3 and map.find("b") == 2);
+
+        MORE_CONCEPTS_CHECK(map.visit("a", [](int& value) { value *= 10; }));
+        MORE_CONCEPTS_CHECK(not map.visit("c", [](int& value) { value = 0; }));
+        auto seen = 0;
+        MORE_CONCEPTS_CHECK(std::as_const(map).visit("a", [&](int const& value) { seen = value; }) and seen == 30);
+
+        auto sum = 0;
+        std::as_const(map).visit_all([&](std::string const&, int const& value) { sum += value; });
+        MORE_CONCEPTS_CHECK(sum == 32);
+
+        MORE_CONCEPTS_CHECK(map.erase("a") == 1 and map.erase("a") == 0);
+        MORE_CONCEPTS_CHECK(not map.contains("a") and map.contains("b"));
+        map.clear();
+        MORE_CONCEPTS_CHECK(map.empty());
+    }
+
+    /// Several threads insert, update and erase overlapping keys at once.
+    auto test_contended() -> void
+    {
+        constexpr auto threads = 4;
+        constexpr auto keys = 1000;
+        constexpr auto rounds = 20;
+
+        auto map = more_concepts::striped_map<std::unordered_map<int, long long>>{};
+        auto inserted = std::atomic<int>{0};
+
+        auto workers = std::vector<std::thread>{};
+        for (auto t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t] {
+                for (auto round = 0; round < rounds; ++round)
+                {
+                    for (auto key = 0; key < keys; ++key)
+                    {
+                        // Every thread increments every key once per round.
+                        if (not map.visit(key, [](long long& count) { ++count; }))
+                        {
+                            if (map.try_emplace(key, 1))
+                            {
+                                ++inserted;
+                            }
+                            else
+                            {
+                                map.visit(key, [](long long& count) { ++count; });
+                            }
+                        }
+                        static_cast<void>(map.find(key));
+
+                        // Private keys are inserted and erased again.
+                        auto const own_key = -1 - (t * keys + key);
+                        map.insert_or_assign(own_key, round);
+                        if (map.erase(own_key) != 1)
+                        {
+                            ++inserted;
+                        }
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        auto all_counted = true;
+        for (auto key = 0; key < keys; ++key)
+        {
+            all_counted = all_counted and map.find(key) == threads * rounds;
+        }
+        MORE_CONCEPTS_CHECK(all_counted);
+        MORE_CONCEPTS_CHECK(inserted.load() == keys and map.size() == keys);
+    }
+
+    auto const striped_map_tests = more_concepts_tests::register_test_case{
+        "striped_map",
+        [] {
+            test_single_threaded<more_concepts::striped_map<std::unordered_map<std::string, int>>>();
+            test_single_threaded<more_concepts::striped_map<more_concepts::flat_hash_map<std::string, int>, 4>>();
+            test_single_threaded<more_concepts::striped_map<std::unordered_map<std::string, int>, 1>>();
+            test_contended();
+        }};
+}